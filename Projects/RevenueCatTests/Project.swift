@@ -256,6 +256,39 @@ let project = Project(
             metadata: .metadata(tags: ["RevenueCatTests"])
         ),
 
+        // MARK: – PerformanceTests
+        // Benchmarks, kept out of `UnitTests` so they don't add time to every CI run. They report
+        // throughput and allocation counts next to wall-clock time; run this scheme to record or
+        // compare baselines.
+        .target(
+            name: "PerformanceTests",
+            destinations: .iOS,
+            product: .unitTests,
+            bundleId: "com.revenuecat.PerformanceTests",
+            deploymentTargets: .iOS("16.0"),
+            infoPlist: .default,
+            sources: [
+                "../../Tests/PerformanceTests/**/*.swift",
+                // RC Container test data, builder and test clock shared with the unit tests.
+                "../../Tests/UnitTests/Networking/RCContainer/RCContainerTestData.swift",
+                "../../Tests/UnitTests/Networking/RCContainer/RCContainer+Builder.swift",
+                "../../Tests/UnitTests/Mocks/TestClock.swift",
+                // Shared `TestCase` base (repo convention) and its helpers.
+                "../../Tests/UnitTests/Misc/**/TestCase.swift",
+                "../../Tests/UnitTests/Misc/XCTestCase+Extensions.swift",
+                "../../Tests/UnitTests/TestHelpers/**/TestLogHandler.swift",
+                "../../Tests/UnitTests/TestHelpers/**/CurrentTestCaseTracker.swift",
+                "../../Tests/UnitTests/TestHelpers/**/AsyncTestHelpers.swift",
+                "../../Tests/UnitTests/TestHelpers/**/OSVersionEquivalent.swift"
+            ],
+            dependencies: [
+                .revenueCat,
+                .nimble,
+                .snapshotTesting
+            ],
+            metadata: .metadata(tags: ["RevenueCatTests"])
+        ),
+
         // MARK: – RevenueCatAdMobTests
         .target(
             name: "RevenueCatAdMobTests",
@@ -27,6 +27,10 @@ protocol AdEventStoreType: Sendable {
     @available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
     func clear(_ count: Int) async
 
+    /// Writes events that were stored but are still only held in memory.
+    @available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
+    func commitPendingEvents() async
+
 }
 
 @available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
@@ -46,10 +50,12 @@ internal actor AdEventStore: AdEventStoreType {
                 await self.clear(Self.eventBatchSizeToClear)
             }
 
-            if let eventDescription = try? storedEvent.encodedEvent.prettyPrintedJSON {
-                Logger.verbose(AdEventStoreStrings.storing_event(eventDescription))
-            } else {
-                Logger.verbose(AdEventStoreStrings.storing_event_without_json)
+            if Logger.verboseLogsEnabled {
+                if let eventDescription = try? storedEvent.encodedEvent.prettyPrintedJSON {
+                    Logger.verbose(AdEventStoreStrings.storing_event(eventDescription))
+                } else {
+                    Logger.verbose(AdEventStoreStrings.storing_event_without_json)
+                }
             }
 
             let event = try StoredAdEventSerializer.encode(storedEvent)
@@ -92,6 +98,14 @@ internal actor AdEventStore: AdEventStoreType {
         }
     }
 
+    func commitPendingEvents() async {
+        do {
+            try await self.handler.commitPendingLines()
+        } catch {
+            Logger.error(AdEventStoreStrings.error_storing_event(error))
+        }
+    }
+
     private func isEventStoreTooBig() async -> Bool {
         do {
             return try await self.handler.fileSizeInKB() > Self.maxEventFileSizeInKB
@@ -113,7 +127,8 @@ extension AdEventStore {
     // We don't want to store events in the documents directory in case app makes their documents
     // accessible via the Files app.
     static func createDefault(
-        persistenceDirectory: URL?
+        persistenceDirectory: URL?,
+        durability: BufferedFileHandler.Durability = .default
     ) -> AdEventStore? {
         guard let directory = persistenceDirectory ?? DirectoryHelper.defaultPersistenceBaseUrl else {
             Logger.error(AdEventStoreStrings.error_resolving_persistence_directory)
@@ -123,7 +138,8 @@ extension AdEventStore {
         Logger.verbose(AdEventStoreStrings.initializing(url))
 
         do {
-            return try .init(handler: FileHandler(url))
+            let handler = try SegmentedFileHandler(url, migratingFrom: Self.legacyURL(in: directory))
+            return .init(handler: BufferedFileHandler(handler, durability: durability))
         } catch {
             Logger.error(AdEventStoreStrings.error_initializing(error))
             return nil
@@ -135,6 +151,11 @@ extension AdEventStore {
     }
 
     private static func url(in container: URL) -> URL {
+        return self.revenueCatFolder(in: container).appendingPathComponent("ad_event_log", isDirectory: true)
+    }
+
+    /// The single file used before events were stored in segments.
+    private static func legacyURL(in container: URL) -> URL {
         return self.revenueCatFolder(in: container).appendingPathComponent("ad_event_store")
     }
 
@@ -17,6 +17,10 @@ import Foundation
 @available(iOS 15.0, macOS 12.0, tvOS 15.0, watchOS 8.0, *)
 final class PostAdEventsOperation: NetworkOperation {
 
+    override class var priority: RequestPriority {
+        return .background
+    }
+
     private let configuration: Configuration
     private let request: AdEventsRequest
     private let path: HTTPRequestPath
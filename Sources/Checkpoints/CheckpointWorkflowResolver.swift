@@ -141,6 +141,14 @@ final class DefaultCheckpointWorkflowResolver: CheckpointWorkflowResolver {
             return .noAction(.configurationUnavailable)
         }
 
+        // Whichever rule matches, its workflow body is read next, so start downloading the candidates while the
+        // audiences are evaluated instead of leaving them queued behind prefetches. Not awaited: matching
+        // doesn't depend on it, and reading the matched body is an on-demand download even without a deadline.
+        let workflowIDs = Self.workflowIDs(in: rulesSnapshot.ruleSet.rules)
+        Task { [workflowManager = self.workflowManager] in
+            await workflowManager.prioritizeWorkflows(workflowIDs, within: Self.workflowDownloadDeadline)
+        }
+
         let rule: CheckpointRule?
         do {
             rule = try await self.matchingRule(in: rulesSnapshot.ruleSet.rules, params: params)
@@ -191,6 +199,12 @@ final class DefaultCheckpointWorkflowResolver: CheckpointWorkflowResolver {
         }
     }
 
+    /// The workflows `rules` reference, in priority order and without duplicates.
+    private static func workflowIDs(in rules: [CheckpointRule]) -> [String] {
+        var seen: Set<String> = []
+        return rules.map(\.workflowId).filter { seen.insert($0).inserted }
+    }
+
     private func offeringID(for rule: CheckpointRule) async -> String? {
         let offeringIdByWorkflowId = await self.workflowManager.offeringIdByWorkflowId()
         guard let offeringID = offeringIdByWorkflowId[rule.workflowId] ?? nil else {
@@ -302,6 +316,9 @@ final class DefaultCheckpointWorkflowResolver: CheckpointWorkflowResolver {
         return .noAction(.configurationUnavailable)
     }
 
+    /// How soon the candidate workflow bodies should be downloaded once a checkpoint starts resolving.
+    private static let workflowDownloadDeadline: TimeInterval = 3
+
     private static let offeringStepType = "offering"
     private static let offeringIdentifierParam = "offering_identifier"
 
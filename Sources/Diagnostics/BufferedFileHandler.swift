@@ -0,0 +1,327 @@
+//
+//  Copyright RevenueCat Inc. All Rights Reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/MIT
+//
+//  BufferedFileHandler.swift
+//
+//  Created by RevenueCat.
+
+import Foundation
+
+/// A `FileHandlerType` that holds appended lines in memory and commits them to another handler in groups.
+///
+/// Reading or removing lines commits the pending ones first, so they always observe every appended line.
+/// Lines stay pending until the underlying handler has written them, and at most one commit is in flight.
+actor BufferedFileHandler: FileHandlerType {
+
+    /// When appended lines are written to disk.
+    enum Durability: Equatable {
+
+        /// Every line is written before `append(line:)` returns.
+        case immediate
+
+        /// Lines are committed once `maxCount` of them are pending, `maxDelay` after the first of them was
+        /// appended, or on `commitPendingLines()`.
+        /// Lines that haven't been committed yet are lost if the process is terminated.
+        case grouped(maxCount: Int, maxDelay: DispatchTimeInterval)
+
+        static let `default`: Self = .grouped(maxCount: 20, maxDelay: .seconds(5))
+
+    }
+
+    struct Counters: Equatable {
+
+        /// Lines appended and held in memory.
+        var bufferedCount = 0
+
+        /// Lines written to the underlying handler.
+        var committedCount = 0
+
+        /// Lines discarded because the buffer was full.
+        var droppedCount = 0
+
+    }
+
+    private let handler: FileHandlerType
+    private let durability: Durability
+
+    /// Oldest first. The first `inFlightCount` lines are being written by `inFlightCommit`.
+    private var pendingLines: RingBuffer<String>
+    private var inFlightCount = 0
+    /// In-flight lines the full buffer dropped. They are only lost if the in-flight commit fails.
+    private var inFlightDroppedCount = 0
+
+    private var inFlightCommit: Task<Void, Swift.Error>?
+    private var scheduledCommit: Task<Void, Never>?
+
+    private(set) var counters: Counters = .init()
+
+    init(
+        _ handler: FileHandlerType,
+        durability: Durability = .default,
+        capacity: Int = BufferedFileHandler.defaultCapacity
+    ) {
+        self.handler = handler
+        self.durability = durability
+        self.pendingLines = .init(capacity: capacity)
+    }
+
+    var pendingCount: Int {
+        return self.pendingLines.count
+    }
+
+    @available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
+    func readLines() async throws -> AsyncThrowingStream<String, Swift.Error> {
+        try await self.commitPendingLines()
+
+        return try await self.handler.readLines()
+    }
+
+    @available(iOS 13.4, tvOS 13.4, watchOS 6.2, macOS 10.15.4, *)
+    func append(line: String) async throws {
+        switch self.durability {
+        case .immediate:
+            try await self.handler.append(line: line)
+            self.counters.committedCount += 1
+
+        case let .grouped(maxCount, maxDelay):
+            if self.pendingLines.append(line) != nil {
+                self.recordDroppedLine()
+            }
+            self.counters.bufferedCount += 1
+
+            if self.pendingLines.count - self.inFlightCount >= maxCount {
+                try await self.commitPendingLines()
+            } else if self.scheduledCommit == nil {
+                self.scheduleCommit(after: maxDelay)
+            }
+        }
+    }
+
+    /// Returns once every line appended before this call has been written to the underlying handler.
+    ///
+    /// Joins the commit in flight, if any, and then commits the lines left pending with a single `append(lines:)`.
+    /// - Note: if that fails, the lines remain pending in their original order.
+    func commitPendingLines() async throws {
+        self.cancelScheduledCommit()
+
+        // Pending lines are committed oldest first, so this call is done once the newest of them is resolved.
+        let appendedCount = self.counters.bufferedCount
+        while self.pendingLines.count > self.counters.bufferedCount - appendedCount {
+            try await (self.inFlightCommit ?? self.startCommit()).value
+        }
+    }
+
+    func emptyFile() async throws {
+        self.cancelScheduledCommit()
+
+        // Lines of a commit in flight would otherwise be written after the file is emptied.
+        while let commit = self.inFlightCommit {
+            _ = try? await commit.value
+        }
+        _ = self.pendingLines.removeAll()
+
+        try await self.handler.emptyFile()
+    }
+
+    func removeFirstLines(_ count: Int) async throws {
+        try await self.commitPendingLines()
+        try await self.handler.removeFirstLines(count)
+    }
+
+    func fileSizeInKB() async throws -> Double {
+        let pendingSize = self.pendingLines.reduce(0) { $0 + $1.utf8.count + 1 }
+
+        return try await self.handler.fileSizeInKB() + Double(pendingSize) / 1024
+    }
+
+    // MARK: -
+
+    static let defaultCapacity = 500
+
+}
+
+private extension BufferedFileHandler {
+
+    func startCommit() -> Task<Void, Swift.Error> {
+        let commit = Task {
+            try await self.commitInFlightLines()
+        }
+        self.inFlightCommit = commit
+
+        return commit
+    }
+
+    /// Writes the pending lines and only then removes them from the buffer.
+    func commitInFlightLines() async throws {
+        let lines = Array(self.pendingLines)
+        self.inFlightCount = lines.count
+        defer {
+            self.inFlightCount = 0
+            self.inFlightDroppedCount = 0
+            self.inFlightCommit = nil
+        }
+
+        guard !lines.isEmpty else { return }
+
+        do {
+            if #available(iOS 13.4, tvOS 13.4, watchOS 6.2, macOS 10.15.4, *) {
+                try await self.handler.append(lines: lines)
+            }
+        } catch {
+            self.counters.droppedCount += self.inFlightDroppedCount
+            throw error
+        }
+
+        self.pendingLines.removeFirst(self.inFlightCount)
+        self.counters.committedCount += lines.count
+        Logger.verbose(Message.committed_lines(lines.count))
+    }
+
+    /// Accounts for the oldest pending line, dropped by the full buffer.
+    func recordDroppedLine() {
+        Logger.warn(Message.dropped_line(capacity: self.pendingLines.capacity))
+
+        if self.inFlightCount > 0 {
+            self.inFlightCount -= 1
+            self.inFlightDroppedCount += 1
+        } else {
+            self.counters.droppedCount += 1
+        }
+    }
+
+    func cancelScheduledCommit() {
+        self.scheduledCommit?.cancel()
+        self.scheduledCommit = nil
+    }
+
+    func scheduleCommit(after delay: DispatchTimeInterval) {
+        self.scheduledCommit = Task { [weak self] in
+            try? await Task.sleep(nanoseconds: delay.nanoseconds)
+            guard !Task.isCancelled else { return }
+
+            await self?.commitPendingLinesAfterDelay()
+        }
+    }
+
+    func commitPendingLinesAfterDelay() async {
+        do {
+            try await self.commitPendingLines()
+        } catch {
+            Logger.error(Message.failed_committing_lines(error))
+        }
+    }
+
+}
+
+/// A fixed-capacity FIFO queue that drops its oldest element when full.
+struct RingBuffer<Element> {
+
+    let capacity: Int
+
+    private var storage: [Element?]
+    private var head = 0
+    private(set) var count = 0
+
+    init(capacity: Int) {
+        precondition(capacity > 0, "Invalid capacity: \(capacity)")
+
+        self.capacity = capacity
+        self.storage = .init(repeating: nil, count: capacity)
+    }
+
+    var isEmpty: Bool {
+        return self.count == 0
+    }
+
+    /// - Returns: the element that was dropped to make room for `element`, if any.
+    @discardableResult
+    mutating func append(_ element: Element) -> Element? {
+        let tail = (self.head + self.count) % self.capacity
+
+        guard self.count == self.capacity else {
+            self.storage[tail] = element
+            self.count += 1
+            return nil
+        }
+
+        let dropped = self.storage[self.head]
+        self.storage[self.head] = element
+        self.head = (self.head + 1) % self.capacity
+        return dropped
+    }
+
+    /// Removes the `count` oldest elements.
+    mutating func removeFirst(_ count: Int) {
+        precondition(count >= 0 && count <= self.count, "Invalid count: \(count)")
+
+        for index in 0..<count {
+            self.storage[(self.head + index) % self.capacity] = nil
+        }
+        self.head = (self.head + count) % self.capacity
+        self.count -= count
+    }
+
+    /// - Returns: every element, oldest first.
+    mutating func removeAll() -> [Element] {
+        let elements = Array(self)
+
+        self.storage = .init(repeating: nil, count: self.capacity)
+        self.head = 0
+        self.count = 0
+
+        return elements
+    }
+
+}
+
+extension RingBuffer: Sequence {
+
+    func makeIterator() -> AnyIterator<Element> {
+        var index = 0
+
+        return AnyIterator {
+            guard index < self.count else { return nil }
+            defer { index += 1 }
+
+            return self.storage[(self.head + index) % self.capacity]
+        }
+    }
+
+}
+
+extension RingBuffer: Sendable where Element: Sendable {}
+
+// MARK: - Messages
+
+// swiftlint:disable identifier_name
+
+private enum Message: LogMessage {
+
+    case committed_lines(Int)
+    case failed_committing_lines(Error)
+    case dropped_line(capacity: Int)
+
+    var description: String {
+        switch self {
+        case let .committed_lines(count):
+            return "Committed \(count) buffered line(s)"
+
+        case let .failed_committing_lines(error):
+            return "Error committing buffered lines: \(error.localizedDescription)"
+
+        case let .dropped_line(capacity):
+            return "Buffer of \(capacity) lines is full. Dropping the oldest line."
+        }
+    }
+
+    var category: String { return "file_handler" }
+
+}
+
+// swiftlint:enable identifier_name
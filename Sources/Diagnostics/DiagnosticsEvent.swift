@@ -63,6 +63,7 @@ struct DiagnosticsEvent: Codable, Equatable {
         case appleTransactionQueueReceived = "apple_transaction_queue_received"
         case appleTransactionUpdateReceived = "apple_transaction_update_received"
         case appleAppTransactionError = "apple_app_transaction_error"
+        case remoteConfigBlobConcurrencyLimit = "remote_config_blob_concurrency_limit"
     }
 
     enum PurchaseResult: String, Codable, Equatable {
@@ -118,6 +119,7 @@ struct DiagnosticsEvent: Codable, Equatable {
         let currency: String?
         let reason: String?
         let connectionErrorReason: ConnectionErrorReason?
+        let concurrencyLimit: Int?
 
         init(verificationResult: String? = nil,
              endpointName: String? = nil,
@@ -157,7 +159,8 @@ struct DiagnosticsEvent: Codable, Equatable {
              price: Float? = nil,
              currency: String? = nil,
              reason: String? = nil,
-             connectionErrorReason: ConnectionErrorReason? = nil) {
+             connectionErrorReason: ConnectionErrorReason? = nil,
+             concurrencyLimit: Int? = nil) {
             self.verificationResult = verificationResult
             self.endpointName = endpointName
             self.host = host
@@ -197,6 +200,7 @@ struct DiagnosticsEvent: Codable, Equatable {
             self.currency = currency
             self.reason = reason
             self.connectionErrorReason = connectionErrorReason
+            self.concurrencyLimit = concurrencyLimit
         }
 
         static let empty = Properties()
@@ -176,6 +176,9 @@ protocol DiagnosticsTrackerType: Sendable {
     func trackAppleAppTransactionError(errorMessage: String,
                                        errorCode: Int?,
                                        storeKitErrorDescription: String?)
+
+    @available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
+    func trackRemoteConfigBlobConcurrencyLimit(limit: Int)
 }
 
 @available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
@@ -524,6 +527,13 @@ final class DiagnosticsTracker: DiagnosticsTrackerType, Sendable {
                         ))
     }
 
+    func trackRemoteConfigBlobConcurrencyLimit(limit: Int) {
+        self.trackEvent(name: .remoteConfigBlobConcurrencyLimit,
+                        properties: DiagnosticsEvent.Properties(
+                            concurrencyLimit: limit
+                        ))
+    }
+
 }
 
 @available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
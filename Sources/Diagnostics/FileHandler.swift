@@ -18,12 +18,19 @@ protocol FileHandlerType: Sendable {
 
     /// Returns an async sequence for every line in the file
     @available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
-    func readLines() async throws -> AsyncLineSequence<FileHandle.AsyncBytes>
+    func readLines() async throws -> AsyncThrowingStream<String, Swift.Error>
 
     /// Adds a line at the end of the file
     @available(iOS 13.4, tvOS 13.4, watchOS 6.2, macOS 10.15.4, *)
     func append(line: String) async throws
 
+    /// Adds several lines at the end of the file, synchronizing them to disk once.
+    @available(iOS 13.4, tvOS 13.4, watchOS 6.2, macOS 10.15.4, *)
+    func append(lines: [String]) async throws
+
+    /// Writes any appended lines that are still only held in memory.
+    func commitPendingLines() async throws
+
     /// Removes the contents of the file
     func emptyFile() async throws
 
@@ -34,6 +41,19 @@ protocol FileHandlerType: Sendable {
 
 }
 
+extension FileHandlerType {
+
+    @available(iOS 13.4, tvOS 13.4, watchOS 6.2, macOS 10.15.4, *)
+    func append(lines: [String]) async throws {
+        for line in lines {
+            try await self.append(line: line)
+        }
+    }
+
+    func commitPendingLines() async throws {}
+
+}
+
 actor FileHandler: FileHandlerType {
 
     private var fileHandle: FileHandle
@@ -66,22 +86,30 @@ actor FileHandler: FileHandlerType {
 
     /// Returns an async sequence for every line in the file
     @available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
-    func readLines() throws -> AsyncLineSequence<FileHandle.AsyncBytes> {
+    func readLines() throws -> AsyncThrowingStream<String, Swift.Error> {
         RCTestAssertNotMainThread()
 
         try self.moveToBeginningOfFile()
 
-        return self.fileHandle.bytes.lines
+        return self.fileHandle.bytes.lines.toAsyncThrowingStream()
     }
 
     /// Adds a line at the end of the file
     @available(iOS 13.4, tvOS 13.4, watchOS 6.2, macOS 10.15.4, *)
     func append(line: String) throws {
+        try self.append(lines: [line])
+    }
+
+    /// Adds several lines at the end of the file, synchronizing them to disk once.
+    @available(iOS 13.4, tvOS 13.4, watchOS 6.2, macOS 10.15.4, *)
+    func append(lines: [String]) throws {
         RCTestAssertNotMainThread()
 
         try self.fileHandle.seekToEnd()
-        try self.fileHandle.write(contentsOf: line.asData)
-        try self.fileHandle.write(contentsOf: Self.lineBreakData)
+        for line in lines {
+            try self.fileHandle.write(contentsOf: line.asData)
+            try self.fileHandle.write(contentsOf: Self.lineBreakData)
+        }
         try self.fileHandle.synchronize()
     }
 
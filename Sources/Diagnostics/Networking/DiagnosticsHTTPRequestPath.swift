@@ -53,6 +53,13 @@ extension HTTPRequest.DiagnosticsPath: HTTPRequestPath {
         }
     }
 
+    var priority: RequestPriority {
+        switch self {
+        case .postDiagnostics:
+            return .background
+        }
+    }
+
     var name: String {
         switch self {
         case .postDiagnostics:
@@ -15,6 +15,10 @@ import Foundation
 
 final class DiagnosticsPostOperation: NetworkOperation {
 
+    override class var priority: RequestPriority {
+        return .background
+    }
+
     private let configuration: Configuration
     private let request: DiagnosticsEventsRequest
     private let responseHandler: CustomerAPI.SimpleResponseHandler?
@@ -0,0 +1,470 @@
+//
+//  Copyright RevenueCat Inc. All Rights Reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/MIT
+//
+//  SegmentedFileHandler.swift
+//
+//  Created by RevenueCat.
+
+import Foundation
+
+/// A `FileHandlerType` that stores its lines in a directory of append-only segment files.
+///
+/// Unlike `FileHandler`, removing lines never rewrites the remaining contents:
+/// it advances a persisted consumer offset, and deletes segments once every line in them is consumed.
+/// Appending only writes to the last segment, and the size of the contents is tracked in memory.
+actor SegmentedFileHandler: FileHandlerType {
+
+    private struct Segment {
+
+        let id: Int
+        var size: UInt64
+
+    }
+
+    /// The position of the first line that hasn't been removed yet.
+    private struct Offset: Equatable {
+
+        var segmentID: Int
+        var byteOffset: UInt64
+
+    }
+
+    let url: URL
+    private let segmentSize: UInt64
+
+    /// Ordered from oldest to newest. Never contains a fully consumed segment.
+    private var segments: [Segment]
+    private var offset: Offset
+    private var lastSegmentHandle: FileHandle?
+
+    /// - Parameter directoryURL: the directory containing the segments.
+    /// - Parameter legacyFileURL: a single file written by `FileHandler`, whose lines become the last segment.
+    init(
+        _ directoryURL: URL,
+        segmentSize: Int = SegmentedFileHandler.defaultSegmentSize,
+        migratingFrom legacyFileURL: URL? = nil
+    ) throws {
+        precondition(segmentSize > 0, "Invalid segment size: \(segmentSize)")
+
+        try Self.createDirectoryIfNecessary(directoryURL)
+
+        self.url = directoryURL
+        self.segmentSize = UInt64(segmentSize)
+
+        var segments = try Self.loadSegments(in: directoryURL)
+        if let legacyFileURL {
+            segments = Self.migrateLegacyFile(legacyFileURL, into: directoryURL, segments: segments)
+        }
+
+        let (remainingSegments, offset) = Self.removingConsumedSegments(segments,
+                                                                        offset: Self.loadOffset(in: directoryURL),
+                                                                        in: directoryURL)
+        self.segments = remainingSegments
+        self.offset = offset
+    }
+
+    deinit {
+        let url = self.url
+        Logger.verbose(Message.closing_segment(url))
+
+        try? self.lastSegmentHandle?.close()
+    }
+
+    /// Returns an async sequence for every line, reading one segment after the other.
+    @available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
+    func readLines() throws -> AsyncThrowingStream<String, Swift.Error> {
+        RCTestAssertNotMainThread()
+
+        var pendingSegments = self.segments.map { segment in
+            (url: self.segmentURL(segment.id),
+             byteOffset: segment.id == self.offset.segmentID ? self.offset.byteOffset : 0)
+        }[...]
+        var lines: AsyncLineSequence<FileHandle.AsyncBytes>.AsyncIterator?
+
+        return AsyncThrowingStream {
+            while true {
+                if let line = try await lines?.next() {
+                    return line
+                }
+
+                guard let segment = pendingSegments.popFirst() else {
+                    return nil
+                }
+
+                let handle = try FileHandle(forReadingFrom: segment.url)
+                try handle.seek(toOffset: segment.byteOffset)
+                lines = handle.bytes.lines.makeAsyncIterator()
+            }
+        }
+    }
+
+    /// Adds a line at the end of the last segment, starting a new one if it's full.
+    @available(iOS 13.4, tvOS 13.4, watchOS 6.2, macOS 10.15.4, *)
+    func append(line: String) throws {
+        try self.append(lines: [line])
+    }
+
+    /// Adds several lines at the end of the last segment, synchronizing them to disk once.
+    @available(iOS 13.4, tvOS 13.4, watchOS 6.2, macOS 10.15.4, *)
+    func append(lines: [String]) throws {
+        RCTestAssertNotMainThread()
+
+        for line in lines {
+            let data = line.asData + Self.lineBreakData
+            let handle = try self.lastSegmentHandle(fitting: UInt64(data.count))
+
+            try handle.write(contentsOf: data)
+
+            self.segments[self.segments.count - 1].size += UInt64(data.count)
+        }
+
+        try self.lastSegmentHandle?.synchronize()
+    }
+
+    /// Removes every segment
+    func emptyFile() async throws {
+        RCTestAssertNotMainThread()
+
+        self.closeLastSegment()
+
+        do {
+            for segment in self.segments {
+                try Self.fileManager.removeItem(at: self.segmentURL(segment.id))
+            }
+            try Self.removeItemIfPresent(self.offsetURL)
+        } catch {
+            throw FileHandler.Error.failedEmptyingFile(error)
+        }
+
+        self.segments.removeAll()
+        self.offset = .init(segmentID: 0, byteOffset: 0)
+    }
+
+    /// Deletes the first N lines by advancing the offset, only reading the lines being removed.
+    func removeFirstLines(_ count: Int) async throws {
+        precondition(count > 0, "Invalid count: \(count)")
+
+        var remainingLines = count
+        var offset = self.offset
+        var consumedSegments = 0
+
+        for segment in self.segments where remainingLines > 0 {
+            let byteOffset = segment.id == offset.segmentID ? offset.byteOffset : 0
+            let (linesRead, newByteOffset) = try self.skipLines(remainingLines,
+                                                                in: segment,
+                                                                from: byteOffset)
+            remainingLines -= linesRead
+
+            if newByteOffset >= segment.size {
+                consumedSegments += 1
+                offset = .init(segmentID: segment.id + 1, byteOffset: 0)
+            } else {
+                offset = .init(segmentID: segment.id, byteOffset: newByteOffset)
+            }
+        }
+
+        guard offset != self.offset else { return }
+
+        // The offset is persisted before deleting segments: if that is interrupted,
+        // `removingConsumedSegments` deletes them when loading.
+        try self.saveOffset(offset)
+        self.offset = offset
+
+        if consumedSegments > 0 {
+            if consumedSegments == self.segments.count {
+                self.closeLastSegment()
+            }
+
+            Logger.verbose(Message.removing_segments(consumedSegments))
+            for segment in self.segments.prefix(consumedSegments) {
+                Self.removeSegment(self.segmentURL(segment.id))
+            }
+            self.segments.removeFirst(consumedSegments)
+        }
+    }
+
+    func fileSizeInKB() async throws -> Double {
+        let totalSize = self.segments.reduce(0) { $0 + $1.size }
+        let consumedSize = self.segments.first?.id == self.offset.segmentID ? self.offset.byteOffset : 0
+
+        return Double(totalSize - consumedSize) / 1024
+    }
+
+    // MARK: -
+
+    static let defaultSegmentSize = 64 * 1024
+
+    private static let fileManager: FileManager = .default
+
+    private static let lineBreak: UInt8 = 0x0A
+    private static let lineBreakData = Data([SegmentedFileHandler.lineBreak])
+    private static let bufferSize = 4096
+
+    private static let segmentExtension = "segment"
+    private static let offsetFileName = "offset"
+
+}
+
+// MARK: - Private
+
+private extension SegmentedFileHandler {
+
+    var offsetURL: URL {
+        return self.url.appendingPathComponent(Self.offsetFileName)
+    }
+
+    func segmentURL(_ id: Int) -> URL {
+        return Self.segmentURL(id, in: self.url)
+    }
+
+    static func segmentURL(_ id: Int, in directoryURL: URL) -> URL {
+        return directoryURL
+            .appendingPathComponent(String(id))
+            .appendingPathExtension(Self.segmentExtension)
+    }
+
+    @available(iOS 13.4, tvOS 13.4, watchOS 6.2, macOS 10.15.4, *)
+    func lastSegmentHandle(fitting byteCount: UInt64) throws -> FileHandle {
+        if let last = self.segments.last, last.size == 0 || last.size + byteCount <= self.segmentSize {
+            if let handle = self.lastSegmentHandle {
+                return handle
+            }
+
+            let handle = try Self.createHandle(forWritingTo: self.segmentURL(last.id))
+            try handle.seekToEnd()
+            self.lastSegmentHandle = handle
+            return handle
+        }
+
+        self.closeLastSegment()
+
+        let id = self.segments.last.map { $0.id + 1 } ?? self.offset.segmentID
+        let url = self.segmentURL(id)
+
+        Logger.verbose(Message.creating_segment(url))
+        guard Self.fileManager.createFile(atPath: url.path, contents: nil, attributes: nil) else {
+            throw FileHandler.Error.failedCreatingFile(url)
+        }
+
+        let handle = try Self.createHandle(forWritingTo: url)
+        self.segments.append(.init(id: id, size: 0))
+        self.lastSegmentHandle = handle
+        return handle
+    }
+
+    /// Synchronizes and closes the last segment, whose lines might not have been synchronized yet.
+    func closeLastSegment() {
+        try? self.lastSegmentHandle?.synchronize()
+        try? self.lastSegmentHandle?.close()
+        self.lastSegmentHandle = nil
+    }
+
+    /// - Returns: how many of the `count` lines were found in `segment` past `byteOffset`,
+    /// and the offset right after the last of those.
+    func skipLines(_ count: Int, in segment: Segment, from byteOffset: UInt64) throws -> (Int, UInt64) {
+        let handle: FileHandle
+        do {
+            handle = try FileHandle(forReadingFrom: self.segmentURL(segment.id))
+        } catch {
+            throw FileHandler.Error.failedCreatingHandle(error)
+        }
+        defer { try? handle.close() }
+
+        do {
+            try handle.seek(toOffset: byteOffset)
+        } catch {
+            throw FileHandler.Error.failedSeeking(error)
+        }
+
+        var linesRead = 0
+        var offset = byteOffset
+
+        while linesRead < count {
+            let data = handle.readData(ofLength: Self.bufferSize)
+            guard !data.isEmpty else { break }
+
+            var bytesRead = 0
+            for byte in data {
+                bytesRead += 1
+
+                if byte == Self.lineBreak {
+                    linesRead += 1
+                    if linesRead == count { break }
+                }
+            }
+
+            offset += UInt64(bytesRead)
+        }
+
+        return (linesRead, offset)
+    }
+
+    func saveOffset(_ offset: Offset) throws {
+        let contents = "\(offset.segmentID) \(offset.byteOffset)"
+        try contents.asData.write(to: self.offsetURL, options: .atomic)
+    }
+
+    static func loadOffset(in directoryURL: URL) -> Offset {
+        let url = directoryURL.appendingPathComponent(Self.offsetFileName)
+
+        guard let data = try? Data(contentsOf: url), let contents = String(data: data, encoding: .utf8) else {
+            return .init(segmentID: 0, byteOffset: 0)
+        }
+
+        let components = contents.split(separator: " ")
+        guard components.count == 2,
+              let segmentID = Int(components[0]),
+              let byteOffset = UInt64(components[1]) else {
+            Logger.warn(Message.invalid_offset(contents))
+            return .init(segmentID: 0, byteOffset: 0)
+        }
+
+        return .init(segmentID: segmentID, byteOffset: byteOffset)
+    }
+
+    static func loadSegments(in directoryURL: URL) throws -> [Segment] {
+        let urls = try Self.fileManager.contentsOfDirectory(at: directoryURL,
+                                                            includingPropertiesForKeys: [.fileSizeKey])
+
+        return urls
+            .filter { $0.pathExtension == Self.segmentExtension }
+            .compactMap { url in
+                guard let id = Int(url.deletingPathExtension().lastPathComponent) else { return nil }
+                let size = (try? url.resourceValues(forKeys: [.fileSizeKey]).fileSize) ?? 0
+
+                return Segment(id: id, size: UInt64(size))
+            }
+            .sorted { $0.id < $1.id }
+    }
+
+    /// Deletes segments before `offset`, left behind if removing lines was interrupted.
+    static func removingConsumedSegments(
+        _ segments: [Segment],
+        offset: Offset,
+        in directoryURL: URL
+    ) -> ([Segment], Offset) {
+        let consumed = segments.prefix { $0.id < offset.segmentID }
+        for segment in consumed {
+            Self.removeSegment(Self.segmentURL(segment.id, in: directoryURL))
+        }
+
+        let remaining = Array(segments.dropFirst(consumed.count))
+        guard let first = remaining.first, first.id == offset.segmentID else {
+            // The offset doesn't point into a segment: the first remaining one is read from its start.
+            return (remaining, .init(segmentID: remaining.first?.id ?? offset.segmentID, byteOffset: 0))
+        }
+
+        return (remaining, offset)
+    }
+
+    /// Moves the legacy file in as the last segment. When segments already exist, for example because an older
+    /// version wrote to the legacy file again, its lines are kept after theirs instead of being discarded.
+    static func migrateLegacyFile(_ legacyFileURL: URL, into directoryURL: URL, segments: [Segment]) -> [Segment] {
+        guard Self.fileManager.fileExists(atPath: legacyFileURL.path) else { return segments }
+
+        do {
+            Logger.verbose(Message.migrating_legacy_file(legacyFileURL))
+
+            let segmentURL = Self.segmentURL(segments.last.map { $0.id + 1 } ?? 0, in: directoryURL)
+            try Self.fileManager.moveItem(at: legacyFileURL, to: segmentURL)
+            if segments.isEmpty {
+                try Self.removeItemIfPresent(directoryURL.appendingPathComponent(Self.offsetFileName))
+            }
+
+            return try Self.loadSegments(in: directoryURL)
+        } catch {
+            Logger.warn(Message.failed_migrating_legacy_file(error))
+            return segments
+        }
+    }
+
+    static func createDirectoryIfNecessary(_ url: URL) throws {
+        guard !Self.fileManager.fileExists(atPath: url.path) else { return }
+
+        do {
+            Logger.verbose(Message.creating_directory(url))
+
+            try Self.fileManager.createDirectory(at: url, withIntermediateDirectories: true, attributes: nil)
+        } catch {
+            throw FileHandler.Error.failedCreatingDirectory(url, error)
+        }
+    }
+
+    static func createHandle(forWritingTo url: URL) throws -> FileHandle {
+        do {
+            return try FileHandle(forWritingTo: url)
+        } catch {
+            throw FileHandler.Error.failedCreatingHandle(error)
+        }
+    }
+
+    static func removeSegment(_ url: URL) {
+        do {
+            try Self.fileManager.removeItem(at: url)
+        } catch {
+            Logger.warn(Message.failed_removing_segment(url, error))
+        }
+    }
+
+    static func removeItemIfPresent(_ url: URL) throws {
+        guard Self.fileManager.fileExists(atPath: url.path) else { return }
+
+        try Self.fileManager.removeItem(at: url)
+    }
+
+}
+
+// MARK: - Messages
+
+// swiftlint:disable identifier_name
+
+private enum Message: LogMessage {
+
+    case creating_directory(URL)
+    case creating_segment(URL)
+    case closing_segment(URL)
+    case removing_segments(Int)
+    case failed_removing_segment(URL, Error)
+    case invalid_offset(String)
+    case migrating_legacy_file(URL)
+    case failed_migrating_legacy_file(Error)
+
+    var description: String {
+        switch self {
+        case let .creating_directory(url):
+            return "Creating directory: \(url)"
+
+        case let .creating_segment(url):
+            return "Creating segment: \(url)"
+
+        case let .closing_segment(url):
+            return "Closing SegmentedFileHandler for: \(url)"
+
+        case let .removing_segments(count):
+            return "Removing \(count) consumed segment(s)"
+
+        case let .failed_removing_segment(url, error):
+            return "Error removing segment '\(url)': \(error.localizedDescription)"
+
+        case let .invalid_offset(contents):
+            return "Found invalid segment offset '\(contents)'. Reading from the first segment."
+
+        case let .migrating_legacy_file(url):
+            return "Moving '\(url)' into a segment"
+
+        case let .failed_migrating_legacy_file(error):
+            return "Error moving file into a segment: \(error.localizedDescription)"
+        }
+    }
+
+    var category: String { return "file_handler" }
+
+}
+
+// swiftlint:enable identifier_name
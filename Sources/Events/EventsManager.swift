@@ -138,11 +138,21 @@ actor EventsManager: EventsManagerType {
         return try await self.flushFeatureEventsInternal(batchSize: batchSize)
     }
 
+    /// Writes events that the stores still only hold in memory.
+    func commitPendingEvents() async {
+        await self.store.commitPendingEvents()
+        await self.adEventStore?.commitPendingEvents()
+    }
+
     private static let flushAllEventsBackgroundTaskName = "com.revenuecat.flushAllEvents"
     private static let flushFeatureEventsBackgroundTaskName = "com.revenuecat.flushFeatureEvents"
 
     nonisolated func flushAllEventsWithBackgroundTask(batchSize: Int) {
         self.withBackgroundTask(name: Self.flushAllEventsBackgroundTaskName) {
+            // This runs when the app resigns active: write buffered events first,
+            // so they're kept even if posting them doesn't finish before the app is suspended.
+            await self.commitPendingEvents()
+
             do {
                 _ = try await self.flushAllEvents(batchSize: batchSize)
             } catch {
@@ -27,6 +27,10 @@ protocol FeatureEventStoreType: Sendable {
     @available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
     func clear(_ count: Int) async
 
+    /// Writes events that were stored but are still only held in memory.
+    @available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
+    func commitPendingEvents() async
+
 }
 
 @available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
@@ -46,10 +50,12 @@ internal actor FeatureEventStore: FeatureEventStoreType {
                 await self.clear(Self.eventBatchSizeToClear)
             }
 
-            if let eventDescription = try? storedEvent.encodedEvent.prettyPrintedJSON {
-                Logger.verbose(FeatureEventStoreStrings.storing_event(eventDescription))
-            } else {
-                Logger.verbose(FeatureEventStoreStrings.storing_event_without_json)
+            if Logger.verboseLogsEnabled {
+                if let eventDescription = try? storedEvent.encodedEvent.prettyPrintedJSON {
+                    Logger.verbose(FeatureEventStoreStrings.storing_event(eventDescription))
+                } else {
+                    Logger.verbose(FeatureEventStoreStrings.storing_event_without_json)
+                }
             }
 
             let event = try StoredFeatureEventSerializer.encode(storedEvent)
@@ -91,6 +97,14 @@ internal actor FeatureEventStore: FeatureEventStoreType {
         }
     }
 
+    func commitPendingEvents() async {
+        do {
+            try await self.handler.commitPendingLines()
+        } catch {
+            Logger.error(FeatureEventStoreStrings.error_storing_event(error))
+        }
+    }
+
     private func isEventStoreTooBig() async -> Bool {
         do {
             return try await self.handler.fileSizeInKB() > Self.maxEventFileSizeInKB
@@ -113,7 +127,8 @@ extension FeatureEventStore {
     // accessible via the Files app.
     static func createDefault(
         persistenceDirectory: URL?,
-        documentsDirectory: URL? = nil
+        documentsDirectory: URL? = nil,
+        durability: BufferedFileHandler.Durability = .default
     ) -> FeatureEventStore? {
         guard let directory = persistenceDirectory ?? DirectoryHelper.defaultPersistenceBaseUrl else {
             Logger.error(FeatureEventStoreStrings.error_resolving_persistence_directory)
@@ -125,7 +140,8 @@ extension FeatureEventStore {
         Self.removeLegacyDocumentsStore(overrideDocumentsDirectory: documentsDirectory)
 
         do {
-            return try .init(handler: FileHandler(url))
+            let handler = try SegmentedFileHandler(url, migratingFrom: Self.legacyURL(in: directory))
+            return .init(handler: BufferedFileHandler(handler, durability: durability))
         } catch {
             Logger.error(FeatureEventStoreStrings.error_initializing(error))
             return nil
@@ -137,6 +153,11 @@ extension FeatureEventStore {
     }
 
     private static func url(in container: URL) -> URL {
+        return self.revenueCatFolder(in: container).appendingPathComponent("paywall_event_log", isDirectory: true)
+    }
+
+    /// The single file used before events were stored in segments.
+    private static func legacyURL(in container: URL) -> URL {
         return self.revenueCatFolder(in: container).appendingPathComponent("paywall_event_store")
     }
 
@@ -16,6 +16,10 @@ import Foundation
 /// A `NetworkOperation` for posting feature events to the feature events endpoint.
 final class PostFeatureEventsOperation: NetworkOperation {
 
+    override class var priority: RequestPriority {
+        return .background
+    }
+
     private let configuration: Configuration
     private let request: FeatureEventsRequest
     private let path: HTTPRequestPath
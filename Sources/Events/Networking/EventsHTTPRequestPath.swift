@@ -40,4 +40,8 @@ extension EventsHTTPRequestPath {
         return "/v1/events"
     }
 
+    var priority: RequestPriority {
+        return .background
+    }
+
 }
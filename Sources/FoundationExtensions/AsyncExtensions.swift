@@ -173,4 +173,11 @@ internal extension AsyncSequence {
         }
     }
 
+    func toAsyncThrowingStream() -> AsyncThrowingStream<Element, Error> {
+        var asyncIterator = self.makeAsyncIterator()
+        return AsyncThrowingStream<Element, Error> {
+            try await asyncIterator.next()
+        }
+    }
+
 }
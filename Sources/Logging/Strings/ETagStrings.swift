@@ -23,6 +23,9 @@ enum ETagStrings {
     case storing_response(URLRequest, ETagManager.Response)
     case not_storing_etag(VerifiedHTTPResponse<Data?>)
     case using_etag(URLRequest, String, Date?)
+    case evicting_responses(count: Int, byteBudget: Int)
+    case indexing_stored_responses(count: Int)
+    case failed_to_decompress_response(URLRequest, Error)
     case not_using_etag(URLRequest,
                         VerificationResult,
                         needsSignatureVerification: Bool)
@@ -52,6 +55,15 @@ extension ETagStrings: LogMessage {
             return "Using etag '\(etag)' for request to '\(request.urlDescription)'. " +
             "Validation time: \(validationTime?.description ?? "<null>")"
 
+        case let .evicting_responses(count, byteBudget):
+            return "Evicting \(count) least recently used cached responses to stay within \(byteBudget) bytes"
+
+        case let .indexing_stored_responses(count):
+            return "Adding \(count) cached responses missing from the ETag index"
+
+        case let .failed_to_decompress_response(request, error):
+            return "Failed to decompress cached response for '\(request.urlDescription)': \(error)"
+
         case let .not_using_etag(request, storedVerificationResult, needsSignatureVerification):
             return "Not using etag for '\(request.urlDescription)'. " +
             "Requested verification: \(needsSignatureVerification). Stored result: \(storedVerificationResult)"
@@ -41,6 +41,8 @@ enum NetworkStrings {
     case serial_request_done(httpMethod: String?, path: String?, queuedRequestsCount: Int)
     case serial_request_queued(httpMethod: String, path: String, queuedRequestsCount: Int)
     case serial_request_paused(httpMethod: String, path: String)
+    case concurrent_request_queued(httpMethod: String, path: String, queuedRequestsCount: Int)
+    case request_waited_in_queue(httpMethod: String, path: String, waitTime: TimeInterval)
     case starting_next_request(request: String)
     case starting_request(httpMethod: String, path: String)
     case retrying_request(httpMethod: String, path: String)
@@ -48,12 +50,17 @@ enum NetworkStrings {
     case retrying_request_with_next_api_source(httpMethod: String, path: String, host: String)
     case api_source_healthy_despite_failure(host: String)
     case skipping_malformed_api_source_url(url: String)
+    case api_source_health_known_from_recent_requests(host: String, isHealthy: Bool)
     case api_source_health_check_completed(url: URL, statusCode: Int, isHealthy: Bool)
     case api_source_health_check_failed_to_connect(url: URL, error: Error)
     case failing_url_resolved_to_host(url: URL, resolvedHost: String)
     case blocked_network(url: URL, newHost: String?)
     case api_request_redirect(from: URL, to: URL)
     case operation_state(NetworkOperation.Type, state: String)
+    case operation_latency(NetworkOperation.Type,
+                           priority: RequestPriority,
+                           queueWaitTime: TimeInterval,
+                           duration: TimeInterval)
     case request_handled_by_load_shedder(HTTPRequestPath)
 
     #if DEBUG
@@ -123,6 +130,13 @@ extension NetworkStrings: LogMessage {
         case let .serial_request_paused(httpMethod, path):
             return "Requests are currently paused, queueing \(httpMethod) \(path)"
 
+        case let .concurrent_request_queued(httpMethod, path, queuedRequestsCount):
+            return "All concurrent request slots are busy or paused and \(queuedRequestsCount) requests are " +
+                "waiting, queueing \(httpMethod) \(path)"
+
+        case let .request_waited_in_queue(httpMethod, path, waitTime):
+            return "Request \(httpMethod) \(path) waited \(Int(waitTime * 1000))ms in the queue before starting"
+
         case .starting_next_request(let request):
             return "Starting the next request in the queue, \(request)"
 
@@ -144,6 +158,10 @@ extension NetworkStrings: LogMessage {
         case let .skipping_malformed_api_source_url(url):
             return "Skipping API source with malformed url \(url)"
 
+        case let .api_source_health_known_from_recent_requests(host, isHealthy):
+            return "Recent requests show API source \(host) is \(isHealthy ? "healthy" : "unhealthy"); " +
+            "skipping its health check."
+
         case let .api_source_health_check_completed(url, statusCode, isHealthy):
             return "Health check for \(url.absoluteString) returned \(statusCode) (healthy=\(isHealthy))"
 
@@ -164,6 +182,10 @@ extension NetworkStrings: LogMessage {
         case let .operation_state(operation, state):
             return "\(operation): \(state)"
 
+        case let .operation_latency(operation, priority, queueWaitTime, duration):
+            return "\(operation) (\(priority) priority) waited \(Int(queueWaitTime * 1000))ms " +
+                "and ran for \(Int(duration * 1000))ms"
+
         case let .request_handled_by_load_shedder(path):
             return "Request was handled by load shedder: \(path.relativePath)"
 
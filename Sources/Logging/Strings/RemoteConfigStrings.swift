@@ -10,22 +10,30 @@ import Foundation
 enum RemoteConfigStrings {
 
     case audienceMetadataBeforeDecoding(identifier: String, metadata: String)
+    case blobConcurrencyLimitChanged(Int)
+    case blobDownloadStartedAfterDeadline(String, lateness: TimeInterval)
     case cacheURLNotAvailable
     case checkpointAudiencesNotEvaluated(checkpointID: String, reason: String)
     case checkpointRuleSkipped(reason: String)
     case checkpointWorkflowRuleSkipped(workflowID: String, reason: String)
     case failedToClearBlobStore(Error)
+    case failedToCompactBlobPack(Error)
     case failedToDeleteBlob(String, Error)
     case failedToReadBlob(String, Error)
     case failedToReadCache(Error)
+    case failedToReadContainer(Error)
     case failedToWriteBlob(String, Error)
+    case failedToWriteBlobPackIndex(Error)
     case failedToWriteCache
+    case failedToWriteContainer(Error)
     case exhaustedBlobSources(String)
     case failedToBuildBlobURL(String)
     case failedToDownloadBlob(String, URL, Error)
+    case hedgingBlobDownload(String, URL)
     case duplicateSourceURL(String)
     case failedToParseResponse(Error)
     case malformedBlobRef(String)
+    case migratedBlobsToPack(Int)
     case mergeItemsBlobDataDisabled(topic: RemoteConfigTopic, itemKeys: [String])
     case mergeItemsBlobDataEmpty(topic: RemoteConfigTopic)
     case mergeItemsBlobDataUnavailableItems(topic: RemoteConfigTopic, itemKeys: [String])
@@ -55,6 +63,10 @@ extension RemoteConfigStrings: LogMessage {
         switch self {
         case let .audienceMetadataBeforeDecoding(identifier, metadata):
             return "Raw audience remote config metadata for '\(identifier)' before decoding: \(metadata)"
+        case let .blobConcurrencyLimitChanged(limit):
+            return "Remote config blob download concurrency limit is now \(limit)."
+        case let .blobDownloadStartedAfterDeadline(ref, lateness):
+            return "Remote config blob '\(ref)' started downloading \(lateness) seconds after its deadline."
         case .cacheURLNotAvailable:
             return "Remote config cache URL is not available."
         case let .checkpointAudiencesNotEvaluated(checkpointID, reason):
@@ -65,16 +77,24 @@ extension RemoteConfigStrings: LogMessage {
             return "Skipping checkpoint rule for workflow '\(workflowID)': \(reason)."
         case let .failedToClearBlobStore(error):
             return "Failed to clear remote config blob store: \(error.localizedDescription)"
+        case let .failedToCompactBlobPack(error):
+            return "Failed to compact remote config blob pack: \(error.localizedDescription)"
         case let .failedToDeleteBlob(ref, error):
             return "Failed to delete unreferenced remote config blob '\(ref)': \(error.localizedDescription)"
         case let .failedToReadBlob(ref, error):
             return "Failed to read remote config blob '\(ref)' from disk: \(error.localizedDescription)"
         case let .failedToReadCache(error):
             return "Failed to read remote config cache from disk: \(error.localizedDescription)"
+        case let .failedToReadContainer(error):
+            return "Failed to read remote config response container from disk: \(error.localizedDescription)"
         case let .failedToWriteBlob(ref, error):
             return "Failed to write remote config blob '\(ref)' to disk: \(error.localizedDescription)"
+        case let .failedToWriteBlobPackIndex(error):
+            return "Failed to write remote config blob pack index to disk: \(error.localizedDescription)"
         case .failedToWriteCache:
             return "Failed to write remote config cache to disk."
+        case let .failedToWriteContainer(error):
+            return "Failed to write remote config response container to disk: \(error.localizedDescription)"
         case let .exhaustedBlobSources(ref):
             return "Failed to download remote config blob '\(ref)': all blob sources were exhausted."
         case let .failedToBuildBlobURL(ref):
@@ -82,6 +102,8 @@ extension RemoteConfigStrings: LogMessage {
         case let .failedToDownloadBlob(ref, url, error):
             return "Failed to download remote config blob '\(ref)' from \(url.absoluteString): " +
                 "\(error.localizedDescription)"
+        case let .hedgingBlobDownload(ref, url):
+            return "Remote config blob '\(ref)' is slow to download; also requesting it from \(url)."
         case let .duplicateSourceURL(url):
             return "Found remote config sources sharing the same URL with conflicting priority/weight " +
                 "(\(url)). Keeping the highest-priority one (lowest priority number), tie-broken by weight."
@@ -90,6 +112,8 @@ extension RemoteConfigStrings: LogMessage {
             "\(error.localizedDescription)"
         case let .malformedBlobRef(ref):
             return "Refusing remote config blob operation with malformed ref '\(ref)'."
+        case let .migratedBlobsToPack(count):
+            return "Moved \(count) cached remote config blobs into the blob pack."
         case let .mergeItemsBlobDataDisabled(topic, itemKeys):
             return "Unable to merge remote config blob data for topic '\(topic.wireName)': " +
                 "remote config is disabled. Requested item keys: \(itemKeys.sorted().joined(separator: ", "))."
@@ -94,6 +94,16 @@ internal final class SynchronizedLargeItemCache {
     /// Load a codable value from the cache
     /// - Throws: If the file cannot be loaded or decoded
     func value<T: Decodable>(forKey key: String, decoder: JSONDecoder) throws -> T? {
+        guard let data = try self.data(forKey: key) else {
+            return nil
+        }
+
+        return try decoder.decode(jsonData: data, logErrors: true)
+    }
+
+    /// Load the raw contents stored for `key`
+    /// - Throws: If the file exists but cannot be loaded
+    func data(forKey key: String) throws -> Data? {
         guard let fileURL = self.getFileURL(for: key) else {
             return nil
         }
@@ -103,11 +113,16 @@ internal final class SynchronizedLargeItemCache {
                 return nil
             }
 
-            let data = try cache.loadFile(at: fileURL)
-            return try decoder.decode(jsonData: data, logErrors: true)
+            return try cache.loadFile(at: fileURL)
         }
     }
 
+    /// The file backing `key`, for content that must be written or read without going through this cache,
+    /// such as files that are memory-mapped.
+    func fileURL(forKey key: String) -> URL? {
+        return self.getFileURL(for: key)
+    }
+
     /// Remove a cached item
     func removeObject(forKey key: String) {
         guard let fileURL = self.getFileURL(for: key) else {
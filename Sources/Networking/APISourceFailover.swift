@@ -27,6 +27,10 @@ protocol APISourceFailoverType: AnyObject, Sendable {
 /// request failure was something else, e.g. endpoint-specific), so the original error surfaces
 /// without switching hosts. A source whose health check returns non-2xx or cannot complete is
 /// reported unhealthy and the next one takes over.
+///
+/// When a `healthMonitor` already has a clear verdict on the source from recent real requests, that
+/// verdict is used and the health check is skipped. A degraded source, or one without enough recent
+/// traffic, is still checked actively.
 final class APISourceFailover: APISourceFailoverType {
 
     /// A source handle plus its parsed base URL; only parseable sources are ever handed out.
@@ -53,15 +57,18 @@ final class APISourceFailover: APISourceFailoverType {
     private let usesRemoteConfigAPISources: Bool
     private let sourceProvider: RemoteConfigSourceProviderType
     private let healthChecker: SourceHealthCheckerType
+    private let healthMonitor: SourceHealthMonitorType?
 
     /// - Parameter usesRemoteConfigAPISources: the `usesRemoteConfigAPISources` dangerous setting.
     /// Taken as a plain value because the whole settings chain is immutable per SDK instance.
     init(usesRemoteConfigAPISources: Bool,
          sourceProvider: RemoteConfigSourceProviderType,
-         healthChecker: SourceHealthCheckerType) {
+         healthChecker: SourceHealthCheckerType,
+         healthMonitor: SourceHealthMonitorType? = nil) {
         self.usesRemoteConfigAPISources = usesRemoteConfigAPISources
         self.sourceProvider = sourceProvider
         self.healthChecker = healthChecker
+        self.healthMonitor = healthMonitor
     }
 
     /// The source a request to `path` should target, or `nil` to keep using the path's default host.
@@ -83,17 +90,31 @@ final class APISourceFailover: APISourceFailoverType {
 
     func onRequestFailure(_ source: ResolvedSource,
                           completion: @escaping @Sendable (FailureDecision) -> Void) {
-        self.healthChecker.checkHealth(ofSourceBaseURL: source.url) { isHealthy in
-            if isHealthy {
-                Logger.debug(Strings.network.api_source_healthy_despite_failure(host: source.handle.url))
-                completion(.sourceHealthy)
-                return
+        switch self.healthMonitor?.health(ofHost: source.url.host)?.verdict {
+        case .healthy?:
+            Logger.debug(Strings.network.api_source_health_known_from_recent_requests(host: source.handle.url,
+                                                                                      isHealthy: true))
+            completion(self.decision(afterChecking: source, isHealthy: true))
+        case .unhealthy?:
+            Logger.debug(Strings.network.api_source_health_known_from_recent_requests(host: source.handle.url,
+                                                                                      isHealthy: false))
+            completion(self.decision(afterChecking: source, isHealthy: false))
+        case .degraded?, nil:
+            self.healthChecker.checkHealth(ofSourceBaseURL: source.url) { isHealthy in
+                completion(self.decision(afterChecking: source, isHealthy: isHealthy))
             }
-            self.sourceProvider.reportUnhealthy(source.handle)
-            completion(self.currentResolvedSource().map(FailureDecision.retryNextSource) ?? .sourcesExhausted)
         }
     }
 
+    private func decision(afterChecking source: ResolvedSource, isHealthy: Bool) -> FailureDecision {
+        if isHealthy {
+            Logger.debug(Strings.network.api_source_healthy_despite_failure(host: source.handle.url))
+            return .sourceHealthy
+        }
+        self.sourceProvider.reportUnhealthy(source.handle)
+        return self.currentResolvedSource().map(FailureDecision.retryNextSource) ?? .sourcesExhausted
+    }
+
     /// The provider's current source with its URL parsed. Sources with malformed URLs are reported
     /// unhealthy and skipped, so they participate in failover instead of silently pinning requests to
     /// the default host. The walk ends when the provider runs out of sources.
@@ -41,6 +41,7 @@ class Backend {
         diagnosticsTracker: DiagnosticsTrackerType?,
         apiSourceProvider: RemoteConfigSourceProviderType?,
         timeoutManager: HTTPRequestTimeoutManagerType,
+        sourceHealthMonitor: SourceHealthMonitorType? = nil,
         dateProvider: DateProvider = DateProvider()
     ) {
         // One `apiSourceFailover` for both HTTPClients, so they walk one source list and one
@@ -49,7 +50,8 @@ class Backend {
             APISourceFailover(usesRemoteConfigAPISources:
                                 systemInfo.dangerousSettings.internalSettings.usesRemoteConfigAPISources,
                               sourceProvider: $0,
-                              healthChecker: SourceHealthChecker())
+                              healthChecker: SourceHealthChecker(),
+                              healthMonitor: sourceHealthMonitor)
         }
         // `timeoutManager` is shared by both HTTPClients (and, outside of `Backend`, by the blob
         // downloader) so a timeout one of them sees on a host fast-fails the others' next request to that
@@ -62,7 +64,9 @@ class Backend {
                                     networkTimeout: httpClientTimeout,
                                     operationDispatcher: OperationDispatcher.default,
                                     apiSourceFailover: apiSourceFailover,
-                                    timeoutManager: timeoutManager)
+                                    timeoutManager: timeoutManager,
+                                    sourceHealthMonitor: sourceHealthMonitor,
+                                    concurrentRequestLimit: HTTPClient.defaultConcurrentRequestLimit)
         let config = BackendConfiguration(httpClient: httpClient,
                                           operationDispatcher: operationDispatcher,
                                           operationQueue: QueueProvider.createBackendQueue(),
@@ -77,7 +81,8 @@ class Backend {
                                                diagnosticsTracker: diagnosticsTracker,
                                                networkTimeout: httpClientTimeout,
                                                apiSourceFailover: apiSourceFailover,
-                                               timeoutManager: timeoutManager),
+                                               timeoutManager: timeoutManager,
+                                               sourceHealthMonitor: sourceHealthMonitor),
             operationDispatcher: operationDispatcher,
             operationQueue: QueueProvider.createRemoteConfigQueue(),
             diagnosticsQueue: QueueProvider.createDiagnosticsQueue(),
@@ -324,7 +329,8 @@ private extension HTTPClient {
         diagnosticsTracker: DiagnosticsTrackerType?,
         networkTimeout: NetworkTimeout,
         apiSourceFailover: APISourceFailoverType?,
-        timeoutManager: HTTPRequestTimeoutManagerType
+        timeoutManager: HTTPRequestTimeoutManagerType,
+        sourceHealthMonitor: SourceHealthMonitorType?
     ) -> HTTPClient {
         HTTPClient(systemInfo: systemInfo,
                    eTagManager: eTagManager,
@@ -334,7 +340,8 @@ private extension HTTPClient {
                    networkTimeout: networkTimeout,
                    operationDispatcher: OperationDispatcher.default,
                    apiSourceFailover: apiSourceFailover,
-                   timeoutManager: timeoutManager)
+                   timeoutManager: timeoutManager,
+                   sourceHealthMonitor: sourceHealthMonitor)
     }
 
 }
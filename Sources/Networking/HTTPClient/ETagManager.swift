@@ -22,11 +22,25 @@ class ETagManager {
     private let cache: SynchronizedLargeItemCache
     private static let fileManager = FileManager.default
 
+    /// What `eTagHeader(for:withSignatureVerification:refreshETag:)` needs to know about every stored response,
+    /// so it doesn't have to read any of them from disk. `nil` until first used.
+    private let index: Atomic<Index?> = nil
+    /// Serializes writes of the index file, so the last one always has the latest entries.
+    private let indexPersistenceLock = Lock(.nonRecursive)
+    /// Whether an index write is already scheduled, so changes made until it runs share it.
+    private let isIndexWriteScheduled: Atomic<Bool> = false
+    private let indexWriteQueue = DispatchQueue(label: "com.revenuecat.etag_index", qos: .utility)
+    private let indexWriteDelay: DispatchTimeInterval
+    /// Once stored responses take more bytes than this, the least recently used ones are evicted.
+    private let byteBudget: Int
+
     init() {
         self.cache = .init(
             cache: Self.fileManager,
             basePath: Self.cacheBasePath
         )
+        self.byteBudget = Self.defaultByteBudget
+        self.indexWriteDelay = Self.defaultIndexWriteDelay
 
         // Perform one-time cleanup if needed
         self.deleteOldDirectoryInDocumentsIfNeeded()
@@ -34,8 +48,14 @@ class ETagManager {
 
     #if DEBUG
     /// Only used in testing. In any other case the init above should be used
-    init(largeItemCache: SynchronizedLargeItemCache) {
+    init(
+        largeItemCache: SynchronizedLargeItemCache,
+        byteBudget: Int = ETagManager.defaultByteBudget,
+        indexWriteDelay: DispatchTimeInterval = ETagManager.defaultIndexWriteDelay
+    ) {
         self.cache = largeItemCache
+        self.byteBudget = byteBudget
+        self.indexWriteDelay = indexWriteDelay
     }
     #endif
 
@@ -47,23 +67,23 @@ class ETagManager {
     ) -> [String: String] {
         func eTag() -> (tag: String, date: String?)? {
             if refreshETag { return nil }
-            guard let storedETagAndResponse = self.storedETagAndResponse(for: urlRequest) else {
+            guard let entry = self.indexEntry(for: urlRequest) else {
                 Logger.verbose(Strings.etag.found_no_etag(urlRequest))
                 return nil
             }
 
-            if self.shouldUseETag(storedETagAndResponse,
+            if self.shouldUseETag(entry.verificationResult,
                                   withSignatureVerification: withSignatureVerification) {
                 Logger.verbose(Strings.etag.using_etag(urlRequest,
-                                                       storedETagAndResponse.eTag,
-                                                       storedETagAndResponse.validationTime))
+                                                       entry.eTag,
+                                                       entry.validationTime))
 
-                return (tag: storedETagAndResponse.eTag,
-                        date: storedETagAndResponse.validationTime?.millisecondsSince1970.description)
+                return (tag: entry.eTag,
+                        date: entry.validationTime?.millisecondsSince1970.description)
             } else {
                 Logger.verbose(Strings.etag.not_using_etag(
                     urlRequest,
-                    storedETagAndResponse.verificationResult,
+                    entry.verificationResult,
                     needsSignatureVerification: withSignatureVerification
 
                 ))
@@ -97,7 +117,7 @@ class ETagManager {
             if let storedResponse = self.storedETagAndResponse(for: request) {
                 let newResponse = storedResponse.withUpdatedValidationTime()
 
-                self.storeIfPossible(newResponse, for: request)
+                self.updateIndex(with: newResponse, for: request)
                 return newResponse.asResponse(withRequestDate: response.requestDate,
                                               headers: response.responseHeaders,
                                               responseVerificationResult: response.verificationResult)
@@ -126,7 +146,10 @@ class ETagManager {
     func clearCaches() {
         Logger.debug(Strings.etag.clearing_cache)
 
-        self.cache.clear()
+        self.indexPersistenceLock.perform {
+            self.cache.clear()
+            self.index.value = Index(entries: [:])
+        }
     }
 
 }
@@ -146,6 +169,41 @@ extension ETagManager {
     static var cacheBasePath: String {
         return "etags"
     }
+
+    /// Stored next to the responses, whose keys are MD5 hex strings and can't collide with it.
+    static let indexCacheKey = "index"
+
+    static let defaultByteBudget = 4 * 1024 * 1024
+
+    /// How long index changes wait before being written, so a burst of responses leads to a single write.
+    static let defaultIndexWriteDelay: DispatchTimeInterval = .seconds(1)
+
+    /// Bodies smaller than this are stored as they are: compressing them saves too little to be worth it.
+    static let compressionThreshold = 4 * 1024
+
+    /// The part of a stored `Response` needed to decide whether to send its ETag.
+    struct IndexEntry: Codable, Equatable {
+
+        var eTag: String
+        var validationTime: Date?
+        var verificationResult: VerificationResult
+
+        /// The size of the stored response on disk, `0` if unknown.
+        @DefaultDecodable.Zero
+        var byteCount: Int
+        /// The `Index` clock when the entry was last used, to evict the least recently used ones first.
+        @DefaultDecodable.Zero
+        var lastUse: Int
+
+        init(_ response: Response, byteCount: Int = 0) {
+            self.eTag = response.eTag
+            self.validationTime = response.validationTime
+            self.verificationResult = response.verificationResult
+            self.byteCount = byteCount
+        }
+
+    }
+
 }
 
 // MARK: - Private
@@ -156,8 +214,8 @@ private extension ETagManager {
         responseCode == .notModified
     }
 
-    func shouldUseETag(_ response: Response, withSignatureVerification: Bool) -> Bool {
-        switch response.verificationResult {
+    func shouldUseETag(_ verificationResult: VerificationResult, withSignatureVerification: Bool) -> Bool {
+        switch verificationResult {
         case .verified: return true
         case .notRequested: return !withSignatureVerification
         // This is theoretically impossible since we won't store these responses anyway.
@@ -166,10 +224,17 @@ private extension ETagManager {
     }
 
     func storedETagAndResponse(for request: URLRequest) -> Response? {
-        if let cacheKey = Self.cacheKey(for: request) {
-            return try? self.cache.value(forKey: cacheKey, decoder: .default)
+        guard let cacheKey = Self.cacheKey(for: request),
+              let response: Response = try? self.cache.value(forKey: cacheKey, decoder: .default) else {
+            return nil
+        }
+
+        do {
+            return try response.decompressed()
+        } catch {
+            Logger.error(Strings.etag.failed_to_decompress_response(request, error))
+            return nil
         }
-        return nil
     }
 
     func storeStatusCodeAndResponseIfNoError(for request: URLRequest,
@@ -197,10 +262,104 @@ private extension ETagManager {
     }
 
     func storeIfPossible(_ response: Response, for request: URLRequest) {
+        guard let cacheKey = Self.cacheKey(for: request) else { return }
+
+        Logger.verbose(Strings.etag.storing_response(request, response))
+
+        guard let data = try? JSONEncoder.default.encode(value: response.compressedForStorage(), logErrors: true),
+              self.cache.set(data: data, forKey: cacheKey) else {
+            return
+        }
+
+        self.updateIndex(with: response, forKey: cacheKey, byteCount: data.count)
+    }
+
+    func indexEntry(for request: URLRequest) -> IndexEntry? {
+        guard let cacheKey = Self.cacheKey(for: request) else { return nil }
+
+        return self.index.modify { index in
+            var loaded = index ?? self.loadIndex()
+            defer { index = loaded }
+
+            return loaded.entries[cacheKey] != nil ? loaded.markUsed(cacheKey) : nil
+        }
+    }
+
+    func updateIndex(with response: Response, for request: URLRequest) {
         if let cacheKey = Self.cacheKey(for: request) {
-            Logger.verbose(Strings.etag.storing_response(request, response))
+            self.updateIndex(with: response, forKey: cacheKey)
+        }
+    }
+
+    /// - Parameter byteCount: the size of the stored response, `nil` if it wasn't written again.
+    func updateIndex(with response: Response, forKey cacheKey: String, byteCount: Int? = nil) {
+        let evictedKeys: [String] = self.index.modify { index in
+            var loaded = index ?? self.loadIndex()
+            defer { index = loaded }
+
+            loaded.entries[cacheKey] = IndexEntry(
+                response,
+                byteCount: byteCount ?? loaded.entries[cacheKey]?.byteCount ?? 0
+            )
+            loaded.markUsed(cacheKey)
+
+            return loaded.evictLeastRecentlyUsed(keeping: cacheKey, byteBudget: self.byteBudget)
+        }
+
+        self.removeEvictedResponses(evictedKeys)
+        self.scheduleIndexWrite()
+    }
+
+    /// Loads the index file and adds the stored responses it's missing.
+    ///
+    /// Responses are missing from it when they were stored before the index existed, or before a write
+    /// that didn't happen because the app was terminated. Each of them is read once to be added to the index,
+    /// or deleted if it can't be decoded, so it counts against `byteBudget` like any other.
+    func loadIndex() -> Index {
+        let entries: [String: IndexEntry]? = try? self.cache.value(forKey: Self.indexCacheKey, decoder: .default)
+        var index = Index(entries: entries ?? [:])
+
+        let missingKeys = self.cache.allKeys().filter { $0 != Self.indexCacheKey && index.entries[$0] == nil }
+        guard !missingKeys.isEmpty else { return index }
+
+        Logger.debug(Strings.etag.indexing_stored_responses(count: missingKeys.count))
+
+        for key in missingKeys {
+            if let data = try? self.cache.data(forKey: key),
+               let response: Response = try? JSONDecoder.default.decode(jsonData: data) {
+                // Never used since launch, so these are the first to be evicted.
+                index.entries[key] = IndexEntry(response, byteCount: data.count)
+            } else {
+                self.cache.removeObject(forKey: key)
+            }
+        }
+
+        self.removeEvictedResponses(index.evictLeastRecentlyUsed(keeping: nil, byteBudget: self.byteBudget))
+        self.scheduleIndexWrite()
+
+        return index
+    }
+
+    func removeEvictedResponses(_ evictedKeys: [String]) {
+        guard !evictedKeys.isEmpty else { return }
+
+        Logger.debug(Strings.etag.evicting_responses(count: evictedKeys.count, byteBudget: self.byteBudget))
+        evictedKeys.forEach(self.cache.removeObject(forKey:))
+    }
+
+    /// Writes the index file off the response path, once for every change made within `indexWriteDelay`.
+    func scheduleIndexWrite() {
+        guard !self.isIndexWriteScheduled.getAndSet(true) else { return }
+
+        self.indexWriteQueue.asyncAfter(deadline: .now() + self.indexWriteDelay) { [weak self] in
+            guard let self else { return }
 
-            self.cache.set(codable: response, forKey: cacheKey)
+            self.indexPersistenceLock.perform {
+                self.isIndexWriteScheduled.value = false
+                guard let entries = self.index.value?.entries else { return }
+
+                self.cache.set(codable: entries, forKey: Self.indexCacheKey)
+            }
         }
     }
 
@@ -240,6 +399,48 @@ extension ETagManager: @unchecked Sendable {}
 
 extension ETagManager {
 
+    fileprivate struct Index {
+
+        var entries: [String: IndexEntry]
+
+        /// Incremented every time an entry is used.
+        private var clock: Int
+
+        init(entries: [String: IndexEntry]) {
+            self.entries = entries
+            self.clock = entries.values.map(\.lastUse).max() ?? 0
+        }
+
+        @discardableResult
+        mutating func markUsed(_ key: String) -> IndexEntry? {
+            self.clock += 1
+            self.entries[key]?.lastUse = self.clock
+
+            return self.entries[key]
+        }
+
+        /// Removes the least recently used entries other than `key` until the stored responses fit in
+        /// `byteBudget`.
+        /// - Returns: the keys of the removed entries, whose responses must be deleted.
+        mutating func evictLeastRecentlyUsed(keeping key: String?, byteBudget: Int) -> [String] {
+            var byteCount = self.entries.values.reduce(0) { $0 + $1.byteCount }
+            guard byteCount > byteBudget else { return [] }
+
+            var evictedKeys: [String] = []
+            for (candidate, entry) in self.entries.sorted(by: { $0.value.lastUse < $1.value.lastUse })
+            where candidate != key {
+                guard byteCount > byteBudget else { break }
+
+                self.entries.removeValue(forKey: candidate)
+                byteCount -= entry.byteCount
+                evictedKeys.append(candidate)
+            }
+
+            return evictedKeys
+        }
+
+    }
+
     struct Response {
 
         var eTag: String
@@ -255,6 +456,9 @@ extension ETagManager {
         var isLoadShedderResponse: Bool
         @DefaultDecodable.False
         var isFallbackUrlResponse: Bool
+        /// How `data` is compressed. Only ever set on disk: `ETagManager` decompresses responses when loading them.
+        @DefaultValue<BodyCompression>
+        var bodyCompression: BodyCompression
 
         init(
             eTag: String,
@@ -263,7 +467,8 @@ extension ETagManager {
             validationTime: Date? = nil,
             verificationResult: VerificationResult,
             isLoadShedderResponse: Bool,
-            isFallbackUrlResponse: Bool
+            isFallbackUrlResponse: Bool,
+            bodyCompression: BodyCompression = .uncompressed
         ) {
             self.eTag = eTag
             self.statusCode = statusCode
@@ -272,10 +477,20 @@ extension ETagManager {
             self.verificationResult = verificationResult
             self.isLoadShedderResponse = isLoadShedderResponse
             self.isFallbackUrlResponse = isFallbackUrlResponse
+            self.bodyCompression = bodyCompression
         }
 
     }
 
+    enum BodyCompression: String, Codable, DefaultValueProvider {
+
+        case uncompressed
+        case lzfse
+
+        static let defaultValue: Self = .uncompressed
+
+    }
+
 }
 
 extension ETagManager.Response: Codable {}
@@ -304,6 +519,36 @@ extension ETagManager.Response {
                   isFallbackUrlResponse: self.isFallbackUrlResponse)
     }
 
+    /// A copy to write to disk, with `data` compressed if it's large enough for that to pay off.
+    fileprivate func compressedForStorage() -> Self {
+        guard self.bodyCompression == .uncompressed,
+              self.data.count >= ETagManager.compressionThreshold,
+              let compressed = try? (self.data as NSData).compressed(using: .lzfse) as Data,
+              compressed.count < self.data.count else {
+            return self
+        }
+
+        var copy = self
+        copy.data = compressed
+        copy.bodyCompression = .lzfse
+
+        return copy
+    }
+
+    /// A copy with `data` as received from the backend.
+    fileprivate func decompressed() throws -> Self {
+        switch self.bodyCompression {
+        case .uncompressed:
+            return self
+        case .lzfse:
+            var copy = self
+            copy.data = try (self.data as NSData).decompressed(using: .lzfse) as Data
+            copy.bodyCompression = .uncompressed
+
+            return copy
+        }
+    }
+
     fileprivate func withUpdatedValidationTime() -> Self {
         var copy = self
         copy.validationTime = Date()
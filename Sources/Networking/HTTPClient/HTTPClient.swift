@@ -37,6 +37,22 @@ class HTTPClient {
     private let operationDispatcher: OperationDispatcher
     let requestTimeoutManager: HTTPRequestTimeoutManagerType
     private let apiSourceFailover: APISourceFailoverType?
+    private let sourceHealthMonitor: SourceHealthMonitorType?
+
+    /// How many requests to paths that allow concurrent requests may run alongside the serial queue.
+    /// `0` runs every request through the serial queue.
+    let concurrentRequestLimit: Int
+
+    /// Latency of the `NetworkOperation`s performing requests through this client, by priority.
+    let priorityMetrics = RequestPriorityMetrics()
+
+    let signatureVerificationMetrics = SignatureVerificationMetrics()
+
+    /// Where responses are parsed and their signatures verified, so the `URLSession` delegate queue is
+    /// free to deliver the next response and concurrent requests are verified in parallel.
+    private let responseQueue = DispatchQueue(label: "com.revenuecat.HTTPClient.responses",
+                                              qos: .userInitiated,
+                                              attributes: .concurrent)
 
     private let retryBackoffIntervals: [TimeInterval] = [
         TimeInterval(0),
@@ -48,6 +64,10 @@ class HTTPClient {
     /// re-armed (topic rebuild or interval restart) while a request is walking it.
     private static let maxAPISourceAttempts = 5
 
+    /// The `concurrentRequestLimit` used by `Backend`: enough to fetch offerings, product entitlement mapping
+    /// and remote config at launch without waiting behind customer info.
+    static let defaultConcurrentRequestLimit = 3
+
     init(systemInfo: SystemInfo,
          eTagManager: ETagManager,
          tokenManager: TokenManager,
@@ -59,10 +79,14 @@ class HTTPClient {
          dateProvider: DateProvider = DateProvider(),
          operationDispatcher: OperationDispatcher,
          apiSourceFailover: APISourceFailoverType?,
-         timeoutManager: HTTPRequestTimeoutManagerType
+         timeoutManager: HTTPRequestTimeoutManagerType,
+         sourceHealthMonitor: SourceHealthMonitorType? = nil,
+         concurrentRequestLimit: Int = 0
     ) {
+        let concurrentRequestLimit = max(concurrentRequestLimit, 0)
         let config = URLSessionConfiguration.ephemeral
-        config.httpMaximumConnectionsPerHost = 1
+        // One connection for the serial queue plus one per concurrent request slot.
+        config.httpMaximumConnectionsPerHost = 1 + concurrentRequestLimit
         config.timeoutIntervalForRequest = networkTimeout.timeoutInterval
         config.timeoutIntervalForResource = networkTimeout.timeoutInterval
         config.urlCache = nil // We implement our own caching with `ETagManager`.
@@ -82,6 +106,8 @@ class HTTPClient {
         self.operationDispatcher = operationDispatcher
         self.apiSourceFailover = apiSourceFailover
         self.requestTimeoutManager = timeoutManager
+        self.sourceHealthMonitor = sourceHealthMonitor
+        self.concurrentRequestLimit = concurrentRequestLimit
     }
 
     /// - Parameter verificationMode: if `nil`, this will default to `SystemInfo.responseVerificationMode`
@@ -209,6 +235,7 @@ extension HTTPClient {
         case headerParametersForSignature = "X-Headers-Hash"
         case sandbox = "X-Is-Sandbox"
         case retryCount = "X-Retry-Count"
+        case range = "Range"
 
     }
 
@@ -224,6 +251,7 @@ extension HTTPClient {
         case amazonTraceID = "X-Amzn-Trace-ID"
         case retryAfter = "Retry-After"
         case isRetryable = "Is-Retryable"
+        case contentRange = "Content-Range"
 
     }
 
@@ -267,7 +295,77 @@ internal extension HTTPClient {
         var queuedRequests: [Request]
         var currentSerialRequest: Request?
 
+        /// Requests that run alongside the serial queue, waiting for a free slot.
+        var queuedConcurrentRequests: [Request] = []
+        var concurrentRequestsInFlight = 0
+
+        var serialQueueMetrics: QueueMetrics = .init()
+        var concurrentQueueMetrics: QueueMetrics = .init()
+
         static let initial: Self = .init(paused: false, queuedRequests: [], currentSerialRequest: nil)
+
+        /// Puts `request`, a retry or follow-up of a request that just ran, at the front of its queue.
+        mutating func requeue(_ request: Request) {
+            if request.runsConcurrently {
+                self.queuedConcurrentRequests.insert(request, at: 0)
+            } else {
+                self.queuedRequests.insert(request, at: 0)
+            }
+        }
+
+        mutating func enqueue(_ request: Request) {
+            if request.runsConcurrently {
+                self.queuedConcurrentRequests.append(request)
+                self.concurrentQueueMetrics.recordDepth(self.queuedConcurrentRequests.count)
+            } else {
+                self.queuedRequests.append(request)
+                self.serialQueueMetrics.recordDepth(self.queuedRequests.count)
+            }
+        }
+
+        /// Takes as many queued concurrent requests as there are free slots, marking them in flight.
+        mutating func popStartableConcurrentRequests(limit: Int, now: Date) -> [Request] {
+            guard !self.paused else { return [] }
+
+            var requests: [Request] = []
+            while self.concurrentRequestsInFlight < limit, var request = self.queuedConcurrentRequests.popFirst() {
+                self.concurrentRequestsInFlight += 1
+                request.recordQueueWait(now: now, in: &self.concurrentQueueMetrics)
+                requests.append(request)
+            }
+            return requests
+        }
+    }
+
+    /// How long requests have waited in each queue so far.
+    /// These are kept in memory only; each request's wait is also logged when it starts.
+    var queueMetrics: (serial: QueueMetrics, concurrent: QueueMetrics) {
+        let state = self.state.value
+        return (state.serialQueueMetrics, state.concurrentQueueMetrics)
+    }
+
+    /// How long requests wait in one of `HTTPClient`'s queues before starting.
+    struct QueueMetrics: Equatable {
+
+        private(set) var peakDepth = 0
+        private(set) var startedCount = 0
+        private(set) var totalWaitTime: TimeInterval = 0
+        private(set) var longestWaitTime: TimeInterval = 0
+
+        var averageWaitTime: TimeInterval {
+            return self.startedCount > 0 ? self.totalWaitTime / Double(self.startedCount) : 0
+        }
+
+        mutating func recordDepth(_ depth: Int) {
+            self.peakDepth = max(self.peakDepth, depth)
+        }
+
+        mutating func recordWait(_ waitTime: TimeInterval) {
+            self.startedCount += 1
+            self.totalWaitTime += waitTime
+            self.longestWaitTime = max(self.longestWaitTime, waitTime)
+        }
+
     }
 
     /// The API-source resolution state of a request, modeled as one value so an inconsistent
@@ -325,6 +423,25 @@ internal extension HTTPClient {
         /// retries of any kind (ETag refresh, status-code backoff) keep targeting the same host.
         private(set) var apiSourceState: APISourceState = .unresolved
 
+        /// Whether the request runs alongside the serial queue. Decided once per logical request, so its
+        /// retries stay in the same queue.
+        var runsConcurrently = false
+
+        /// When the request was queued behind other requests, or `nil` if it started right away.
+        var queuedAt: Date?
+
+        /// Records how long the request waited since it was queued, once.
+        mutating func recordQueueWait(now: Date, in metrics: inout QueueMetrics) {
+            guard let queuedAt = self.queuedAt else { return }
+
+            let waitTime = now.timeIntervalSince(queuedAt)
+            metrics.recordWait(waitTime)
+            self.queuedAt = nil
+            Logger.verbose(Strings.network.request_waited_in_queue(httpMethod: self.method.httpMethod,
+                                                                   path: self.path,
+                                                                   waitTime: waitTime))
+        }
+
         init<Value: HTTPResponseBody>(httpRequest: HTTPRequest,
                                       authHeaders: HTTPClient.RequestHeaders,
                                       defaultHeaders: HTTPClient.RequestHeaders,
@@ -435,20 +552,30 @@ private extension HTTPClient {
                                                           originalCode: BackendErrorCode.unknownBackendError.rawValue)
 
     func perform(request: Request) {
+        var request = request
+
         if !request.retried {
+            request.runsConcurrently = self.concurrentRequestLimit > 0
+                && request.httpRequest.path.allowsConcurrentRequests
+            request.queuedAt = self.dateProvider.now()
+
             let requestEnqueued: Bool = self.state.modify {
-                if $0.currentSerialRequest != nil {
+                if request.runsConcurrently {
+                    return Self.enqueueConcurrentRequestIfNeeded(request,
+                                                                 state: &$0,
+                                                                 limit: self.concurrentRequestLimit)
+                } else if $0.currentSerialRequest != nil {
                     Logger.debug(Strings.network.serial_request_queued(httpMethod: request.method.httpMethod,
                                                                        path: request.path,
                                                                        queuedRequestsCount: $0.queuedRequests.count))
 
-                    $0.queuedRequests.append(request)
+                    $0.enqueue(request)
                     return true
                 } else if $0.paused == true {
                     Logger.debug(Strings.network.serial_request_paused(httpMethod: request.method.httpMethod,
                                                                        path: request.path))
 
-                    $0.queuedRequests.append(request)
+                    $0.enqueue(request)
                     return true
                 } else {
                     Logger.debug(Strings.network.starting_request(httpMethod: request.method.httpMethod,
@@ -459,11 +586,30 @@ private extension HTTPClient {
             }
 
             guard !requestEnqueued else { return }
+            request.queuedAt = nil
         }
 
         self.start(request: request)
     }
 
+    /// Queues `request` unless a concurrent slot is free, in which case the slot is taken. Returns whether the
+    /// request was queued.
+    private static func enqueueConcurrentRequestIfNeeded(_ request: Request, state: inout State, limit: Int) -> Bool {
+        guard !state.paused, state.concurrentRequestsInFlight < limit else {
+            Logger.debug(Strings.network.concurrent_request_queued(
+                httpMethod: request.method.httpMethod,
+                path: request.path,
+                queuedRequestsCount: state.queuedConcurrentRequests.count
+            ))
+            state.enqueue(request)
+            return true
+        }
+
+        Logger.debug(Strings.network.starting_request(httpMethod: request.method.httpMethod, path: request.path))
+        state.concurrentRequestsInFlight += 1
+        return false
+    }
+
     /// - Returns: `nil` if the request must be retried
     // swiftlint:disable:next function_parameter_count
     func parse(urlResponse: URLResponse?,
@@ -529,7 +675,8 @@ private extension HTTPClient {
                     )
                 }
                 #endif
-                return cachedResponse.verify(
+                let verificationStartTime = self.dateProvider.now()
+                let verifiedResponse = cachedResponse.verify(
                     signing: self.signing(for: request.httpRequest),
                     request: request.httpRequest,
                     requestHeaders: requestHeaders,
@@ -538,6 +685,12 @@ private extension HTTPClient {
                     isFallbackUrlResponse: isFallbackUrlResponse,
                     iamEnabled: request.preferIAMPath
                 )
+                self.signatureVerificationMetrics.record(
+                    verifiedResponse.verificationResult,
+                    duration: self.dateProvider.now().timeIntervalSince(verificationStartTime)
+                )
+
+                return verifiedResponse
             }
             // Fetch from ETagManager if available
             .map { (response) -> VerifiedHTTPResponse<Data>? in
@@ -589,6 +742,13 @@ private extension HTTPClient {
                                   error: networkError,
                                   requestStartTime: requestStartTime)
 
+        if let response {
+            self.recordSourceHealth(response,
+                                    networkError: networkError,
+                                    host: urlRequest.url?.host,
+                                    requestStartTime: requestStartTime)
+        }
+
         var requestTimeoutResult: HTTPRequestTimeoutManager.RequestResult = .other
 
         // The requestTimeoutManager tracks how fast a host answers, so a non-error response clears the
@@ -699,7 +859,7 @@ private extension HTTPClient {
             Logger.debug(Strings.network.retrying_request(httpMethod: request.method.httpMethod, path: request.path))
 
             self.state.modify {
-                $0.queuedRequests.insert(request.retriedRequest(), at: 0)
+                $0.requeue(request.retriedRequest())
             }
 
             self.finish(request: request,
@@ -726,7 +886,7 @@ private extension HTTPClient {
                 host: nextSource.handle.url
             ))
             self.state.modify {
-                $0.queuedRequests.insert(request.requestWith(nextAPISource: nextSource), at: 0)
+                $0.requeue(request.requestWith(nextAPISource: nextSource))
             }
             return true
 
@@ -756,30 +916,81 @@ private extension HTTPClient {
             self.requestTimeoutManager.recordRequestResult(host: urlRequest.url?.host, requestTimeoutResult)
         }
 
+        if case .successOnMainBackend = requestTimeoutResult {
+            self.requestTimeoutManager.recordLatency(self.dateProvider.now().timeIntervalSince(requestStartTime),
+                                                     host: urlRequest.url?.host,
+                                                     endpoint: request.httpRequest.path.name)
+        }
+
         self.trackHttpRequestPerformedIfNeeded(request: request,
                                                host: urlRequest.url?.host,
                                                requestStartTime: requestStartTime,
                                                result: response)
 
-        self.beginNextRequest()
+        if request.runsConcurrently {
+            self.finishConcurrentRequest()
+        } else {
+            self.beginNextRequest()
+        }
     }
 
     func beginNextRequest() {
-        let nextRequest: Request? = self.state.modify {
-            if $0.paused == true { return nil }
+        let now = self.dateProvider.now()
+        let (nextRequest, concurrentRequests): (Request?, [Request]) = self.state.modify {
+            if $0.paused == true { return (nil, []) }
 
             Logger.debug(Strings.network.serial_request_done(httpMethod: $0.currentSerialRequest?.method.httpMethod,
                                                              path: $0.currentSerialRequest?.path,
                                                              queuedRequestsCount: $0.queuedRequests.count))
             $0.currentSerialRequest = $0.queuedRequests.popFirst()
+            $0.currentSerialRequest?.recordQueueWait(now: now, in: &$0.serialQueueMetrics)
 
-            return $0.currentSerialRequest
+            return ($0.currentSerialRequest,
+                    $0.popStartableConcurrentRequests(limit: self.concurrentRequestLimit, now: now))
         }
 
         if let nextRequest = nextRequest {
             Logger.debug(Strings.network.starting_next_request(request: nextRequest.description))
             self.start(request: nextRequest)
         }
+        self.start(concurrentRequests: concurrentRequests)
+    }
+
+    /// Frees the slot of a concurrent request that is done and starts whatever can run now.
+    private func finishConcurrentRequest() {
+        self.state.modify { $0.concurrentRequestsInFlight = max($0.concurrentRequestsInFlight - 1, 0) }
+        self.startQueuedConcurrentRequests()
+    }
+
+    /// Starts queued concurrent requests while there are free slots. A concurrent request can also queue serial
+    /// work (e.g. a token refresh), which is started if the serial queue is idle.
+    private func startQueuedConcurrentRequests() {
+        let now = self.dateProvider.now()
+        let (serialRequest, concurrentRequests): (Request?, [Request]) = self.state.modify {
+            if $0.paused == true { return (nil, []) }
+
+            var serialRequest: Request?
+            if $0.currentSerialRequest == nil {
+                $0.currentSerialRequest = $0.queuedRequests.popFirst()
+                $0.currentSerialRequest?.recordQueueWait(now: now, in: &$0.serialQueueMetrics)
+                serialRequest = $0.currentSerialRequest
+            }
+
+            return (serialRequest, $0.popStartableConcurrentRequests(limit: self.concurrentRequestLimit, now: now))
+        }
+
+        if let serialRequest {
+            Logger.debug(Strings.network.starting_next_request(request: serialRequest.description))
+            self.start(request: serialRequest)
+        }
+        self.start(concurrentRequests: concurrentRequests)
+    }
+
+    private func start(concurrentRequests: [Request]) {
+        for request in concurrentRequests {
+            Logger.debug(Strings.network.starting_next_request(request: request.description))
+            self.start(request: request)
+        }
     }
 
     func start(request: Request) {
@@ -793,6 +1004,9 @@ private extension HTTPClient {
 
             Logger.error(error.description)
             request.completionHandler?(.failure(error))
+            if request.runsConcurrently {
+                self.finishConcurrentRequest()
+            }
             return
         }
 
@@ -822,6 +1036,7 @@ private extension HTTPClient {
 
         finalURLRequest.timeoutInterval = requestTimeoutManager.timeout(
             host: finalURLRequest.url?.host,
+            endpoint: request.httpRequest.path.name,
             isFallbackHostRequest: request.targetsFallbackHost,
             endpointSupportsFallbackURLs: request.httpRequest.path.supportsFallbackURLs,
             isProxied: SystemInfo.proxyURL != nil,
@@ -832,13 +1047,16 @@ private extension HTTPClient {
 
         // swiftlint:disable:next redundant_void_return
         let task = self.session.dataTask(with: finalURLRequest) { (data, urlResponse, error) -> Void in
-            self.handle(urlResponse: urlResponse,
-                        request: request,
-                        urlRequest: urlRequest,
-                        data: data,
-                        error: error,
-                        requestStartTime: requestStartTime)
+            self.responseQueue.async {
+                self.handle(urlResponse: urlResponse,
+                            request: request,
+                            urlRequest: urlRequest,
+                            data: data,
+                            error: error,
+                            requestStartTime: requestStartTime)
+            }
         }
+        task.priority = request.httpRequest.path.priority.taskPriority
         task.resume()
     }
 
@@ -975,6 +1193,31 @@ private extension HTTPClient {
             }
         }
     }
+
+    /// Feeds the outcome of a real request into the passive source health monitor. Any answer from the host,
+    /// including a 4xx, counts as a success; device-connectivity failures say nothing about the host and are
+    /// not recorded.
+    private func recordSourceHealth(_ result: VerifiedHTTPResponse<Data>.Result,
+                                    networkError: Error?,
+                                    host: String?,
+                                    requestStartTime: Date) {
+        guard let monitor = self.sourceHealthMonitor else { return }
+
+        let latency = self.dateProvider.now().timeIntervalSince(requestStartTime)
+
+        switch result {
+        case .success:
+            monitor.record(.success(latency: latency), host: host)
+        case let .failure(error):
+            if networkError?.isURLRequestTimeout == true {
+                monitor.record(.timeout, host: host)
+            } else if error.isAllowedToRetryWithFallbackHost {
+                monitor.record(.failure, host: host)
+            } else if !error.isDeviceConnectivityError {
+                monitor.record(.success(latency: latency), host: host)
+            }
+        }
+    }
 }
 
 // MARK: - Request Reauthorize Logic
@@ -1010,7 +1253,7 @@ extension HTTPClient {
             })
 
             self.state.modify {
-                $0.queuedRequests.insert(clientRequest, at: 0)
+                $0.requeue(clientRequest)
             }
             return true
         case .waitingForOtherRequest:
@@ -1033,7 +1276,7 @@ extension HTTPClient {
             needsToRestart = self.state.modify {
                 let shouldRestart = ($0.paused == true)
                 $0.paused = false
-                $0.queuedRequests.insert(retried, at: 0)
+                $0.requeue(retried)
                 return shouldRestart
             }
         } else {
@@ -1087,7 +1330,7 @@ extension HTTPClient {
             path: nextRequest.path
         ))
         self.state.modify {
-            $0.queuedRequests.insert(nextRequest, at: 0)
+            $0.requeue(nextRequest)
         }
         return true
     }
@@ -1141,9 +1384,13 @@ extension HTTPClient {
         self.operationDispatcher.dispatchOnWorkerThread(after: retryBackoffInterval) {
             let retriedRequest = request.retriedRequest()
             self.state.modify {
-                $0.queuedRequests.insert(retriedRequest, at: 0)
+                $0.requeue(retriedRequest)
+            }
+            if retriedRequest.runsConcurrently {
+                self.startQueuedConcurrentRequests()
+            } else {
+                self.beginNextRequest()
             }
-            self.beginNextRequest()
         }
         return true
     }
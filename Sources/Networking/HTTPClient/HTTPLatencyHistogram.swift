@@ -0,0 +1,71 @@
+//
+//  HTTPLatencyHistogram.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+
+/// A fixed-size histogram of request latencies, used to estimate high percentiles cheaply.
+///
+/// Buckets grow geometrically by `bucketGrowthFactor` from `minimumLatency` to `maximumLatency`, in the
+/// spirit of an HDR histogram: every estimate is within one bucket (about 20%) of the true value, using a
+/// few hundred bytes no matter how many requests are recorded. Latencies outside the range land in the
+/// first or last bucket. Once `decayThreshold` samples have been recorded every count is halved, so the
+/// histogram follows changes in the network instead of averaging over its whole lifetime.
+struct HTTPLatencyHistogram {
+
+    static let minimumLatency: TimeInterval = 0.01
+    static let maximumLatency: TimeInterval = 60
+    static let bucketGrowthFactor = 1.2
+    static let decayThreshold = 512
+
+    private static let bucketCount = Int(
+        (log(Self.maximumLatency / Self.minimumLatency) / log(Self.bucketGrowthFactor)).rounded(.up)
+    ) + 1
+
+    private var counts: [Int] = Array(repeating: 0, count: HTTPLatencyHistogram.bucketCount)
+
+    /// The number of samples currently weighing on the estimates, after decay.
+    private(set) var sampleCount = 0
+
+    mutating func record(_ latency: TimeInterval) {
+        self.counts[Self.bucketIndex(for: latency)] += 1
+        self.sampleCount += 1
+
+        if self.sampleCount >= Self.decayThreshold {
+            self.counts = self.counts.map { $0 / 2 }
+            self.sampleCount = self.counts.reduce(0, +)
+        }
+    }
+
+    /// The latency below which `percentile` (between `0` and `1`) of the recorded samples fall, rounded up
+    /// to the upper bound of its bucket. `nil` if nothing was recorded.
+    func latency(atPercentile percentile: Double) -> TimeInterval? {
+        guard self.sampleCount > 0 else { return nil }
+
+        let rank = max(1, Int((Double(self.sampleCount) * min(max(percentile, 0), 1)).rounded(.up)))
+        var seen = 0
+        for (index, count) in self.counts.enumerated() {
+            seen += count
+            if seen >= rank {
+                return Self.upperBound(ofBucket: index)
+            }
+        }
+
+        return Self.maximumLatency
+    }
+
+    private static func bucketIndex(for latency: TimeInterval) -> Int {
+        guard latency > Self.minimumLatency else { return 0 }
+
+        let index = Int((log(latency / Self.minimumLatency) / log(Self.bucketGrowthFactor)).rounded(.up))
+        return min(index, Self.bucketCount - 1)
+    }
+
+    private static func upperBound(ofBucket index: Int) -> TimeInterval {
+        return min(Self.minimumLatency * pow(Self.bucketGrowthFactor, Double(index)), Self.maximumLatency)
+    }
+
+}
@@ -60,6 +60,14 @@ protocol HTTPRequestPath {
     /// requests when picking a timeout or updating the per-host fail-fast memory.
     var isFallbackHostPath: Bool { get }
 
+    /// Whether requests to this path are independent reads that may run alongside other requests instead of
+    /// waiting in `HTTPClient`'s serial queue. Requests that change customer state, or whose result depends
+    /// on earlier changes (like customer info after a receipt post), must stay serial.
+    var allowsConcurrentRequests: Bool { get }
+
+    /// How urgently callers need the response, which sets the priority of the `URLSessionTask`.
+    var priority: RequestPriority { get }
+
     /// Additional headers specific to this endpoint.
     var additionalHeaders: HTTPRequest.Headers { get }
 
@@ -124,6 +132,14 @@ extension HTTPRequestPath {
         return false
     }
 
+    var allowsConcurrentRequests: Bool {
+        return false
+    }
+
+    var priority: RequestPriority {
+        return .userVisible
+    }
+
     var additionalHeaders: HTTPRequest.Headers {
         return [:]
     }
@@ -237,6 +253,68 @@ extension HTTPRequest.Path: HTTPRequestPath {
         return true
     }
 
+    var allowsConcurrentRequests: Bool {
+        switch self {
+        case .getOfferings,
+                .getProductEntitlementMapping,
+                .getCustomerCenterConfig,
+                .health,
+                .appHealthReportAvailability,
+                .remoteConfig:
+            return true
+        // Virtual currency balances change with purchases, so they must be read after pending receipts post.
+        case .getVirtualCurrencies,
+                .getCustomerInfo,
+                .getIntroEligibility,
+                .logIn,
+                .postAttributionData,
+                .postOfferForSigning,
+                .postReceiptData,
+                .postSubscriberAttributes,
+                .postAdServicesToken,
+                .appHealthReport,
+                .postRedeemWebPurchase,
+                .postCreateTicket,
+                .isPurchaseAllowedByRestoreBehavior,
+                .rewardVerificationStatus,
+                .tokenLogin,
+                .tokenRefresh,
+                .tokenLogOut:
+            return false
+        }
+    }
+
+    var priority: RequestPriority {
+        switch self {
+        case .getCustomerInfo,
+                .logIn,
+                .postOfferForSigning,
+                .postReceiptData,
+                .postRedeemWebPurchase,
+                .isPurchaseAllowedByRestoreBehavior,
+                .tokenLogin,
+                .tokenRefresh,
+                .tokenLogOut:
+            return .userBlocking
+        case .getOfferings,
+                .getIntroEligibility,
+                .getCustomerCenterConfig,
+                .getVirtualCurrencies,
+                .postCreateTicket,
+                .rewardVerificationStatus,
+                .remoteConfig:
+            return .userVisible
+        case .postAttributionData,
+                .postSubscriberAttributes,
+                .postAdServicesToken,
+                .health,
+                .appHealthReport,
+                .appHealthReportAvailability,
+                .getProductEntitlementMapping:
+            return .background
+        }
+    }
+
     private static let fallbackServerHostURLs = [
         URL(string: "https://api-production.8-lives-cat.io")
     ]
@@ -37,8 +37,50 @@ protocol HTTPRequestTimeoutManagerType: AnyObject {
     ///   - host: The resolved host string of the attempt.
     ///   - result: The result of the HTTP request.
     func recordRequestResult(host: String?, _ result: HTTPRequestTimeoutManager.RequestResult)
+
+    /// Like `timeout(host:isFallbackHostRequest:endpointSupportsFallbackURLs:isProxied:reTieredTimeoutsEnabled:)`,
+    /// but also adapting to the latencies recorded for `endpoint` on `host`.
+    // swiftlint:disable:next function_parameter_count
+    func timeout(host: String?,
+                 endpoint: String?,
+                 isFallbackHostRequest: Bool,
+                 endpointSupportsFallbackURLs: Bool,
+                 isProxied: Bool,
+                 reTieredTimeoutsEnabled: Bool) -> TimeInterval
+
+    /// Records how long a successful request to `endpoint` on the main source `host` took.
+    func recordLatency(_ latency: TimeInterval, host: String?, endpoint: String)
+}
+
+extension HTTPRequestTimeoutManagerType {
+
+    // swiftlint:disable:next function_parameter_count
+    func timeout(host: String?,
+                 endpoint: String?,
+                 isFallbackHostRequest: Bool,
+                 endpointSupportsFallbackURLs: Bool,
+                 isProxied: Bool,
+                 reTieredTimeoutsEnabled: Bool) -> TimeInterval {
+        return self.timeout(host: host,
+                            isFallbackHostRequest: isFallbackHostRequest,
+                            endpointSupportsFallbackURLs: endpointSupportsFallbackURLs,
+                            isProxied: isProxied,
+                            reTieredTimeoutsEnabled: reTieredTimeoutsEnabled)
+    }
+
+    func recordLatency(_ latency: TimeInterval, host: String?, endpoint: String) {}
+
 }
 
+/// Picks the timeout for each HTTP request attempt from fixed tiers, shortened while a host has recently
+/// timed out.
+///
+/// Once enough successful requests to an endpoint on a host have been recorded, the base tier is replaced by
+/// the observed `adaptivePercentile` latency times `adaptiveSafetyFactor`, clamped between the reduced
+/// tier and the flat tier. On a fast network this fails over well before the base tier would; on a
+/// consistently slow one it stops cutting off requests that would have succeeded. Adaptive timeouts only
+/// apply to callers that opt into the re-tiered timeouts and never when the developer set a custom
+/// `networkTimeout`.
 class HTTPRequestTimeoutManager: HTTPRequestTimeoutManagerType {
 
     enum RequestResult {
@@ -76,6 +118,13 @@ class HTTPRequestTimeoutManager: HTTPRequestTimeoutManagerType {
     // The amount of time after which a per-host timeout entry expires.
     private static let timeoutResetInterval: TimeInterval = 600 // 10 minutes
 
+    static let adaptivePercentile = 0.99
+    static let adaptiveSafetyFactor = 2.0
+    static let adaptiveMinimumSampleCount = 20
+
+    // Recorded latencies, keyed by `latencyKey(host:endpoint:)`. Guarded by `lock`.
+    private var latenciesByEndpoint: [String: HTTPLatencyHistogram] = [:]
+
     // The last time a timeout was recorded, keyed by resolved host string. Guarded by `lock`.
     private var lastTimeoutByHost: [String: Date] = [:]
 
@@ -98,6 +147,21 @@ class HTTPRequestTimeoutManager: HTTPRequestTimeoutManagerType {
                  endpointSupportsFallbackURLs: Bool,
                  isProxied: Bool,
                  reTieredTimeoutsEnabled: Bool) -> TimeInterval {
+        return self.timeout(host: host,
+                            endpoint: nil,
+                            isFallbackHostRequest: isFallbackHostRequest,
+                            endpointSupportsFallbackURLs: endpointSupportsFallbackURLs,
+                            isProxied: isProxied,
+                            reTieredTimeoutsEnabled: reTieredTimeoutsEnabled)
+    }
+
+    // swiftlint:disable:next function_parameter_count
+    func timeout(host: String?,
+                 endpoint: String?,
+                 isFallbackHostRequest: Bool,
+                 endpointSupportsFallbackURLs: Bool,
+                 isProxied: Bool,
+                 reTieredTimeoutsEnabled: Bool) -> TimeInterval {
         // Fallback-host and proxied requests use a flat timeout and never consult the per-host memory.
         guard !isFallbackHostRequest, !isProxied else {
             return reTieredTimeoutsEnabled ? self.baseTimeout(default: Timeout.flat) : self.legacyFlatTimeout
@@ -112,13 +176,53 @@ class HTTPRequestTimeoutManager: HTTPRequestTimeoutManagerType {
 
         let sourceRecentlyTimedOut = host.map { self.hasRecentTimeout(forHost: $0) } ?? false
 
-        // Base tiers honor a custom `networkTimeout`; the reduced fail-fast tiers stay fixed.
-        switch (endpointSupportsFallbackURLs, sourceRecentlyTimedOut) {
-        case (true, false): return self.baseTimeout(default: Timeout.mainSourceSupportingFallback)
-        case (true, true): return Timeout.mainSourceSupportingFallbackReduced
-        case (false, false): return self.baseTimeout(default: Timeout.mainSourceNoFallback)
-        case (false, true): return Timeout.mainSourceNoFallbackReduced
+        let reducedTimeout = endpointSupportsFallbackURLs
+            ? Timeout.mainSourceSupportingFallbackReduced
+            : Timeout.mainSourceNoFallbackReduced
+
+        guard !sourceRecentlyTimedOut else {
+            // The reduced fail-fast tiers stay fixed.
+            return reducedTimeout
+        }
+
+        if reTieredTimeoutsEnabled,
+           let adaptiveTimeout = self.adaptiveTimeout(host: host, endpoint: endpoint, minimum: reducedTimeout) {
+            return adaptiveTimeout
+        }
+
+        // Base tiers honor a custom `networkTimeout`.
+        return self.baseTimeout(default: endpointSupportsFallbackURLs
+                                ? Timeout.mainSourceSupportingFallback
+                                : Timeout.mainSourceNoFallback)
+    }
+
+    /// The timeout derived from the latencies recorded for `endpoint` on `host`, or `nil` while there are too
+    /// few of them or the developer set a custom `networkTimeout`.
+    private func adaptiveTimeout(host: String?, endpoint: String?, minimum: TimeInterval) -> TimeInterval? {
+        guard case .default = self.networkTimeout, let host, let endpoint else { return nil }
+
+        let percentileLatency: TimeInterval? = self.lock.perform {
+            guard let histogram = self.latenciesByEndpoint[Self.latencyKey(host: host, endpoint: endpoint)],
+                  histogram.sampleCount >= Self.adaptiveMinimumSampleCount else {
+                return nil
+            }
+            return histogram.latency(atPercentile: Self.adaptivePercentile)
         }
+
+        return percentileLatency.map { min(max($0 * Self.adaptiveSafetyFactor, minimum), Timeout.flat) }
+    }
+
+    func recordLatency(_ latency: TimeInterval, host: String?, endpoint: String) {
+        guard let host else { return }
+
+        self.lock.perform {
+            self.latenciesByEndpoint[Self.latencyKey(host: host, endpoint: endpoint), default: .init()]
+                .record(latency)
+        }
+    }
+
+    private static func latencyKey(host: String, endpoint: String) -> String {
+        return "\(host) \(endpoint)"
     }
 
     /// The base/flat timeout to use: the developer's custom value when set, otherwise the built-in tier.
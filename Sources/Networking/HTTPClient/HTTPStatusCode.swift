@@ -19,6 +19,7 @@ enum HTTPStatusCode {
     case success
     case createdSuccess
     case noContent
+    case partialContent
     case redirect
     case notModified
     case temporaryRedirect
@@ -26,6 +27,7 @@ enum HTTPStatusCode {
     case unauthorized
     case forbidden
     case notFoundError
+    case rangeNotSatisfiable
     case tooManyRequests
     case internalServerError
     case networkConnectTimeoutError
@@ -36,6 +38,7 @@ enum HTTPStatusCode {
         .success,
         .createdSuccess,
         .noContent,
+        .partialContent,
         .redirect,
         .notModified,
         .temporaryRedirect,
@@ -43,6 +46,7 @@ enum HTTPStatusCode {
         .unauthorized,
         .forbidden,
         .notFoundError,
+        .rangeNotSatisfiable,
         .internalServerError,
         .networkConnectTimeoutError
     ]
@@ -60,6 +64,7 @@ extension HTTPStatusCode: RawRepresentable {
         case .success: return 200
         case .createdSuccess: return 201
         case .noContent: return 204
+        case .partialContent: return 206
         case .redirect: return 300
         case .notModified: return 304
         case .temporaryRedirect: return 307
@@ -67,6 +72,7 @@ extension HTTPStatusCode: RawRepresentable {
         case .unauthorized: return 401
         case .forbidden: return 403
         case .notFoundError: return 404
+        case .rangeNotSatisfiable: return 416
         case .tooManyRequests: return 429
         case .internalServerError: return 500
         case .networkConnectTimeoutError: return 599
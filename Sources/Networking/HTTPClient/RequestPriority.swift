@@ -0,0 +1,98 @@
+//
+//  RequestPriority.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+
+/// How urgently the result of a backend request is needed.
+///
+/// Honored by `NetworkOperation`'s queue priority and quality of service, which order the backend queues,
+/// and by the `URLSessionTask` priority of the request itself.
+enum RequestPriority: Int, CaseIterable, Comparable {
+
+    /// Nobody waits for the result, e.g. posting attributes or attribution data.
+    case background
+
+    /// The result shows up in the UI, e.g. offerings.
+    case userVisible
+
+    /// The user is actively waiting on the result, e.g. a purchase or log in.
+    case userBlocking
+
+    static func < (lhs: Self, rhs: Self) -> Bool {
+        return lhs.rawValue < rhs.rawValue
+    }
+
+    var queuePriority: Operation.QueuePriority {
+        switch self {
+        case .background: return .low
+        case .userVisible: return .normal
+        case .userBlocking: return .veryHigh
+        }
+    }
+
+    var qualityOfService: QualityOfService {
+        switch self {
+        case .background: return .background
+        case .userVisible: return .default
+        case .userBlocking: return .userInitiated
+        }
+    }
+
+    var taskPriority: Float {
+        switch self {
+        case .background: return URLSessionTask.lowPriority
+        case .userVisible: return URLSessionTask.defaultPriority
+        case .userBlocking: return URLSessionTask.highPriority
+        }
+    }
+
+}
+
+/// How long backend operations of each `RequestPriority` wait in their queue and take to run.
+///
+/// Thread-safe.
+final class RequestPriorityMetrics {
+
+    struct Latency: Equatable {
+
+        private(set) var count = 0
+        private(set) var totalQueueWaitTime: TimeInterval = 0
+        private(set) var totalDuration: TimeInterval = 0
+
+        init() {}
+
+        var averageQueueWaitTime: TimeInterval {
+            return self.count > 0 ? self.totalQueueWaitTime / Double(self.count) : 0
+        }
+
+        var averageDuration: TimeInterval {
+            return self.count > 0 ? self.totalDuration / Double(self.count) : 0
+        }
+
+        fileprivate mutating func record(queueWaitTime: TimeInterval, duration: TimeInterval) {
+            self.count += 1
+            self.totalQueueWaitTime += queueWaitTime
+            self.totalDuration += duration
+        }
+
+    }
+
+    private let latencies: Atomic<[RequestPriority: Latency]> = .init([:])
+
+    func record(_ priority: RequestPriority, queueWaitTime: TimeInterval, duration: TimeInterval) {
+        self.latencies.modify {
+            $0[priority, default: .init()].record(queueWaitTime: queueWaitTime, duration: duration)
+        }
+    }
+
+    func latency(for priority: RequestPriority) -> Latency {
+        return self.latencies.value[priority] ?? .init()
+    }
+
+}
+
+extension RequestPriorityMetrics: Sendable {}
@@ -15,6 +15,10 @@ import Foundation
 
 final class GetCustomerInfoOperation: CacheableNetworkOperation {
 
+    override class var priority: RequestPriority {
+        return .userBlocking
+    }
+
     private let customerInfoResponseHandler: CustomerInfoResponseHandler
     private let customerInfoCallbackCache: CallbackCache<CustomerInfoCallback>
     private let configuration: UserSpecificConfiguration
@@ -15,6 +15,10 @@ import Foundation
 
 final class GetProductEntitlementMappingOperation: CacheableNetworkOperation {
 
+    override class var priority: RequestPriority {
+        return .background
+    }
+
     private let callbackCache: CallbackCache<ProductEntitlementMappingCallback>
 
     static func createFactory(
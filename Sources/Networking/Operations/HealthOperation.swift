@@ -15,6 +15,10 @@ import Foundation
 
 final class HealthOperation: CacheableNetworkOperation {
 
+    override class var priority: RequestPriority {
+        return .background
+    }
+
     struct Callback: CacheKeyProviding {
 
         let cacheKey: String
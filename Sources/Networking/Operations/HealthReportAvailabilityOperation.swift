@@ -16,6 +16,10 @@ import Foundation
 
 final class HealthReportAvailabilityOperation: CacheableNetworkOperation {
 
+    override class var priority: RequestPriority {
+        return .background
+    }
+
     struct Callback: CacheKeyProviding {
 
         let cacheKey: String
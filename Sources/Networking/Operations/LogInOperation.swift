@@ -15,6 +15,10 @@ import Foundation
 
 final class LogInOperation: CacheableNetworkOperation {
 
+    override class var priority: RequestPriority {
+        return .userBlocking
+    }
+
     private let loginCallbackCache: CallbackCache<LogInCallback>
     private let configuration: UserSpecificConfiguration
     private let newAppUserID: String
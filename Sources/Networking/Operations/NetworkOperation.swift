@@ -57,8 +57,17 @@ extension CacheableNetworkOperation: @unchecked Sendable {}
 
 class NetworkOperation: Operation {
 
+    /// How urgently operations of this type are needed. Higher priorities are dequeued first, so background
+    /// work queued behind them waits until they are done.
+    class var priority: RequestPriority {
+        return .userVisible
+    }
+
     let httpClient: HTTPClient
 
+    private let createdAt: Date
+    private let _startedAt: Atomic<Date?> = nil
+
     private let _didStart: Atomic<Bool> = false
     private var didStart: Bool { return self._didStart.value }
 
@@ -105,8 +114,12 @@ class NetworkOperation: Operation {
 
     init(configuration: NetworkConfiguration) {
         self.httpClient = configuration.httpClient
+        self.createdAt = Date()
 
         super.init()
+
+        self.queuePriority = Self.priority.queuePriority
+        self.qualityOfService = Self.priority.qualityOfService
     }
 
     deinit {
@@ -130,6 +143,7 @@ class NetworkOperation: Operation {
         }
 
         self.isExecuting = true
+        self._startedAt.value = Date()
 
         self.log("Started")
 
@@ -157,11 +171,25 @@ class NetworkOperation: Operation {
         assert(!self.isFinished, "Operation \(type(of: self)) (\(self)) was already finished")
 
         self.log("Finished")
+        self.recordLatency()
 
         self.isExecuting = false
         self.isFinished = true
     }
 
+    private final func recordLatency() {
+        guard let startedAt = self._startedAt.value else { return }
+
+        let queueWaitTime = startedAt.timeIntervalSince(self.createdAt)
+        let duration = Date().timeIntervalSince(startedAt)
+
+        self.httpClient.priorityMetrics.record(Self.priority, queueWaitTime: queueWaitTime, duration: duration)
+        Logger.verbose(Strings.network.operation_latency(type(of: self),
+                                                         priority: Self.priority,
+                                                         queueWaitTime: queueWaitTime,
+                                                         duration: duration))
+    }
+
     // MARK: -
 
     final override var isAsynchronous: Bool {
@@ -15,6 +15,10 @@ import Foundation
 
 class PostAdServicesTokenOperation: NetworkOperation {
 
+    override class var priority: RequestPriority {
+        return .background
+    }
+
     private let configuration: UserSpecificConfiguration
     private let token: String
     private let responseHandler: CustomerAPI.SimpleResponseHandler?
@@ -15,6 +15,10 @@ import Foundation
 
 class PostAttributionDataOperation: NetworkOperation {
 
+    override class var priority: RequestPriority {
+        return .background
+    }
+
     private let configuration: UserSpecificConfiguration
     private let attributionData: [String: Any]
     private let network: AttributionNetwork
@@ -16,6 +16,10 @@ import Foundation
 // swiftlint:disable:next type_name
 final class PostIsPurchaseAllowedByRestoreBehaviorOperation: CacheableNetworkOperation {
 
+    override class var priority: RequestPriority {
+        return .userBlocking
+    }
+
     private let configuration: AppUserConfiguration
     private let postData: PostData
     private let isPurchaseAllowedByRestoreBehaviorCallbackCache:
@@ -15,6 +15,10 @@ import Foundation
 
 class PostOfferForSigningOperation: NetworkOperation {
 
+    override class var priority: RequestPriority {
+        return .userBlocking
+    }
+
     typealias SigningData = (signature: String, keyIdentifier: String, nonce: UUID, timestamp: Int)
 
     struct PostOfferForSigningData {
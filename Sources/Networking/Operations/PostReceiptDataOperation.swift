@@ -17,6 +17,10 @@ import Foundation
 
 final class PostReceiptDataOperation: CacheableNetworkOperation {
 
+    override class var priority: RequestPriority {
+        return .userBlocking
+    }
+
     private let postData: PostData
     private let configuration: AppUserConfiguration
     private let customerInfoResponseHandler: CustomerInfoResponseHandler
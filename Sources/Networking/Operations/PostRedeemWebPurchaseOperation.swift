@@ -15,6 +15,10 @@ import Foundation
 
 final class PostRedeemWebPurchaseOperation: CacheableNetworkOperation {
 
+    override class var priority: RequestPriority {
+        return .userBlocking
+    }
+
     private let postData: PostData
     private let configuration: AppUserConfiguration
     private let customerInfoResponseHandler: CustomerInfoResponseHandler
@@ -15,6 +15,10 @@ import Foundation
 
 class PostSubscriberAttributesOperation: NetworkOperation {
 
+    override class var priority: RequestPriority {
+        return .background
+    }
+
     private let configuration: UserSpecificConfiguration
     private let subscriberAttributes: SubscriberAttribute.Dictionary
     private let responseHandler: CustomerAPI.SimpleResponseHandler?
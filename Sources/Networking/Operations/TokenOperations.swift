@@ -14,6 +14,10 @@ import Foundation
 
 final class TokenLogInOperation: CacheableNetworkOperation {
 
+    override class var priority: RequestPriority {
+        return .userBlocking
+    }
+
     private let tokenCallbackCache: CallbackCache<TokenCallback>
     private let configuration: UserSpecificConfiguration
     private let token: IdentityAuthToken
@@ -146,6 +150,10 @@ private extension TokenLogInOperation {
 
 final class TokenRevocationOperation: CacheableNetworkOperation, @unchecked Sendable {
 
+    override class var priority: RequestPriority {
+        return .userBlocking
+    }
+
     private let callbackCache: CallbackCache<TokenRevokeCallback>
     private let configuration: UserSpecificConfiguration
     private let token: String
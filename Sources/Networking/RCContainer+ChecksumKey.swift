@@ -0,0 +1,152 @@
+//
+//  RCContainer+ChecksumKey.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+
+extension RCContainer {
+
+    /// A 24-byte element checksum stored inline as three machine words.
+    ///
+    /// Parsing and lookups key elements by this value so that hashing and equality compare 24 bytes
+    /// instead of a heap-allocated 32-character `String`. The base64url `ref` is only produced at API
+    /// boundaries that expose checksums as strings.
+    struct ChecksumKey: Hashable {
+
+        static let byteCount = 24
+
+        private let word0: UInt64
+        private let word1: UInt64
+        private let word2: UInt64
+
+        /// Creates a key from the first 24 bytes of `bytes`, which must contain at least that many.
+        init(bytes: UnsafeRawBufferPointer) {
+            precondition(bytes.count >= Self.byteCount, "Checksum keys need \(Self.byteCount) bytes")
+
+            var words: (UInt64, UInt64, UInt64) = (0, 0, 0)
+            withUnsafeMutableBytes(of: &words) { buffer in
+                buffer.copyMemory(from: UnsafeRawBufferPointer(rebasing: bytes.prefix(Self.byteCount)))
+            }
+            (self.word0, self.word1, self.word2) = words
+        }
+
+        /// Creates a key from a 32-character unpadded base64url ref, or returns `nil` if `ref` is not one.
+        init?(ref: String) {
+            let decoded = ref.utf8.withContiguousStorageIfAvailable { Self.decodeRef($0) }
+                ?? Self.decodeRef(Array(ref.utf8))
+            guard let bytes = decoded else {
+                return nil
+            }
+
+            self = bytes.withUnsafeBytes { Self(bytes: $0) }
+        }
+
+        /// The checksum encoded as a 32-character URL-safe base64 string with no padding.
+        var ref: String {
+            return self.withUnsafeBytes(Base64URL.encode)
+        }
+
+        /// Provides the raw checksum bytes for the duration of `body`.
+        func withUnsafeBytes<T>(_ body: (UnsafeRawBufferPointer) throws -> T) rethrows -> T {
+            return try Swift.withUnsafeBytes(of: (self.word0, self.word1, self.word2), body)
+        }
+
+    }
+
+    /// Unpadded URL-safe base64 (RFC 4648 §5) as used by element checksums and blob refs.
+    ///
+    /// Encodes through a 64-entry table straight into one output buffer, avoiding the intermediate
+    /// `Data`, padded `String` and three `replacingOccurrences` passes of the Foundation-based path.
+    enum Base64URL {
+
+        static func encode(_ bytes: UnsafeRawBufferPointer) -> String {
+            var output: [UInt8] = []
+            output.reserveCapacity((bytes.count * 4 + 2) / 3)
+
+            Self.alphabet.withUnsafeBufferPointer { alphabet in
+                var index = 0
+                while index + 3 <= bytes.count {
+                    let value = UInt32(bytes[index]) << 16
+                        | UInt32(bytes[index + 1]) << 8
+                        | UInt32(bytes[index + 2])
+                    output.append(alphabet[Int(value >> 18)])
+                    output.append(alphabet[Int(value >> 12 & 0x3F)])
+                    output.append(alphabet[Int(value >> 6 & 0x3F)])
+                    output.append(alphabet[Int(value & 0x3F)])
+                    index += 3
+                }
+
+                switch bytes.count - index {
+                case 1:
+                    let value = UInt32(bytes[index]) << 16
+                    output.append(alphabet[Int(value >> 18)])
+                    output.append(alphabet[Int(value >> 12 & 0x3F)])
+                case 2:
+                    let value = UInt32(bytes[index]) << 16 | UInt32(bytes[index + 1]) << 8
+                    output.append(alphabet[Int(value >> 18)])
+                    output.append(alphabet[Int(value >> 12 & 0x3F)])
+                    output.append(alphabet[Int(value >> 6 & 0x3F)])
+                default:
+                    break
+                }
+            }
+
+            return String(decoding: output, as: UTF8.self)
+        }
+
+        fileprivate static let alphabet: [UInt8] = Array(
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_".utf8
+        )
+
+        /// Maps an ASCII byte to its 6-bit value, or `0xFF` for bytes outside the alphabet.
+        fileprivate static let decodingTable: [UInt8] = {
+            var table = [UInt8](repeating: 0xFF, count: 256)
+            for (value, character) in Self.alphabet.enumerated() {
+                table[Int(character)] = UInt8(value)
+            }
+            return table
+        }()
+
+    }
+
+}
+
+private extension RCContainer.ChecksumKey {
+
+    static let refLength = 32
+
+    static func decodeRef<Characters: RandomAccessCollection>(
+        _ characters: Characters
+    ) -> [UInt8]? where Characters.Element == UInt8, Characters.Index == Int {
+        guard characters.count == Self.refLength else {
+            return nil
+        }
+
+        let table = RCContainer.Base64URL.decodingTable
+        var bytes: [UInt8] = []
+        bytes.reserveCapacity(Self.byteCount)
+
+        var index = characters.startIndex
+        while index < characters.endIndex {
+            var value: UInt32 = 0
+            for offset in 0..<4 {
+                let sextet = table[Int(characters[index + offset])]
+                guard sextet != 0xFF else {
+                    return nil
+                }
+                value = value << 6 | UInt32(sextet)
+            }
+
+            bytes.append(UInt8(value >> 16))
+            bytes.append(UInt8(value >> 8 & 0xFF))
+            bytes.append(UInt8(value & 0xFF))
+            index += 4
+        }
+
+        return bytes
+    }
+
+}
@@ -15,20 +15,50 @@ extension RCContainer.Element.ContentEncoding {
     ///
     /// `.none` borrows the original wire bytes without copying. Compressed encodings allocate a
     /// temporary decoded buffer because decompression necessarily materializes new bytes.
+    /// `zstdDictionaries` resolves the dictionary IDs that `.zstd` frames may reference.
     func withDecodedBytes<T>(
         from bytes: UnsafeRawBufferPointer,
+        zstdDictionaries: [UInt32: RCContainer.ZstdDictionary] = [:],
         _ body: (UnsafeRawBufferPointer) throws -> T
     ) throws -> T {
         switch self {
         case .none:
             return try body(bytes)
-        case .gzip:
-            let decoded = try Self.gzipDecompressed(bytes)
+        case .gzip, .brotli:
+            var decoded = Data()
+            try self.forEachDecodedChunk(from: bytes) { chunk in
+                decoded.append(contentsOf: chunk)
+            }
             return try decoded.withUnsafeBytes(body)
-        case .brotli:
-            let decoded = try Self.brotliDecompressed(bytes)
+        case .zstd:
+            let decoded = try RCContainer.ZstdDecoder.decompress(bytes, dictionaries: zstdDictionaries)
             return try decoded.withUnsafeBytes(body)
-        case .zstd, .unsupported:
+        case .unsupported:
+            throw RCContainer.Parser.FormatError.unsupportedContentEncoding(self.rawValue)
+        }
+    }
+
+    /// Decodes `bytes` and passes the output to `consume` in order, one chunk at a time.
+    ///
+    /// gzip and Brotli decode into a single reusable buffer of `outputChunkSize` bytes, so peak memory stays
+    /// at one chunk regardless of the decoded size. `.none` passes the wire bytes through as one chunk, and
+    /// `.zstd` passes its fully decoded frame. Chunks are only valid for the duration of each `consume` call.
+    func forEachDecodedChunk(
+        from bytes: UnsafeRawBufferPointer,
+        zstdDictionaries: [UInt32: RCContainer.ZstdDictionary] = [:],
+        _ consume: (UnsafeRawBufferPointer) throws -> Void
+    ) throws {
+        switch self {
+        case .none:
+            try consume(bytes)
+        case .gzip:
+            try Self.gzipDecompress(bytes, into: consume)
+        case .brotli:
+            try Self.brotliDecompress(bytes, into: consume)
+        case .zstd:
+            let decoded = try RCContainer.ZstdDecoder.decompress(bytes, dictionaries: zstdDictionaries)
+            try decoded.withUnsafeBytes(consume)
+        case .unsupported:
             throw RCContainer.Parser.FormatError.unsupportedContentEncoding(self.rawValue)
         }
     }
@@ -40,7 +70,10 @@ private extension RCContainer.Element.ContentEncoding {
     static let gzipWindowBits = MAX_WBITS + 16
     static let outputChunkSize = 64 * 1024
 
-    static func gzipDecompressed(_ bytes: UnsafeRawBufferPointer) throws -> Data {
+    static func gzipDecompress(
+        _ bytes: UnsafeRawBufferPointer,
+        into consume: (UnsafeRawBufferPointer) throws -> Void
+    ) throws {
         var stream = z_stream()
         let streamSize = Int32(MemoryLayout<z_stream>.size)
         guard inflateInit2_(&stream, Self.gzipWindowBits, ZLIB_VERSION, streamSize) == Z_OK else {
@@ -53,61 +86,70 @@ private extension RCContainer.Element.ContentEncoding {
         )
         stream.avail_in = uInt(bytes.count)
 
-        var output = Data()
+        let chunk = UnsafeMutablePointer<Bytef>.allocate(capacity: Self.outputChunkSize)
+        defer { chunk.deallocate() }
+
         var status: Int32 = Z_OK
         repeat {
-            var chunk = [UInt8](repeating: 0, count: Self.outputChunkSize)
-            try chunk.withUnsafeMutableBytes { outputBytes in
-                stream.next_out = outputBytes.bindMemory(to: Bytef.self).baseAddress
-                stream.avail_out = uInt(outputBytes.count)
-
-                status = inflate(&stream, Z_NO_FLUSH)
-                guard status == Z_OK || status == Z_STREAM_END else {
-                    throw RCContainer.Parser.FormatError.contentDecompressionFailed(Self.gzip.rawValue)
-                }
-
-                let byteCount = outputBytes.count - Int(stream.avail_out)
-                output.append(contentsOf: outputBytes.prefix(byteCount))
+            stream.next_out = chunk
+            stream.avail_out = uInt(Self.outputChunkSize)
+
+            status = inflate(&stream, Z_NO_FLUSH)
+            guard status == Z_OK || status == Z_STREAM_END else {
+                throw RCContainer.Parser.FormatError.contentDecompressionFailed(Self.gzip.rawValue)
+            }
+
+            let byteCount = Self.outputChunkSize - Int(stream.avail_out)
+            if byteCount > 0 {
+                try consume(UnsafeRawBufferPointer(start: chunk, count: byteCount))
             }
         } while status != Z_STREAM_END
 
         guard stream.avail_in == 0 else {
             throw RCContainer.Parser.FormatError.contentDecompressionFailed(Self.gzip.rawValue)
         }
-
-        return output
     }
 
-    static func brotliDecompressed(_ bytes: UnsafeRawBufferPointer) throws -> Data {
-        do {
-            return try Self.brotliDecompressedBytes(bytes)
-        } catch let error as RCContainer.Parser.FormatError {
-            throw error
-        } catch {
-            throw RCContainer.Parser.FormatError.contentDecompressionFailed(Self.brotli.rawValue)
-        }
-    }
+    /// Decodes Brotli through `compression_stream` directly, which reads the input in place instead of
+    /// copying each requested input slice into a new `Data` the way `InputFilter` does.
+    static func brotliDecompress(
+        _ bytes: UnsafeRawBufferPointer,
+        into consume: (UnsafeRawBufferPointer) throws -> Void
+    ) throws {
+        let failure = RCContainer.Parser.FormatError.contentDecompressionFailed(Self.brotli.rawValue)
+        let algorithm = try Self.brotliCompressionAlgorithm
 
-    static func brotliDecompressedBytes(_ bytes: UnsafeRawBufferPointer) throws -> Data {
-        var offset = 0
-        let filter = try InputFilter(
-            .decompress,
-            using: try Self.brotliCompressionAlgorithm
-        ) { requestedLength -> Data? in
-            guard offset < bytes.count else { return nil }
-
-            let endOffset = min(offset + requestedLength, bytes.count)
-            let chunk = bytes[offset..<endOffset]
-            offset = endOffset
-            return Data(chunk)
-        }
+        let chunk = UnsafeMutablePointer<UInt8>.allocate(capacity: Self.outputChunkSize)
+        defer { chunk.deallocate() }
+
+        let stream = UnsafeMutablePointer<compression_stream>.allocate(capacity: 1)
+        defer { stream.deallocate() }
 
-        var output = Data()
-        while let chunk = try filter.readData(ofLength: Self.outputChunkSize) {
-            output.append(chunk)
+        guard compression_stream_init(stream, COMPRESSION_STREAM_DECODE, algorithm.rawValue)
+                == COMPRESSION_STATUS_OK else {
+            throw failure
         }
+        defer { compression_stream_destroy(stream) }
 
-        return output
+        stream.pointee.src_ptr = bytes.bindMemory(to: UInt8.self).baseAddress ?? UnsafePointer(chunk)
+        stream.pointee.src_size = bytes.count
+
+        var status = COMPRESSION_STATUS_OK
+        repeat {
+            stream.pointee.dst_ptr = chunk
+            stream.pointee.dst_size = Self.outputChunkSize
+
+            status = compression_stream_process(stream, Int32(COMPRESSION_STREAM_FINALIZE.rawValue))
+            guard status != COMPRESSION_STATUS_ERROR else { throw failure }
+
+            let byteCount = Self.outputChunkSize - stream.pointee.dst_size
+            if byteCount > 0 {
+                try consume(UnsafeRawBufferPointer(start: chunk, count: byteCount))
+            } else if status == COMPRESSION_STATUS_OK && stream.pointee.src_size == 0 {
+                // All input was consumed without reaching the end of the stream: the payload is truncated.
+                throw failure
+            }
+        } while status != COMPRESSION_STATUS_END
     }
 
 }
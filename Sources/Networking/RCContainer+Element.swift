@@ -18,8 +18,15 @@ extension RCContainer {
     /// backing data is private on purpose so callers cannot accidentally introduce copying behavior.
     struct Element {
 
+        /// The raw element checksum, used for hashing and comparisons.
+        let checksumKey: ChecksumKey
+
         /// The element checksum encoded as a 32-character URL-safe base64 string with no padding.
-        let checksum: String
+        ///
+        /// Encoded on each access; prefer `checksumKey` on hot paths.
+        var checksum: String {
+            return self.checksumKey.ref
+        }
 
         /// The wire payload size in bytes, excluding the element header and any alignment padding.
         let size: Int
@@ -31,17 +38,24 @@ extension RCContainer {
         private let checksumRange: Range<Data.Index>
         private let payloadRange: Range<Data.Index>
 
+        /// Resolves the dictionaries shipped in the same container, used to decode `.zstd` payloads.
+        private var zstdDictionaryResolver: ZstdDictionaryResolver?
+
+        private var zstdDictionaries: [UInt32: ZstdDictionary] {
+            return self.zstdDictionaryResolver?.dictionaries ?? [:]
+        }
+
         init(
             storage: Data,
             checksumRange: Range<Data.Index>,
             payloadRange: Range<Data.Index>,
-            checksum: String,
+            checksumKey: ChecksumKey,
             encoding: ContentEncoding
         ) {
             self.storage = storage
             self.checksumRange = checksumRange
             self.payloadRange = payloadRange
-            self.checksum = checksum
+            self.checksumKey = checksumKey
             self.encoding = encoding
             self.size = storage.distance(from: payloadRange.lowerBound, to: payloadRange.upperBound)
         }
@@ -61,10 +75,32 @@ extension RCContainer {
         /// decoded into temporary storage because decompression necessarily materializes new bytes.
         func withDecodedPayloadBytes<T>(_ body: (UnsafeRawBufferPointer) throws -> T) throws -> T {
             return try self.withPayloadBytes { bytes in
-                try self.encoding.withDecodedBytes(from: bytes, body)
+                try self.encoding.withDecodedBytes(from: bytes, zstdDictionaries: self.zstdDictionaries, body)
             }
         }
 
+        /// Passes the decoded payload bytes to `body` in order, one chunk at a time.
+        ///
+        /// Unlike `withDecodedPayloadBytes`, gzip and Brotli payloads are never materialized in full, so
+        /// callers that hash, write, or otherwise stream the payload keep peak memory at a single chunk.
+        func forEachDecodedPayloadChunk(_ body: (UnsafeRawBufferPointer) throws -> Void) throws {
+            try self.withPayloadBytes { bytes in
+                try self.encoding.forEachDecodedChunk(from: bytes, zstdDictionaries: self.zstdDictionaries, body)
+            }
+        }
+
+        /// Returns a copy of this element that decodes `.zstd` frames with the dictionaries `resolver` finds.
+        func withZstdDictionaries(_ resolver: ZstdDictionaryResolver) -> Self {
+            var element = self
+            element.zstdDictionaryResolver = resolver
+            return element
+        }
+
+        /// Offset of the payload's first byte from the start of the container.
+        var payloadOffset: Int {
+            return self.storage.distance(from: self.storage.startIndex, to: self.payloadRange.lowerBound)
+        }
+
         /// Provides read-only access to the raw 24-byte checksum for the duration of `body`.
         func withChecksumBytes<T>(_ body: (UnsafeRawBufferPointer) throws -> T) rethrows -> T {
             return try self.withBytes(in: self.checksumRange, body)
@@ -72,21 +108,21 @@ extension RCContainer {
 
         /// Returns whether the decoded payload bytes match the element's stored checksum.
         func isChecksumValid() -> Bool {
-            return (try? self.checksum == self.payloadChecksum()) == true
+            return (try? self.checksumKey == self.payloadChecksum()) == true
         }
 
         /// Returns whether already-decoded payload bytes match the element's stored checksum.
         func isChecksumValid(decodedPayloadBytes bytes: UnsafeRawBufferPointer) -> Bool {
-            return self.checksum == self.payloadChecksum(decodedPayloadBytes: bytes)
+            return self.checksumKey == self.payloadChecksum(decodedPayloadBytes: bytes)
         }
 
         /// Validates the decoded payload bytes against the element's stored checksum.
         func validateChecksum() throws {
             let actual = try self.payloadChecksum()
-            guard self.checksum == actual else {
+            guard self.checksumKey == actual else {
                 throw Parser.FormatError.checksumMismatch(
                     expected: self.checksum,
-                    actual: actual
+                    actual: actual.ref
                 )
             }
         }
@@ -94,25 +130,25 @@ extension RCContainer {
         /// Validates already-decoded payload bytes against the element's stored checksum.
         func validateChecksum(decodedPayloadBytes bytes: UnsafeRawBufferPointer) throws {
             let actual = self.payloadChecksum(decodedPayloadBytes: bytes)
-            guard self.checksum == actual else {
+            guard self.checksumKey == actual else {
                 throw Parser.FormatError.checksumMismatch(
                     expected: self.checksum,
-                    actual: actual
+                    actual: actual.ref
                 )
             }
         }
 
-        private func payloadChecksum() throws -> String {
-            return try self.withDecodedPayloadBytes { bytes in
-                self.payloadChecksum(decodedPayloadBytes: bytes)
+        private func payloadChecksum() throws -> ChecksumKey {
+            var hash = SHA256()
+            try self.forEachDecodedPayloadChunk { chunk in
+                hash.update(bufferPointer: chunk)
             }
-        }
 
-        private func payloadChecksum(decodedPayloadBytes bytes: UnsafeRawBufferPointer) -> String {
-            var hash = SHA256()
-            hash.update(bufferPointer: bytes)
+            return hash.finalize().withUnsafeBytes { ChecksumKey(bytes: $0) }
+        }
 
-            return Self.base64URLString(from: Array(hash.finalize().prefix(Self.checksumSize)))
+        private func payloadChecksum(decodedPayloadBytes bytes: UnsafeRawBufferPointer) -> ChecksumKey {
+            return SHA256.hash(data: bytes).withUnsafeBytes { ChecksumKey(bytes: $0) }
         }
 
         private func withBytes<T>(
@@ -138,8 +174,8 @@ extension RCContainer.Element {
     ///
     /// Encoding ids match the backend wire format:
     /// `0 = none`, `1 = gzip`, `2 = brotli`, `3 = zstd`.
-    /// `zstd` is recognized but not decoded by iOS yet. Unknown ids are preserved as
-    /// `unsupported` so structural parsing can succeed while decoded access fails clearly.
+    /// Unknown ids are preserved as `unsupported` so structural parsing can succeed while decoded
+    /// access fails clearly.
     enum ContentEncoding: Equatable {
 
         case none
@@ -185,11 +221,11 @@ extension RCContainer.Element {
 
         var isSupported: Bool {
             switch self {
-            case .none, .gzip:
+            case .none, .gzip, .zstd:
                 return true
             case .brotli:
                 return (try? Self.brotliCompressionAlgorithm) != nil
-            case .zstd, .unsupported:
+            case .unsupported:
                 return false
             }
         }
@@ -208,7 +244,9 @@ extension RCContainer.Element {
                 .joined(separator: ", ")
         }
 
-        private static let encodingPreference: [Self] = [.brotli, .gzip, .none]
+        // zstd is preferred over gzip for its container-shared dictionaries, but stays behind Brotli, which
+        // Apple's Compression framework decodes natively.
+        private static let encodingPreference: [Self] = [.brotli, .zstd, .gzip, .none]
 
         static var brotliCompressionAlgorithm: Algorithm {
             get throws {
@@ -232,17 +270,3 @@ extension RCContainer.Element {
     }
 
 }
-
-private extension RCContainer.Element {
-
-    static let checksumSize = 24
-
-    static func base64URLString(from bytes: [UInt8]) -> String {
-        return Data(bytes)
-            .base64EncodedString()
-            .replacingOccurrences(of: "+", with: "-")
-            .replacingOccurrences(of: "/", with: "_")
-            .replacingOccurrences(of: "=", with: "")
-    }
-
-}
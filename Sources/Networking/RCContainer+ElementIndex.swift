@@ -0,0 +1,328 @@
+//
+//  RCContainer+ElementIndex.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import CryptoKit
+import Foundation
+
+extension RCContainer {
+
+    /// Compact element table persisted next to a cached container so reopening it skips the header walk.
+    ///
+    /// The RC Container format stores no element count or offsets, so `Parser` has to visit every element
+    /// header to find the next one. The index records each element's raw checksum, payload offset,
+    /// wire size and encoding, which lets `init(contentsOf:backing:)` build elements without reading the
+    /// container bytes at all.
+    ///
+    /// Layout (all multi-byte integers little-endian):
+    /// ```
+    /// Header (32 bytes): magic byte[2]="RI" | version u8 | container flags u8 | entry count u32
+    ///                    container size u64 | container modification time f64 bits u64 | reserved byte[8]
+    /// Entry (40 bytes):  checksum byte[24]  | payload offset u64 | wire size u32 | encoding u8 | reserved byte[3]
+    /// Digest (32 bytes): SHA-256 of every preceding index byte
+    /// ```
+    /// The index is only trusted while the container file still has the recorded size and modification date,
+    /// which atomic container writes always change. Element checksums are still validated on use, so an index
+    /// that slips past those checks surfaces as checksum mismatches rather than wrong payloads.
+    struct ElementIndex: Equatable {
+
+        // swiftlint:disable nesting
+        /// Where one element's payload lives in the container.
+        struct Entry: Equatable {
+
+            /// The element checksum.
+            let checksum: ChecksumKey
+
+            /// Offset of the payload's first byte from the start of the container.
+            let payloadOffset: Int
+
+            /// The wire payload size in bytes.
+            let size: Int
+
+            let encoding: Element.ContentEncoding
+
+        }
+        // swiftlint:enable nesting
+
+        /// Header flags of the indexed container.
+        let flags: UInt8
+
+        /// Byte count of the indexed container file.
+        let containerSize: Int
+
+        /// Modification date of the indexed container file.
+        let containerModificationDate: Date
+
+        /// Entries in container wire order.
+        let entries: [Entry]
+
+        init(
+            flags: UInt8,
+            containerSize: Int,
+            containerModificationDate: Date,
+            entries: [Entry]
+        ) {
+            self.flags = flags
+            self.containerSize = containerSize
+            self.containerModificationDate = containerModificationDate
+            self.entries = entries
+        }
+
+        /// Indexes the elements of `container`, which was persisted as a file of `containerSize` bytes.
+        init(container: RCContainer, containerSize: Int, containerModificationDate: Date) {
+            self.init(
+                flags: container.flags,
+                containerSize: containerSize,
+                containerModificationDate: containerModificationDate,
+                entries: container.elements.map { element in
+                    Entry(
+                        checksum: element.checksumKey,
+                        payloadOffset: element.payloadOffset,
+                        size: element.size,
+                        encoding: element.encoding
+                    )
+                }
+            )
+        }
+
+        /// Decodes a serialized index, returning `nil` if it is truncated, corrupted or from another version.
+        init?(serialized data: Data) {
+            let bytes = [UInt8](data)
+            guard bytes.count >= Self.headerSize + Self.digestSize else {
+                return nil
+            }
+
+            let digestOffset = bytes.count - Self.digestSize
+            guard Array(SHA256.hash(data: bytes[..<digestOffset])) == Array(bytes[digestOffset...]),
+                  bytes[0] == Self.magic.0,
+                  bytes[1] == Self.magic.1,
+                  bytes[2] == Self.version else {
+                return nil
+            }
+
+            let entryCount = Int(Self.littleEndianValue(in: bytes, at: 4, count: 4))
+            guard digestOffset - Self.headerSize == entryCount * Self.entrySize else {
+                return nil
+            }
+
+            guard let containerSize = Int(exactly: Self.littleEndianValue(in: bytes, at: 8, count: 8)) else {
+                return nil
+            }
+
+            var entries: [Entry] = []
+            entries.reserveCapacity(entryCount)
+            for index in 0..<entryCount {
+                let offset = Self.headerSize + index * Self.entrySize
+                let checksumEnd = offset + ChecksumKey.byteCount
+                let payloadOffset = Self.littleEndianValue(in: bytes, at: checksumEnd, count: 8)
+                guard payloadOffset <= UInt64(containerSize) else {
+                    return nil
+                }
+
+                entries.append(Entry(
+                    checksum: bytes[offset..<checksumEnd].withUnsafeBytes { ChecksumKey(bytes: $0) },
+                    payloadOffset: Int(payloadOffset),
+                    size: Int(Self.littleEndianValue(in: bytes, at: checksumEnd + 8, count: 4)),
+                    encoding: .init(rawValue: bytes[checksumEnd + 12])
+                ))
+            }
+
+            let modificationTime = Double(bitPattern: Self.littleEndianValue(in: bytes, at: 16, count: 8))
+            self.flags = bytes[3]
+            self.containerSize = containerSize
+            self.containerModificationDate = Date(timeIntervalSinceReferenceDate: modificationTime)
+            self.entries = entries
+        }
+
+        /// Serializes the index in the layout described on `ElementIndex`.
+        func serialized() -> Data {
+            var bytes: [UInt8] = []
+            bytes.reserveCapacity(Self.headerSize + self.entries.count * Self.entrySize + Self.digestSize)
+
+            bytes += [Self.magic.0, Self.magic.1, Self.version, self.flags]
+            Self.appendLittleEndian(UInt64(self.entries.count), count: 4, to: &bytes)
+            Self.appendLittleEndian(UInt64(self.containerSize), count: 8, to: &bytes)
+            Self.appendLittleEndian(
+                self.containerModificationDate.timeIntervalSinceReferenceDate.bitPattern,
+                count: 8,
+                to: &bytes
+            )
+            bytes += [UInt8](repeating: 0, count: 8)
+
+            for entry in self.entries {
+                entry.checksum.withUnsafeBytes { bytes += $0 }
+                Self.appendLittleEndian(UInt64(entry.payloadOffset), count: 8, to: &bytes)
+                Self.appendLittleEndian(UInt64(entry.size), count: 4, to: &bytes)
+                bytes += [entry.encoding.rawValue, 0, 0, 0]
+            }
+
+            bytes += SHA256.hash(data: bytes)
+            return Data(bytes)
+        }
+
+        /// Whether this index describes the container file whose attributes are `size` and `modificationDate`.
+        func matches(containerSize size: Int, modificationDate: Date) -> Bool {
+            return self.containerSize == size && self.containerModificationDate == modificationDate
+        }
+
+        /// Location of the index persisted for the container at `containerURL`.
+        static func url(forContainerAt containerURL: URL) -> URL {
+            return containerURL.appendingPathExtension(Self.pathExtension)
+        }
+
+    }
+
+}
+
+extension RCContainer {
+
+    /// Writes container `data` atomically to `url`, followed by an `ElementIndex` sidecar describing it.
+    ///
+    /// The container is parsed before anything is written, so malformed bytes are never persisted.
+    /// Failing to write the index is logged and otherwise ignored: reopening falls back to parsing.
+    @discardableResult
+    static func persist(_ data: Data, to url: URL) throws -> RCContainer {
+        let container = try RCContainer(data: data)
+        try Self.persist(container, data: data, to: url)
+
+        return container
+    }
+
+    /// Writes `data`, which `container` was parsed from, atomically to `url`, followed by an `ElementIndex`
+    /// sidecar describing it. Use this when the container has already been parsed to skip a second header walk.
+    static func persist(_ container: RCContainer, data: Data, to url: URL) throws {
+        try data.write(to: url, options: .atomic)
+
+        let indexURL = ElementIndex.url(forContainerAt: url)
+        do {
+            let attributes = try Self.fileAttributes(at: url)
+            let index = ElementIndex(
+                container: container,
+                containerSize: attributes.size,
+                containerModificationDate: attributes.modificationDate
+            )
+            try index.serialized().write(to: indexURL, options: .atomic)
+        } catch {
+            Logger.warn(RCContainerElementIndexStrings.failedToWriteIndex(indexURL, error))
+        }
+    }
+
+    /// Builds a container over `data` from a previously persisted index instead of parsing element headers.
+    ///
+    /// Only bounds are checked here; `nil` is returned if any entry falls outside `data`.
+    init?(data: Data, index: ElementIndex) {
+        guard index.containerSize == data.count else {
+            return nil
+        }
+
+        var elements: [Element] = []
+        elements.reserveCapacity(index.entries.count)
+
+        for entry in index.entries {
+            let checksumOffset = entry.payloadOffset - ElementParser.elementHeaderSize
+            guard checksumOffset >= ElementParser.headerSize,
+                  entry.size <= data.count - entry.payloadOffset else {
+                return nil
+            }
+
+            let checksumStart = data.index(data.startIndex, offsetBy: checksumOffset)
+            let payloadStart = data.index(data.startIndex, offsetBy: entry.payloadOffset)
+            elements.append(Element(
+                storage: data,
+                checksumRange: checksumStart..<data.index(checksumStart, offsetBy: ChecksumKey.byteCount),
+                payloadRange: payloadStart..<data.index(payloadStart, offsetBy: entry.size),
+                checksumKey: entry.checksum,
+                encoding: entry.encoding
+            ))
+        }
+
+        self.init(flags: index.flags, elements: elements)
+    }
+
+    /// Loads the persisted index for the container at `url` if it still describes that file.
+    ///
+    /// The index is matched to the container by file size and modification date, not by a digest of the
+    /// container. Hashing the container would read every byte of it, which is what reopening from the index
+    /// avoids. The trade-off is that a rewrite keeping both the size and the modification date would go
+    /// unnoticed. Containers are only written atomically, which replaces the file and so changes its
+    /// modification date. Element checksums are still validated on use, so such an index would show up as
+    /// checksum mismatches, not wrong payloads. The index's own digest only guards the index bytes.
+    static func validElementIndex(forContainerAt url: URL) -> ElementIndex? {
+        let indexURL = ElementIndex.url(forContainerAt: url)
+        guard let serialized = try? Data(contentsOf: indexURL) else {
+            return nil
+        }
+
+        guard let index = ElementIndex(serialized: serialized),
+              let attributes = try? Self.fileAttributes(at: url),
+              index.matches(containerSize: attributes.size, modificationDate: attributes.modificationDate) else {
+            Logger.debug(RCContainerElementIndexStrings.ignoringStaleIndex(indexURL))
+            return nil
+        }
+
+        return index
+    }
+
+}
+
+private extension RCContainer {
+
+    struct MissingFileAttributesError: Error {}
+
+    /// Reads size and modification date through `FileManager`, which unlike `URL.resourceValues` never
+    /// returns values cached from before the file was rewritten.
+    static func fileAttributes(at url: URL) throws -> (size: Int, modificationDate: Date) {
+        let attributes = try FileManager.default.attributesOfItem(atPath: url.path)
+        guard let size = (attributes[.size] as? NSNumber)?.intValue,
+              let modificationDate = attributes[.modificationDate] as? Date else {
+            throw MissingFileAttributesError()
+        }
+
+        return (size, modificationDate)
+    }
+
+}
+
+private extension RCContainer.ElementIndex {
+
+    static let magic = (UInt8(ascii: "R"), UInt8(ascii: "I"))
+    static let version: UInt8 = 1
+    static let headerSize = 32
+    static let entrySize = 40
+    static let digestSize = 32
+    static let pathExtension = "index"
+
+    static func littleEndianValue(in bytes: [UInt8], at offset: Int, count: Int) -> UInt64 {
+        return (0..<count).reduce(UInt64(0)) { value, byteIndex in
+            value | UInt64(bytes[offset + byteIndex]) << (8 * UInt64(byteIndex))
+        }
+    }
+
+    static func appendLittleEndian(_ value: UInt64, count: Int, to bytes: inout [UInt8]) {
+        for byteIndex in 0..<count {
+            bytes.append(UInt8(truncatingIfNeeded: value >> (8 * UInt64(byteIndex))))
+        }
+    }
+
+}
+
+private enum RCContainerElementIndexStrings: LogMessage {
+
+    case failedToWriteIndex(URL, Error)
+    case ignoringStaleIndex(URL)
+
+    var description: String {
+        switch self {
+        case let .failedToWriteIndex(url, error):
+            return "Failed to write RC Container index '\(url.lastPathComponent)': \(error.localizedDescription)"
+        case let .ignoringStaleIndex(url):
+            return "RC Container index '\(url.lastPathComponent)' does not match its container; parsing instead."
+        }
+    }
+
+    var category: String { return "rc_container" }
+
+}
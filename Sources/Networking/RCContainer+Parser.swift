@@ -28,6 +28,7 @@ extension RCContainer {
             case truncatedElement(index: Int)
             case unsupportedContentEncoding(UInt8)
             case contentDecompressionFailed(UInt8)
+            case missingContentDictionary(UInt32)
             case checksumMismatch(expected: String, actual: String)
             case missingElement(index: Int)
 
@@ -69,7 +70,7 @@ extension RCContainer {
         private static let flagsSize = 1
         private static let headerReservedOffset = flagsOffset + flagsSize
         private static let headerReservedSize = 4
-        private static let headerSize = headerReservedOffset + headerReservedSize
+        static let headerSize = headerReservedOffset + headerReservedSize
 
         private static let magic = (UInt8(ascii: "R"), UInt8(ascii: "C"))
         private static let version: UInt8 = 1
@@ -79,7 +80,7 @@ extension RCContainer {
         private static let elementSizeFieldSize = uint32Size
         private static let elementEncodingFieldSize = 1
         private static let elementReservedFieldSize = 3
-        private static let elementHeaderSize = checksumSize
+        static let elementHeaderSize = checksumSize
             + elementSizeFieldSize
             + elementEncodingFieldSize
             + elementReservedFieldSize
@@ -142,7 +143,7 @@ extension RCContainer {
             let checksumStartOffset = self.offset
             let checksumEndOffset = checksumStartOffset + Self.checksumSize
             let checksumRange = self.dataRange(offset: checksumStartOffset, count: Self.checksumSize)
-            let checksum = self.base64URLString(in: checksumStartOffset..<checksumEndOffset)
+            let checksumKey = self.checksumKey(in: checksumStartOffset..<checksumEndOffset)
 
             self.offset = checksumEndOffset
             let elementSize = Int(self.littleEndianUInt32(at: self.offset))
@@ -174,17 +175,22 @@ extension RCContainer {
                 storage: self.data,
                 checksumRange: checksumRange,
                 payloadRange: payloadRange,
-                checksum: checksum,
+                checksumKey: checksumKey,
                 encoding: encoding
             )
         }
 
+        /// Returns the alignment padding that follows a payload of `elementSize` bytes.
+        static func paddingSize(forElementSize elementSize: Int) -> Int {
+            return (Self.alignment - elementSize % Self.alignment) % Self.alignment
+        }
+
         /// Consumes alignment padding after a payload.
         ///
         /// Padding length is derived only from the element payload size, not from the absolute container
         /// offset. The final element may omit trailing padding bytes entirely.
         private mutating func consumePadding(forElementSize elementSize: Int) {
-            let paddingSize = (Self.alignment - elementSize % Self.alignment) % Self.alignment
+            let paddingSize = Self.paddingSize(forElementSize: elementSize)
             guard paddingSize > 0 else {
                 return
             }
@@ -197,24 +203,14 @@ extension RCContainer {
             }
         }
 
-        /// Encodes bytes already present in the container as an unpadded base64url string.
-        private func base64URLString(in range: Range<Int>) -> String {
-            var bytes: [UInt8] = []
-            bytes.reserveCapacity(range.count)
-            for offset in range {
-                bytes.append(self.byte(at: offset))
+        /// Reads checksum bytes already present in the container into an inline key.
+        ///
+        /// Keys compare and hash as three machine words, so parsing no longer allocates and hashes a
+        /// base64url `String` per element; the string form is produced only when `Element.checksum` is read.
+        private func checksumKey(in range: Range<Int>) -> ChecksumKey {
+            return self.data.withUnsafeBytes { bytes in
+                ChecksumKey(bytes: UnsafeRawBufferPointer(rebasing: bytes[range]))
             }
-
-            return Self.base64URLString(from: bytes)
-        }
-
-        /// Encodes bytes as base64url without padding.
-        private static func base64URLString(from bytes: [UInt8]) -> String {
-            return Data(bytes)
-                .base64EncodedString()
-                .replacingOccurrences(of: "+", with: "-")
-                .replacingOccurrences(of: "/", with: "_")
-                .replacingOccurrences(of: "=", with: "")
         }
 
         /// Reads the wire-format little-endian `UInt32` used for payload sizes and reserved metadata.
@@ -0,0 +1,86 @@
+//
+//  RCContainer+Validation.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+
+extension RCContainer {
+
+    /// Outcome of decoding one element and validating its checksum.
+    struct ElementValidationResult: Equatable {
+
+        /// Position of the element in `RCContainer.elements`.
+        let index: Int
+
+        /// The element's stored checksum.
+        let checksum: String
+
+        /// Why validation failed, or `nil` when the decoded payload matched the checksum.
+        let error: Parser.FormatError?
+
+        var isValid: Bool {
+            return self.error == nil
+        }
+
+    }
+
+    /// Decodes every element and validates its checksum, running up to `concurrency` elements at once.
+    ///
+    /// Elements are independent, so decompression and hashing fan out across cores through a task group that
+    /// never holds more than `concurrency` elements in flight. That also bounds how many decoded payloads are
+    /// alive at the same time. Validation is opt-in: elements stay lazily validated when consumers touch them.
+    ///
+    /// - Returns: One result per element, in element order.
+    func validateAll(
+        concurrency: Int = ProcessInfo.processInfo.activeProcessorCount
+    ) async -> [ElementValidationResult] {
+        let elements = self.elements
+        let initialTaskCount = min(max(concurrency, 1), elements.count)
+
+        return await withTaskGroup(of: ElementValidationResult.self) { group in
+            for index in 0..<initialTaskCount {
+                group.addTask {
+                    return Self.validationResult(for: elements[index], at: index)
+                }
+            }
+
+            var nextIndex = initialTaskCount
+            var results: [ElementValidationResult?] = Array(repeating: nil, count: elements.count)
+            while let result = await group.next() {
+                results[result.index] = result
+
+                if nextIndex < elements.count {
+                    let index = nextIndex
+                    group.addTask {
+                        return Self.validationResult(for: elements[index], at: index)
+                    }
+                    nextIndex += 1
+                }
+            }
+
+            return results.compactMap { $0 }
+        }
+    }
+
+}
+
+private extension RCContainer {
+
+    static func validationResult(for element: Element, at index: Int) -> ElementValidationResult {
+        let error: Parser.FormatError?
+        do {
+            try element.validateChecksum()
+            error = nil
+        } catch let formatError as Parser.FormatError {
+            error = formatError
+        } catch {
+            error = .contentDecompressionFailed(element.encoding.rawValue)
+        }
+
+        return .init(index: index, checksum: element.checksum, error: error)
+    }
+
+}
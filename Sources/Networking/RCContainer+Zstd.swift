@@ -0,0 +1,1099 @@
+//
+//  RCContainer+Zstd.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+
+// swiftlint:disable file_length
+
+extension RCContainer {
+
+    /// A zstd dictionary (RFC 8878, section 5) shipped as a raw element of an RC Container.
+    ///
+    /// Small JSON blobs compress poorly on their own. The backend can train one dictionary per container,
+    /// ship it as an uncompressed element, and compress the remaining elements against it. Frames that name
+    /// a dictionary ID in their header are decoded with the matching dictionary from the same container.
+    struct ZstdDictionary {
+
+        /// Dictionary ID referenced by zstd frame headers.
+        let id: UInt32
+
+        fileprivate let entropy: ZstdEntropy
+        fileprivate let content: [UInt8]
+
+        /// Returns whether `bytes` start with the zstd dictionary magic number.
+        static func isDictionary(_ bytes: UnsafeRawBufferPointer) -> Bool {
+            return bytes.count >= Self.headerSize
+                && ZstdInput(bytes).littleEndianUInt32(at: 0) == Self.magic
+        }
+
+        /// Parses a formatted zstd dictionary, including its entropy tables and repeat offsets.
+        init(bytes: UnsafeRawBufferPointer) throws {
+            let input = ZstdInput(bytes)
+            guard Self.isDictionary(bytes) else {
+                throw ZstdInput.malformed
+            }
+
+            var offset = Self.headerSize
+            var entropy = ZstdEntropy()
+
+            let huffman = try HuffmanTable.read(from: input, at: offset)
+            entropy.huffman = huffman.table
+            offset += huffman.byteCount
+
+            let offsets = try FSETable.read(from: input, at: offset, kind: .offsets)
+            entropy.offsets = offsets.table
+            offset += offsets.byteCount
+
+            let matchLengths = try FSETable.read(from: input, at: offset, kind: .matchLengths)
+            entropy.matchLengths = matchLengths.table
+            offset += matchLengths.byteCount
+
+            let literalLengths = try FSETable.read(from: input, at: offset, kind: .literalLengths)
+            entropy.literalLengths = literalLengths.table
+            offset += literalLengths.byteCount
+
+            try input.require(offset + Self.repeatOffsetsSize)
+            let repeatOffsets = (0..<3).map { Int(input.littleEndianUInt32(at: offset + $0 * 4)) }
+            guard repeatOffsets.allSatisfy({ $0 > 0 }) else { throw ZstdInput.malformed }
+            entropy.repeatOffsets = (repeatOffsets[0], repeatOffsets[1], repeatOffsets[2])
+            offset += Self.repeatOffsetsSize
+
+            self.id = input.littleEndianUInt32(at: 4)
+            self.entropy = entropy
+            self.content = Array(bytes[offset...])
+        }
+
+        private static let magic: UInt32 = 0xEC30A437
+        private static let headerSize = 8
+        private static let repeatOffsetsSize = 12
+
+    }
+
+    /// Decoder for zstd frames (RFC 8878) used by `.zstd` RC Container elements.
+    ///
+    /// Apple's Compression framework has no zstd support, so frames are decoded here. The decoder handles
+    /// raw, RLE and compressed blocks, Huffman-coded literals, FSE-coded sequences, skippable frames and
+    /// formatted dictionaries. The optional frame content checksum is skipped rather than verified because
+    /// every element payload is already validated against its SHA-256 checksum after decoding.
+    ///
+    /// Decoded sizes are checked before bytes are produced: no block may decode to more than 128 KB, a frame
+    /// may not outgrow the content size its header declares, and the whole payload is capped at
+    /// `maximumDecodedSize`.
+    enum ZstdDecoder {
+
+        /// The largest decoded payload accepted for a single element.
+        static let maximumDecodedSize = 16 * 1024 * 1024
+
+        /// Decompresses every frame in `bytes` and returns the concatenated output.
+        ///
+        /// - Throws: `Parser.FormatError.missingContentDictionary` when a frame names a dictionary that is
+        /// not in `dictionaries`, and `Parser.FormatError.contentDecompressionFailed` for malformed input.
+        static func decompress(
+            _ bytes: UnsafeRawBufferPointer,
+            dictionaries: [UInt32: ZstdDictionary]
+        ) throws -> [UInt8] {
+            let input = ZstdInput(bytes)
+            var output: [UInt8] = []
+            var offset = 0
+
+            while offset < input.count {
+                try input.require(offset + 4)
+                let magic = input.littleEndianUInt32(at: offset)
+
+                if magic & Self.skippableFrameMagicMask == Self.skippableFrameMagic {
+                    try input.require(offset + 8)
+                    offset += 8 + Int(input.littleEndianUInt32(at: offset + 4))
+                    try input.require(offset)
+                    continue
+                }
+
+                guard magic == Self.frameMagic else {
+                    throw ZstdInput.malformed
+                }
+
+                var frame = ZstdFrameDecoder(input: input, offset: offset + 4)
+                try frame.decode(
+                    dictionaries: dictionaries,
+                    maximumSize: Self.maximumDecodedSize - output.count,
+                    appendingTo: &output
+                )
+                offset = frame.offset
+            }
+
+            return output
+        }
+
+        private static let frameMagic: UInt32 = 0xFD2FB528
+        private static let skippableFrameMagic: UInt32 = 0x184D2A50
+        private static let skippableFrameMagicMask: UInt32 = 0xFFFFFFF0
+
+    }
+
+    /// Finds the zstd dictionaries among a container's uncompressed elements the first time one of its `.zstd`
+    /// elements is decoded.
+    ///
+    /// Opening a container therefore reads no payload bytes, so memory-mapped containers fault in no pages for
+    /// it, and containers whose `.zstd` elements are never decoded never parse their dictionaries.
+    final class ZstdDictionaryResolver {
+
+        private let candidates: [Element]
+        private let lock = Lock(.nonRecursive)
+        private var resolved: [UInt32: ZstdDictionary]?
+
+        /// - Parameter candidates: uncompressed elements in wire order, so the last dictionary with an ID wins.
+        init(candidates: [Element]) {
+            self.candidates = candidates
+        }
+
+        /// The dictionaries found among the candidates, keyed by dictionary ID.
+        var dictionaries: [UInt32: ZstdDictionary] {
+            return self.lock.perform {
+                if let resolved = self.resolved {
+                    return resolved
+                }
+
+                var dictionaries: [UInt32: ZstdDictionary] = [:]
+                for element in self.candidates {
+                    if let dictionary = RCContainer.zstdDictionary(in: element) {
+                        dictionaries[dictionary.id] = dictionary
+                    }
+                }
+
+                self.resolved = dictionaries
+                return dictionaries
+            }
+        }
+
+    }
+
+    /// Binds every `.zstd` element to a `ZstdDictionaryResolver` over the uncompressed `elements`.
+    ///
+    /// Containers without `.zstd` elements are returned unchanged. Elements taken from another container
+    /// are rebound to this container's dictionaries.
+    static func bindingZstdDictionaries(to elements: [Element]) -> [Element] {
+        guard elements.contains(where: { $0.encoding == .zstd }) else { return elements }
+
+        let resolver = ZstdDictionaryResolver(candidates: elements.filter { $0.encoding == .none })
+        return elements.map { element in
+            element.encoding == .zstd ? element.withZstdDictionaries(resolver) : element
+        }
+    }
+
+    /// Parses `element` as a zstd dictionary if it is uncompressed and starts with the dictionary magic number.
+    static func zstdDictionary(in element: Element) -> ZstdDictionary? {
+        guard element.encoding == .none else { return nil }
+
+        return element.withPayloadBytes { bytes in
+            guard ZstdDictionary.isDictionary(bytes) else { return nil }
+
+            do {
+                return try ZstdDictionary(bytes: bytes)
+            } catch {
+                Logger.warn(RCContainerZstdStrings.invalidDictionary(checksum: element.checksum))
+                return nil
+            }
+        }
+    }
+
+}
+
+private enum RCContainerZstdStrings: LogMessage {
+
+    case invalidDictionary(checksum: String)
+
+    var description: String {
+        switch self {
+        case let .invalidDictionary(checksum):
+            return "RC element '\(checksum)' has the zstd dictionary magic but could not be parsed; ignoring it."
+        }
+    }
+
+    var category: String { return "rc_container" }
+
+}
+
+// MARK: - Frames and blocks
+
+/// Decodes one zstd frame, keeping the entropy tables and repeat offsets that carry across its blocks.
+private struct ZstdFrameDecoder {
+
+    private let input: ZstdInput
+    private(set) var offset: Int
+
+    private var entropy = ZstdEntropy()
+    private var history: [UInt8] = []
+
+    init(input: ZstdInput, offset: Int) {
+        self.input = input
+        self.offset = offset
+    }
+
+    /// Decodes the frame and appends its content to `output`.
+    ///
+    /// - Throws: if the frame would decode to more than `maximumSize` bytes or to more than its declared
+    /// content size. Both are checked before each block is decoded.
+    // swiftlint:disable:next cyclomatic_complexity function_body_length
+    mutating func decode(
+        dictionaries: [UInt32: RCContainer.ZstdDictionary],
+        maximumSize: Int,
+        appendingTo output: inout [UInt8]
+    ) throws {
+        let header = try self.readFrameHeader()
+        let maximumFrameSize = min(header.contentSize ?? maximumSize, maximumSize)
+        if let contentSize = header.contentSize, contentSize > maximumSize {
+            throw ZstdInput.malformed
+        }
+
+        if header.dictionaryID != 0 {
+            guard let dictionary = dictionaries[header.dictionaryID] else {
+                throw RCContainer.Parser.FormatError.missingContentDictionary(header.dictionaryID)
+            }
+
+            self.entropy = dictionary.entropy
+            self.history = dictionary.content
+        }
+
+        var frameOutput: [UInt8] = []
+        if let contentSize = header.contentSize {
+            frameOutput.reserveCapacity(contentSize)
+        }
+
+        var isLastBlock = false
+        while !isLastBlock {
+            try self.input.require(self.offset + 3)
+            let blockHeader = self.input.littleEndianUInt24(at: self.offset)
+            self.offset += 3
+
+            isLastBlock = blockHeader & 1 == 1
+            let blockSize = Int(blockHeader >> 3)
+            let maximumDecodedBlockSize = min(Self.maximumBlockSize, maximumFrameSize - frameOutput.count)
+
+            switch (blockHeader >> 1) & 3 {
+            case 0:
+                guard blockSize <= maximumDecodedBlockSize else { throw ZstdInput.malformed }
+
+                let block = try self.input.slice(self.offset, count: blockSize)
+                frameOutput.append(contentsOf: block)
+                self.offset += blockSize
+            case 1:
+                guard blockSize <= maximumDecodedBlockSize else { throw ZstdInput.malformed }
+
+                let byte = try self.input.byte(at: self.offset)
+                frameOutput.append(contentsOf: repeatElement(byte, count: blockSize))
+                self.offset += 1
+            case 2:
+                guard blockSize <= Self.maximumBlockSize else { throw ZstdInput.malformed }
+
+                let block = ZstdInput(try self.input.slice(self.offset, count: blockSize))
+                try self.decodeCompressedBlock(block, maximumSize: maximumDecodedBlockSize, into: &frameOutput)
+                self.offset += blockSize
+            default:
+                throw ZstdInput.malformed
+            }
+        }
+
+        if header.hasChecksum {
+            try self.input.require(self.offset + 4)
+            self.offset += 4
+        }
+
+        if let contentSize = header.contentSize, contentSize != frameOutput.count {
+            throw ZstdInput.malformed
+        }
+
+        output.append(contentsOf: frameOutput)
+    }
+
+    /// The largest size of a block, both on the wire and decoded (RFC 8878, section 3.1.1.2.4).
+    private static let maximumBlockSize = 128 * 1024
+
+}
+
+private extension ZstdFrameDecoder {
+
+    struct FrameHeader {
+
+        let dictionaryID: UInt32
+        let contentSize: Int?
+        let hasChecksum: Bool
+
+    }
+
+    mutating func readFrameHeader() throws -> FrameHeader {
+        let descriptor = try self.input.byte(at: self.offset)
+        self.offset += 1
+
+        guard descriptor & 0x08 == 0 else { throw ZstdInput.malformed }
+
+        let contentSizeFlag = Int(descriptor >> 6)
+        let isSingleSegment = descriptor & 0x20 != 0
+        let hasChecksum = descriptor & 0x04 != 0
+        let dictionaryIDFlag = Int(descriptor & 0x03)
+
+        if !isSingleSegment {
+            // Window descriptor. Output is accumulated in memory, so the window size is not needed.
+            self.offset += 1
+        }
+
+        let dictionaryIDSize = [0, 1, 2, 4][dictionaryIDFlag]
+        let dictionaryID = UInt32(try self.input.littleEndianValue(at: self.offset, count: dictionaryIDSize))
+        self.offset += dictionaryIDSize
+
+        let contentSizeFieldSize = [isSingleSegment ? 1 : 0, 2, 4, 8][contentSizeFlag]
+        var contentSize: Int?
+        if contentSizeFieldSize > 0 {
+            let value = try self.input.littleEndianValue(at: self.offset, count: contentSizeFieldSize)
+            guard value <= UInt64(Int.max - 256) else { throw ZstdInput.malformed }
+            contentSize = Int(value) + (contentSizeFieldSize == 2 ? 256 : 0)
+        }
+        self.offset += contentSizeFieldSize
+
+        return .init(dictionaryID: dictionaryID, contentSize: contentSize, hasChecksum: hasChecksum)
+    }
+
+    /// Decodes a compressed block into `output`, throwing before it would append more than `maximumSize` bytes.
+    mutating func decodeCompressedBlock(_ block: ZstdInput, maximumSize: Int, into output: inout [UInt8]) throws {
+        var literals: [UInt8] = []
+        var offset = try self.decodeLiterals(block, maximumSize: maximumSize, into: &literals)
+
+        let sequenceCountByte = Int(try block.byte(at: offset))
+        let sequenceCount: Int
+        switch sequenceCountByte {
+        case 0:
+            output.append(contentsOf: literals)
+            return
+        case 1..<128:
+            sequenceCount = sequenceCountByte
+            offset += 1
+        case 128..<255:
+            sequenceCount = try ((sequenceCountByte - 128) << 8) + Int(block.byte(at: offset + 1))
+            offset += 2
+        default:
+            sequenceCount = try Int(block.littleEndianValue(at: offset + 1, count: 2)) + 0x7F00
+            offset += 3
+        }
+
+        let modes = try block.byte(at: offset)
+        offset += 1
+
+        offset += try self.updateTable(\.literalLengths, kind: .literalLengths, mode: modes >> 6, block, offset)
+        offset += try self.updateTable(\.offsets, kind: .offsets, mode: (modes >> 4) & 3, block, offset)
+        offset += try self.updateTable(\.matchLengths, kind: .matchLengths, mode: (modes >> 2) & 3, block, offset)
+
+        try self.executeSequences(
+            count: sequenceCount,
+            bitstream: try block.slice(offset, count: block.count - offset),
+            literals: literals,
+            maximumSize: maximumSize,
+            into: &output
+        )
+    }
+
+    /// Decodes the literals section and returns its size in bytes.
+    // swiftlint:disable:next cyclomatic_complexity function_body_length
+    mutating func decodeLiterals(_ block: ZstdInput, maximumSize: Int, into literals: inout [UInt8]) throws -> Int {
+        let firstByte = try block.byte(at: 0)
+        let literalsType = firstByte & 3
+        let sizeFormat = (firstByte >> 2) & 3
+
+        if literalsType == 0 || literalsType == 1 {
+            let headerSize: Int
+            let regeneratedSize: Int
+            switch sizeFormat {
+            case 0, 2:
+                headerSize = 1
+                regeneratedSize = Int(firstByte >> 3)
+            case 1:
+                headerSize = 2
+                regeneratedSize = Int(try block.littleEndianValue(at: 0, count: 2) >> 4)
+            default:
+                headerSize = 3
+                regeneratedSize = Int(try block.littleEndianValue(at: 0, count: 3) >> 4)
+            }
+            guard regeneratedSize <= maximumSize else { throw ZstdInput.malformed }
+
+            if literalsType == 0 {
+                literals.append(contentsOf: try block.slice(headerSize, count: regeneratedSize))
+                return headerSize + regeneratedSize
+            } else {
+                let byte = try block.byte(at: headerSize)
+                literals.append(contentsOf: repeatElement(byte, count: regeneratedSize))
+                return headerSize + 1
+            }
+        }
+
+        let headerSize = [3, 3, 4, 5][Int(sizeFormat)]
+        let sizeBitCount = [10, 10, 14, 18][Int(sizeFormat)]
+        let streamCount = sizeFormat == 0 ? 1 : 4
+
+        let header = try block.littleEndianValue(at: 0, count: headerSize)
+        let sizeMask: UInt64 = (1 << UInt64(sizeBitCount)) - 1
+        let regeneratedSize = Int((header >> 4) & sizeMask)
+        let compressedSize = Int((header >> UInt64(4 + sizeBitCount)) & sizeMask)
+        guard regeneratedSize <= maximumSize else { throw ZstdInput.malformed }
+
+        var offset = headerSize
+        let end = headerSize + compressedSize
+        try block.require(end)
+
+        if literalsType == 2 {
+            let huffman = try HuffmanTable.read(from: block, at: offset)
+            self.entropy.huffman = huffman.table
+            offset += huffman.byteCount
+        }
+
+        guard let huffman = self.entropy.huffman, offset <= end else {
+            throw ZstdInput.malformed
+        }
+
+        literals.reserveCapacity(regeneratedSize)
+        if streamCount == 1 {
+            try huffman.decode(try block.slice(offset, count: end - offset), count: regeneratedSize, into: &literals)
+        } else {
+            try block.require(offset + 6)
+            var streamSizes = (0..<3).map { Int(block.littleEndianUInt16(at: offset + $0 * 2)) }
+            offset += 6
+            streamSizes.append(end - offset - streamSizes.reduce(0, +))
+            guard streamSizes[3] > 0 else { throw ZstdInput.malformed }
+
+            let segmentSize = (regeneratedSize + 3) / 4
+            guard regeneratedSize >= segmentSize * 3 else { throw ZstdInput.malformed }
+
+            for (index, streamSize) in streamSizes.enumerated() {
+                let count = index < 3 ? segmentSize : regeneratedSize - segmentSize * 3
+                try huffman.decode(try block.slice(offset, count: streamSize), count: count, into: &literals)
+                offset += streamSize
+            }
+        }
+
+        return end
+    }
+
+    /// Applies a symbol compression mode to one sequence table and returns the bytes it consumed.
+    mutating func updateTable(
+        _ keyPath: WritableKeyPath<ZstdEntropy, FSETable?>,
+        kind: FSETable.Kind,
+        mode: UInt8,
+        _ block: ZstdInput,
+        _ offset: Int
+    ) throws -> Int {
+        switch mode {
+        case 0:
+            self.entropy[keyPath: keyPath] = kind.predefinedTable
+            return 0
+        case 1:
+            let symbol = try block.byte(at: offset)
+            guard Int(symbol) <= kind.maximumSymbol else { throw ZstdInput.malformed }
+
+            self.entropy[keyPath: keyPath] = .rle(symbol: symbol)
+            return 1
+        case 2:
+            let result = try FSETable.read(from: block, at: offset, kind: kind)
+            self.entropy[keyPath: keyPath] = result.table
+            return result.byteCount
+        default:
+            guard self.entropy[keyPath: keyPath] != nil else { throw ZstdInput.malformed }
+            return 0
+        }
+    }
+
+    // swiftlint:disable:next cyclomatic_complexity function_body_length
+    mutating func executeSequences(
+        count: Int,
+        bitstream: UnsafeRawBufferPointer,
+        literals: [UInt8],
+        maximumSize: Int,
+        into output: inout [UInt8]
+    ) throws {
+        guard let literalLengths = self.entropy.literalLengths,
+              let offsets = self.entropy.offsets,
+              let matchLengths = self.entropy.matchLengths else {
+            throw ZstdInput.malformed
+        }
+
+        var bits = try BackwardBitReader(bitstream)
+        var literalLengthState = Int(bits.read(literalLengths.accuracyLog))
+        var offsetState = Int(bits.read(offsets.accuracyLog))
+        var matchLengthState = Int(bits.read(matchLengths.accuracyLog))
+
+        // Kept in locals rather than an array so updating them does not allocate for every sequence.
+        var (repeatOffset1, repeatOffset2, repeatOffset3) = self.entropy.repeatOffsets
+        var literalsOffset = 0
+        let outputLimit = output.count + maximumSize
+
+        for index in 0..<count {
+            let offsetCode = Int(offsets.symbols[offsetState])
+            let literalLengthCode = Int(literalLengths.symbols[literalLengthState])
+            let matchLengthCode = Int(matchLengths.symbols[matchLengthState])
+            guard offsetCode <= FSETable.Kind.offsets.maximumSymbol else { throw ZstdInput.malformed }
+
+            let offsetValue = (1 << offsetCode) + Int(bits.read(offsetCode))
+            let matchLength = SequenceCodes.matchLengthBaselines[matchLengthCode]
+                + Int(bits.read(SequenceCodes.matchLengthExtraBits[matchLengthCode]))
+            let literalLength = SequenceCodes.literalLengthBaselines[literalLengthCode]
+                + Int(bits.read(SequenceCodes.literalLengthExtraBits[literalLengthCode]))
+
+            let matchOffset: Int
+            if offsetValue > 3 {
+                matchOffset = offsetValue - 3
+                (repeatOffset1, repeatOffset2, repeatOffset3) = (matchOffset, repeatOffset1, repeatOffset2)
+            } else {
+                // Repeat offsets shift by one when the sequence has no literals.
+                switch literalLength == 0 ? offsetValue : offsetValue - 1 {
+                case 0:
+                    matchOffset = repeatOffset1
+                case 1:
+                    matchOffset = repeatOffset2
+                    (repeatOffset1, repeatOffset2) = (matchOffset, repeatOffset1)
+                case 2:
+                    matchOffset = repeatOffset3
+                    (repeatOffset1, repeatOffset2, repeatOffset3) = (matchOffset, repeatOffset1, repeatOffset2)
+                default:
+                    matchOffset = repeatOffset1 - 1
+                    (repeatOffset1, repeatOffset2, repeatOffset3) = (matchOffset, repeatOffset1, repeatOffset2)
+                }
+            }
+
+            if index != count - 1 {
+                literalLengthState = literalLengths.nextState(after: literalLengthState, reading: &bits)
+                matchLengthState = matchLengths.nextState(after: matchLengthState, reading: &bits)
+                offsetState = offsets.nextState(after: offsetState, reading: &bits)
+            }
+
+            guard literalLength <= literals.count - literalsOffset,
+                  literalLength + matchLength <= outputLimit - output.count else {
+                throw ZstdInput.malformed
+            }
+            output.append(contentsOf: literals[literalsOffset..<literalsOffset + literalLength])
+            literalsOffset += literalLength
+
+            try self.copyMatch(offset: matchOffset, length: matchLength, in: &output)
+        }
+
+        guard bits.bitsRemaining == 0,
+              literals.count - literalsOffset <= outputLimit - output.count else {
+            throw ZstdInput.malformed
+        }
+
+        self.entropy.repeatOffsets = (repeatOffset1, repeatOffset2, repeatOffset3)
+        output.append(contentsOf: literals[literalsOffset...])
+    }
+
+    /// Copies `length` bytes starting `offset` bytes back, reaching into dictionary content when needed.
+    ///
+    /// A match may overlap the bytes it produces. Its bytes repeat every `offset` bytes, so it is copied in
+    /// runs from the match source that only read bytes already written, each run twice as long as the last.
+    func copyMatch(offset: Int, length: Int, in output: inout [UInt8]) throws {
+        guard offset > 0, offset <= self.history.count + output.count else { throw ZstdInput.malformed }
+        guard length > 0 else { return }
+
+        let destination = output.count
+        let historyCount = min(length, max(0, offset - destination))
+        if historyCount > 0 {
+            let historyStart = self.history.count - (offset - destination)
+            output.append(contentsOf: self.history[historyStart..<historyStart + historyCount])
+        }
+
+        let source = destination + historyCount - offset
+        let remaining = length - historyCount
+        guard remaining > 0 else { return }
+
+        output.append(contentsOf: repeatElement(0, count: remaining))
+        output.withUnsafeMutableBufferPointer { buffer in
+            // swiftlint:disable:next force_unwrapping
+            let base = buffer.baseAddress!
+            var position = destination + historyCount
+            let end = position + remaining
+            while position < end {
+                let count = min(end - position, position - source)
+                (base + position).update(from: base + source, count: count)
+                position += count
+            }
+        }
+    }
+
+}
+
+// MARK: - Entropy tables
+
+private struct ZstdEntropy {
+
+    var huffman: HuffmanTable?
+    var literalLengths: FSETable?
+    var offsets: FSETable?
+    var matchLengths: FSETable?
+    var repeatOffsets = (1, 4, 8)
+
+}
+
+/// Finite State Entropy decoding table (RFC 8878, section 4.1).
+private struct FSETable {
+
+    enum Kind {
+
+        case literalLengths
+        case matchLengths
+        case offsets
+        case huffmanWeights
+
+        var maximumSymbol: Int {
+            switch self {
+            case .literalLengths: return 35
+            case .matchLengths: return 52
+            case .offsets: return 31
+            case .huffmanWeights: return 255
+            }
+        }
+
+        var maximumAccuracyLog: Int {
+            switch self {
+            case .literalLengths, .matchLengths: return 9
+            case .offsets: return 8
+            case .huffmanWeights: return 6
+            }
+        }
+
+        var predefinedTable: FSETable? {
+            switch self {
+            case .literalLengths: return FSETable.predefinedLiteralLengths
+            case .matchLengths: return FSETable.predefinedMatchLengths
+            case .offsets: return FSETable.predefinedOffsets
+            case .huffmanWeights: return nil
+            }
+        }
+
+    }
+
+    let accuracyLog: Int
+    let symbols: [UInt8]
+    private let bitCounts: [UInt8]
+    private let baselines: [Int]
+
+    /// Builds a decoding table from normalized counts that sum to `1 << accuracyLog`.
+    ///
+    /// A count of `-1` marks a "less than 1" probability symbol that gets a single cell at the end of the table.
+    init(accuracyLog: Int, normalizedCounts: [Int]) {
+        let tableSize = 1 << accuracyLog
+        var symbols = [UInt8](repeating: 0, count: tableSize)
+        var nextStates = [Int](repeating: 0, count: normalizedCounts.count)
+        var highThreshold = tableSize - 1
+
+        for (symbol, count) in normalizedCounts.enumerated() {
+            if count == -1 {
+                symbols[highThreshold] = UInt8(symbol)
+                highThreshold -= 1
+                nextStates[symbol] = 1
+            } else {
+                nextStates[symbol] = count
+            }
+        }
+
+        let step = (tableSize >> 1) + (tableSize >> 3) + 3
+        let mask = tableSize - 1
+        var position = 0
+        for (symbol, count) in normalizedCounts.enumerated() where count > 0 {
+            for _ in 0..<count {
+                symbols[position] = UInt8(symbol)
+                repeat {
+                    position = (position + step) & mask
+                } while position > highThreshold
+            }
+        }
+
+        var bitCounts = [UInt8](repeating: 0, count: tableSize)
+        var baselines = [Int](repeating: 0, count: tableSize)
+        for state in 0..<tableSize {
+            let symbol = Int(symbols[state])
+            let nextState = nextStates[symbol]
+            nextStates[symbol] += 1
+
+            let bitCount = accuracyLog - nextState.highestBitIndex
+            bitCounts[state] = UInt8(bitCount)
+            baselines[state] = (nextState << bitCount) - tableSize
+        }
+
+        self.accuracyLog = accuracyLog
+        self.symbols = symbols
+        self.bitCounts = bitCounts
+        self.baselines = baselines
+    }
+
+    private init(rleSymbol: UInt8) {
+        self.accuracyLog = 0
+        self.symbols = [rleSymbol]
+        self.bitCounts = [0]
+        self.baselines = [0]
+    }
+
+    static func rle(symbol: UInt8) -> Self {
+        return .init(rleSymbol: symbol)
+    }
+
+    func nextState(after state: Int, reading bits: inout BackwardBitReader) -> Int {
+        return self.baselines[state] + Int(bits.read(Int(self.bitCounts[state])))
+    }
+
+    /// Reads an FSE table description and returns the table plus the number of bytes it used.
+    static func read(from input: ZstdInput, at offset: Int, kind: Kind) throws -> (table: Self, byteCount: Int) {
+        try input.require(offset + 1)
+
+        var bits = ForwardBitReader(input, byteOffset: offset)
+        let accuracyLog = Int(bits.read(4)) + 5
+        guard accuracyLog <= kind.maximumAccuracyLog else { throw ZstdInput.malformed }
+
+        var remaining = (1 << accuracyLog) + 1
+        var threshold = 1 << accuracyLog
+        var bitCount = accuracyLog + 1
+        var counts: [Int] = []
+        var previousWasZero = false
+
+        while remaining > 1 && counts.count <= kind.maximumSymbol {
+            if previousWasZero {
+                var repeatCount = Int(bits.read(2))
+                while repeatCount == 3 {
+                    counts.append(contentsOf: [0, 0, 0])
+                    repeatCount = Int(bits.read(2))
+                }
+                counts.append(contentsOf: repeatElement(0, count: repeatCount))
+                guard counts.count <= kind.maximumSymbol else { throw ZstdInput.malformed }
+            }
+
+            let maximum = (2 * threshold - 1) - remaining
+            var count: Int
+            let lowBits = Int(bits.peek(bitCount - 1))
+            if lowBits < maximum {
+                count = lowBits
+                bits.skip(bitCount - 1)
+            } else {
+                count = Int(bits.peek(bitCount))
+                if count >= threshold {
+                    count -= maximum
+                }
+                bits.skip(bitCount)
+            }
+
+            count -= 1
+            remaining -= abs(count)
+            counts.append(count)
+            previousWasZero = count == 0
+
+            while remaining < threshold {
+                bitCount -= 1
+                threshold >>= 1
+            }
+        }
+
+        let byteCount = bits.consumedByteCount(from: offset)
+        guard remaining == 1, offset + byteCount <= input.count else { throw ZstdInput.malformed }
+
+        return (.init(accuracyLog: accuracyLog, normalizedCounts: counts), byteCount)
+    }
+
+    static let predefinedLiteralLengths = FSETable(accuracyLog: 6, normalizedCounts: [
+        4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1, 1, 1,
+        -1, -1, -1, -1
+    ])
+
+    static let predefinedMatchLengths = FSETable(accuracyLog: 6, normalizedCounts: [
+        1, 4, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1
+    ])
+
+    static let predefinedOffsets = FSETable(accuracyLog: 5, normalizedCounts: [
+        1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1
+    ])
+
+}
+
+/// Huffman decoding table for literals (RFC 8878, section 4.2).
+private struct HuffmanTable {
+
+    private let maximumBitCount: Int
+    private let symbols: [UInt8]
+    private let bitCounts: [UInt8]
+
+    /// Reads a Huffman tree description and returns the table plus the number of bytes it used.
+    static func read(from input: ZstdInput, at offset: Int) throws -> (table: Self, byteCount: Int) {
+        let header = Int(try input.byte(at: offset))
+        var weights: [Int] = []
+
+        if header >= 128 {
+            let weightCount = header - 127
+            let weightBytes = try input.slice(offset + 1, count: (weightCount + 1) / 2)
+            for index in 0..<weightCount {
+                let byte = weightBytes[index / 2]
+                weights.append(Int(index.isMultiple(of: 2) ? byte >> 4 : byte & 0x0F))
+            }
+
+            return (try .init(weights: weights), 1 + weightBytes.count)
+        }
+
+        let description = ZstdInput(try input.slice(offset + 1, count: header))
+        let fse = try FSETable.read(from: description, at: 0, kind: .huffmanWeights)
+        var bits = try BackwardBitReader(try description.slice(fse.byteCount, count: header - fse.byteCount))
+
+        // Two interleaved states share one bitstream; once it is exhausted, the other state's symbol is final.
+        var states = [Int(bits.read(fse.table.accuracyLog)), Int(bits.read(fse.table.accuracyLog))]
+        var current = 0
+        while true {
+            weights.append(Int(fse.table.symbols[states[current]]))
+            states[current] = fse.table.nextState(after: states[current], reading: &bits)
+
+            if bits.isOverflowed {
+                weights.append(Int(fse.table.symbols[states[1 - current]]))
+                break
+            }
+
+            guard weights.count < Self.maximumSymbolCount else { throw ZstdInput.malformed }
+            current = 1 - current
+        }
+
+        return (try .init(weights: weights), 1 + header)
+    }
+
+    /// Builds the table from explicit weights; the final symbol's weight is implied by the others.
+    private init(weights explicitWeights: [Int]) throws {
+        guard explicitWeights.count < Self.maximumSymbolCount,
+              explicitWeights.allSatisfy({ $0 <= Self.maximumBitCountLimit }) else {
+            throw ZstdInput.malformed
+        }
+
+        let total = explicitWeights.reduce(0) { $0 + ($1 > 0 ? 1 << ($1 - 1) : 0) }
+        guard total > 0 else { throw ZstdInput.malformed }
+
+        let maximumBitCount = total.highestBitIndex + 1
+        let remainder = (1 << maximumBitCount) - total
+        guard maximumBitCount <= Self.maximumBitCountLimit, remainder & (remainder - 1) == 0 else {
+            throw ZstdInput.malformed
+        }
+
+        let weights = explicitWeights + [remainder.highestBitIndex + 1]
+
+        var rankStarts = [Int](repeating: 0, count: maximumBitCount + 2)
+        var nextRankStart = 0
+        for weight in 1...maximumBitCount {
+            rankStarts[weight] = nextRankStart
+            nextRankStart += weights.filter { $0 == weight }.count << (weight - 1)
+        }
+
+        let tableSize = 1 << maximumBitCount
+        var symbols = [UInt8](repeating: 0, count: tableSize)
+        var bitCounts = [UInt8](repeating: 0, count: tableSize)
+        for (symbol, weight) in weights.enumerated() where weight > 0 {
+            let length = (1 << weight) >> 1
+            for index in rankStarts[weight]..<rankStarts[weight] + length {
+                symbols[index] = UInt8(symbol)
+                bitCounts[index] = UInt8(maximumBitCount + 1 - weight)
+            }
+            rankStarts[weight] += length
+        }
+
+        self.maximumBitCount = maximumBitCount
+        self.symbols = symbols
+        self.bitCounts = bitCounts
+    }
+
+    /// Decodes exactly `count` literals from one Huffman stream, which must be fully consumed.
+    func decode(_ stream: UnsafeRawBufferPointer, count: Int, into literals: inout [UInt8]) throws {
+        var bits = try BackwardBitReader(stream)
+        for _ in 0..<count {
+            let index = Int(bits.peek(self.maximumBitCount))
+            literals.append(self.symbols[index])
+            bits.skip(Int(self.bitCounts[index]))
+        }
+
+        guard bits.bitsRemaining == 0 else { throw ZstdInput.malformed }
+    }
+
+    private static let maximumSymbolCount = 256
+    private static let maximumBitCountLimit = 11
+
+}
+
+private enum SequenceCodes {
+
+    static let literalLengthBaselines = Array(0..<16) + [
+        16, 18, 20, 22, 24, 28, 32, 40, 48, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768, 65536
+    ]
+    static let literalLengthExtraBits = [Int](repeating: 0, count: 16) + [
+        1, 1, 1, 1, 2, 2, 3, 3, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16
+    ]
+    static let matchLengthBaselines = Array(3..<35) + [
+        35, 37, 39, 41, 43, 47, 51, 59, 67, 83, 99, 131, 259, 515, 1027, 2051, 4099, 8195, 16387, 32771, 65539
+    ]
+    static let matchLengthExtraBits = [Int](repeating: 0, count: 32) + [
+        1, 1, 1, 1, 2, 2, 3, 3, 4, 4, 5, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16
+    ]
+
+}
+
+// MARK: - Byte and bit access
+
+/// Bounds-checked view over compressed bytes. Malformed input must throw rather than trap.
+private struct ZstdInput {
+
+    static let malformed = RCContainer.Parser.FormatError.contentDecompressionFailed(
+        RCContainer.Element.ContentEncoding.zstd.rawValue
+    )
+
+    let bytes: UnsafeRawBufferPointer
+
+    init(_ bytes: UnsafeRawBufferPointer) {
+        self.bytes = bytes
+    }
+
+    var count: Int {
+        return self.bytes.count
+    }
+
+    func require(_ endOffset: Int) throws {
+        guard endOffset >= 0, endOffset <= self.bytes.count else { throw Self.malformed }
+    }
+
+    func byte(at offset: Int) throws -> UInt8 {
+        guard offset >= 0, offset < self.bytes.count else { throw Self.malformed }
+        return self.bytes[offset]
+    }
+
+    func slice(_ offset: Int, count: Int) throws -> UnsafeRawBufferPointer {
+        guard count >= 0, offset >= 0 else { throw Self.malformed }
+        try self.require(offset + count)
+        return UnsafeRawBufferPointer(rebasing: self.bytes[offset..<offset + count])
+    }
+
+    func littleEndianValue(at offset: Int, count: Int) throws -> UInt64 {
+        try self.require(offset + count)
+        return (0..<count).reversed().reduce(0) { value, index in
+            value << 8 | UInt64(self.bytes[offset + index])
+        }
+    }
+
+    /// Callers must have checked that the bytes are available.
+    func littleEndianUInt16(at offset: Int) -> UInt16 {
+        return UInt16(self.bytes[offset]) | UInt16(self.bytes[offset + 1]) << 8
+    }
+
+    /// Callers must have checked that the bytes are available.
+    func littleEndianUInt24(at offset: Int) -> UInt32 {
+        return UInt32(self.bytes[offset]) | UInt32(self.bytes[offset + 1]) << 8 | UInt32(self.bytes[offset + 2]) << 16
+    }
+
+    /// Callers must have checked that the bytes are available.
+    func littleEndianUInt32(at offset: Int) -> UInt32 {
+        return self.littleEndianUInt24(at: offset) | UInt32(self.bytes[offset + 3]) << 24
+    }
+
+}
+
+/// Reads a little-endian bitstream from low to high bits, as used by FSE table descriptions.
+private struct ForwardBitReader {
+
+    private let input: ZstdInput
+    private var bitOffset: Int
+
+    init(_ input: ZstdInput, byteOffset: Int) {
+        self.input = input
+        self.bitOffset = byteOffset * 8
+    }
+
+    /// Returns the next `count` bits (at most 32) without consuming them.
+    /// Bits past the end of the input read as zero; callers validate the consumed size afterwards.
+    func peek(_ count: Int) -> UInt64 {
+        let word = self.input.bytes.littleEndianWord(at: self.bitOffset >> 3)
+        return (word >> UInt64(self.bitOffset & 7)) & ((1 << UInt64(count)) - 1)
+    }
+
+    mutating func read(_ count: Int) -> UInt64 {
+        defer { self.skip(count) }
+        return self.peek(count)
+    }
+
+    mutating func skip(_ count: Int) {
+        self.bitOffset += count
+    }
+
+    func consumedByteCount(from byteOffset: Int) -> Int {
+        return (self.bitOffset + 7) / 8 - byteOffset
+    }
+
+}
+
+/// Reads a bitstream backwards from its final set bit, as used by Huffman and FSE coded data.
+private struct BackwardBitReader {
+
+    private let bytes: UnsafeRawBufferPointer
+
+    /// Bits left before the start of the stream. Negative once a read went past the start.
+    private(set) var bitsRemaining: Int
+
+    init(_ bytes: UnsafeRawBufferPointer) throws {
+        guard let lastByte = bytes.last, lastByte != 0 else { throw ZstdInput.malformed }
+
+        self.bytes = bytes
+        self.bitsRemaining = (bytes.count - 1) * 8 + (7 - lastByte.leadingZeroBitCount)
+    }
+
+    var isOverflowed: Bool {
+        return self.bitsRemaining < 0
+    }
+
+    /// Returns the next `count` bits (at most 32) without consuming them. Bits before the start read as zero.
+    func peek(_ count: Int) -> UInt64 {
+        guard count > 0 else { return 0 }
+
+        let lowBit = self.bitsRemaining - count
+        if lowBit >= 0 {
+            return self.bits(from: lowBit, count: count)
+        }
+
+        guard self.bitsRemaining > 0 else { return 0 }
+        return self.bits(from: 0, count: self.bitsRemaining) << UInt64(-lowBit)
+    }
+
+    mutating func read(_ count: Int) -> UInt64 {
+        defer { self.skip(count) }
+        return self.peek(count)
+    }
+
+    mutating func skip(_ count: Int) {
+        self.bitsRemaining -= count
+    }
+
+    private func bits(from lowBit: Int, count: Int) -> UInt64 {
+        let word = self.bytes.littleEndianWord(at: lowBit >> 3)
+        return (word >> UInt64(lowBit & 7)) & ((1 << UInt64(count)) - 1)
+    }
+
+}
+
+private extension UnsafeRawBufferPointer {
+
+    /// Loads the 8 bytes starting at `offset` as a little-endian value. Bytes past the end read as zero.
+    func littleEndianWord(at offset: Int) -> UInt64 {
+        if offset + 8 <= self.count {
+            return UInt64(littleEndian: self.loadUnaligned(fromByteOffset: offset, as: UInt64.self))
+        }
+
+        var value: UInt64 = 0
+        var index = self.count - 1
+        while index >= offset {
+            value = value << 8 | UInt64(self[index])
+            index -= 1
+        }
+        return value
+    }
+
+}
+
+private extension Int {
+
+    /// Index of the most significant set bit. Only valid for positive values.
+    var highestBitIndex: Int {
+        return Self.bitWidth - 1 - self.leadingZeroBitCount
+    }
+
+}
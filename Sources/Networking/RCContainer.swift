@@ -18,13 +18,22 @@ import Foundation
 /// Elements repeat until the backing data is exhausted (the format stores no count). The final
 /// element may omit trailing padding. Padding length is derived from the element's wire payload size.
 ///
-/// Elements are stored in wire order and keyed by their checksum encoded as a 32-character URL-safe
-/// base64 string with no padding. Checksums are SHA-256 truncated to 24 bytes over the decoded
-/// payload bytes, so compressed elements must be decompressed before checksum validation.
+/// Elements are stored in wire order and keyed by their raw 24-byte checksum. Externally, checksums are
+/// referenced as 32-character URL-safe base64 strings with no padding. Checksums are SHA-256 truncated
+/// to 24 bytes over the decoded payload bytes, so compressed elements must be decompressed before
+/// checksum validation.
 ///
 /// `Element` exposes raw payload access backed by the original container data, so parsing does not
 /// create per-element `Data` copies. Decoded payload access stays closure-based too, but compressed
 /// elements necessarily materialize temporary decoded bytes.
+///
+/// `.zstd` elements may be compressed against a zstd dictionary shipped as an uncompressed element of the
+/// same container. Such dictionaries are recognized by their magic number the first time one of the
+/// container's `.zstd` elements is decoded.
+///
+/// Containers persisted on disk can be opened with `init(contentsOf:backing:)`, which memory-maps the file
+/// so elements borrow from mapped pages instead of a heap copy of the whole container. Containers persisted
+/// with `persist(_:to:)` also get an `ElementIndex` sidecar that lets them reopen without a header walk.
 struct RCContainer {
 
     /// Format flags from the container header.
@@ -36,24 +45,41 @@ struct RCContainer {
     /// Elements in the order they appear in the container.
     let elements: [Element]
 
-    /// Elements keyed by their externally-referenced blob ref string.
+    /// Elements keyed by their raw checksum.
     ///
     /// If the container contains duplicate checksums, the last element wins to match the
     /// content lookup behavior used by the backend and Android parser.
-    let elementsByChecksum: [String: Element]
+    let elementsByChecksumKey: [ChecksumKey: Element]
+
+    /// Elements keyed by their externally-referenced blob ref string.
+    ///
+    /// Built on each access; use `element(withChecksum:)` to look up a single ref.
+    var elementsByChecksum: [String: Element] {
+        return Dictionary(
+            self.elementsByChecksumKey.map { ($0.key.ref, $0.value) },
+            uniquingKeysWith: { _, last in last }
+        )
+    }
 
     init(
         flags: UInt8,
         elements: [Element]
     ) {
+        let elements = Self.bindingZstdDictionaries(to: elements)
+
         self.flags = flags
         self.elements = elements
-        self.elementsByChecksum = Dictionary(
-            elements.map { ($0.checksum, $0) },
+        self.elementsByChecksumKey = Dictionary(
+            elements.map { ($0.checksumKey, $0) },
             uniquingKeysWith: { _, last in last }
         )
     }
 
+    /// Returns the element whose checksum is the blob ref `ref`, or `nil` if `ref` is not a valid ref.
+    func element(withChecksum ref: String) -> Element? {
+        return ChecksumKey(ref: ref).flatMap { self.elementsByChecksumKey[$0] }
+    }
+
     /// Parses and structurally validates an RC Container while retaining the original `Data` backing storage.
     ///
     /// Element payloads are exposed through closure-based byte access on `Element`, so constructing the
@@ -65,4 +91,58 @@ struct RCContainer {
         self.init(flags: parsed.flags, elements: parsed.elements)
     }
 
+    /// Parses an RC Container persisted at `url`.
+    ///
+    /// With `.memoryMapped`, reopening a large cached container costs page faults for the bytes that are
+    /// actually touched rather than a full read plus heap copy. Files below `Backing.minimumMappedFileSize`
+    /// and volumes where mapping is unsafe fall back to the copy-based backing.
+    ///
+    /// Mapped containers must only be replaced through atomic writes (write + rename). Truncating a mapped
+    /// file in place would invalidate pages that elements may still reference.
+    ///
+    /// Containers written with `persist(_:to:)` are reopened from their `ElementIndex` sidecar, so no element
+    /// header is read until an element is used. A missing or stale index falls back to a full parse.
+    init(contentsOf url: URL, backing: Backing = .memoryMapped) throws {
+        let data = try Data(contentsOf: url, options: backing.readingOptions(for: url))
+
+        if let index = Self.validElementIndex(forContainerAt: url),
+           let container = RCContainer(data: data, index: index) {
+            self = container
+        } else {
+            try self.init(data: data)
+        }
+    }
+
+}
+
+extension RCContainer {
+
+    /// How container bytes read from disk are held in memory.
+    enum Backing {
+
+        /// Maps the file into memory so pages are faulted in on access.
+        case memoryMapped
+
+        /// Reads the whole file into heap memory.
+        case copied
+
+        /// Smaller files are cheaper to read outright than to map and fault in page by page.
+        static let minimumMappedFileSize = 64 * 1024
+
+        func readingOptions(for url: URL) -> Data.ReadingOptions {
+            switch self {
+            case .copied:
+                return []
+            case .memoryMapped:
+                guard let fileSize = try? url.resourceValues(forKeys: [.fileSizeKey]).fileSize,
+                      fileSize >= Self.minimumMappedFileSize else {
+                    return []
+                }
+
+                return .mappedIfSafe
+            }
+        }
+
+    }
+
 }
@@ -115,6 +115,9 @@ struct RemoteConfigFallbackFetchResult {
 
 struct RemoteConfigContainer {
 
+    /// Raw response bytes that `rcContainer` was parsed from.
+    let data: Data
+
     /// Underlying generic RC Container parsed from the remote config response.
     let rcContainer: RCContainer
 
@@ -131,12 +134,9 @@ struct RemoteConfigContainer {
     /// to the blob store.
     init(data: Data) throws {
         let container = try RCContainer(data: data)
-        try self.init(rcContainer: container)
-    }
-
-    init(rcContainer container: RCContainer) throws {
         let configElement = try Self.configElement(in: container)
 
+        self.data = data
         self.rcContainer = container
         self.configElement = configElement
         self.inlineContentElements = Dictionary(
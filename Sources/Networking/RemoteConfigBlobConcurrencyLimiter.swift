@@ -0,0 +1,116 @@
+//
+//  RemoteConfigBlobConcurrencyLimiter.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+
+/// Additive-increase/multiplicative-decrease limit on parallel remote config blob downloads.
+///
+/// Every download that finishes while more work is waiting grows the limit by `1 / limit`, so a fully used
+/// limit rises by about one per round of downloads. Failures that point at the network halve it, and so does
+/// a download whose latency climbs past `latencyTolerance` times the fastest recent one, which catches
+/// queueing before it turns into timeouts. Latency is measured per `latencyUnitByteCount` so large blobs
+/// are not mistaken for congestion. Downloads that started before the last decrease cannot trigger another,
+/// so a burst of failures from one congestion event only backs off once.
+struct RemoteConfigBlobConcurrencyLimiter {
+
+    enum Outcome: Equatable {
+
+        case success(latency: TimeInterval, byteCount: Int)
+
+        /// A timeout, connection or server failure that suggests too many parallel downloads.
+        case congestion
+
+        /// A failure that says nothing about network capacity, such as a missing or invalid blob.
+        case ignored
+
+    }
+
+    static let defaultInitialLimit = 4
+    static let defaultMinimumLimit = 1
+    static let defaultMaximumLimit = 16
+
+    static let latencyTolerance = 2.0
+    static let latencyUnitByteCount = 64 * 1024
+    static let decreaseFactor = 0.5
+
+    /// Growth of the latency baseline per recorded download, so that one unusually fast download does not
+    /// make every later one look congested.
+    static let baselineDrift = 1.05
+
+    /// Latencies below this are treated as equal, so scheduling jitter on very fast downloads is not
+    /// mistaken for congestion.
+    static let latencyFloor: TimeInterval = 0.1
+
+    let minimumLimit: Int
+    let maximumLimit: Int
+
+    /// Incremented on every decrease; downloads carry the value from when they started.
+    private(set) var generation = 0
+
+    private var window: Double
+    private var baselineLatency: TimeInterval?
+
+    init(
+        initialLimit: Int = RemoteConfigBlobConcurrencyLimiter.defaultInitialLimit,
+        minimumLimit: Int = RemoteConfigBlobConcurrencyLimiter.defaultMinimumLimit,
+        maximumLimit: Int = RemoteConfigBlobConcurrencyLimiter.defaultMaximumLimit
+    ) {
+        self.minimumLimit = minimumLimit
+        self.maximumLimit = maximumLimit
+        self.window = Double(min(max(initialLimit, minimumLimit), maximumLimit))
+    }
+
+    /// The number of downloads allowed to run at once.
+    var limit: Int {
+        return Int(self.window)
+    }
+
+    /// Updates the limit for a finished download and returns whether `limit` changed.
+    ///
+    /// - Parameters:
+    ///   - generation: The value of `generation` when the download started.
+    ///   - hadQueuedWork: Whether other downloads were waiting for a slot, which is the only time a higher
+    ///   limit would have helped.
+    @discardableResult
+    mutating func record(_ outcome: Outcome, startedInGeneration generation: Int, hadQueuedWork: Bool) -> Bool {
+        let previousLimit = self.limit
+
+        switch outcome {
+        case .ignored:
+            break
+        case .congestion:
+            self.decrease(startedInGeneration: generation)
+        case let .success(latency, byteCount):
+            let units = max(1, Double(byteCount) / Double(Self.latencyUnitByteCount))
+            let unitLatency = latency / units
+            let baseline = min(unitLatency, self.baselineLatency.map { $0 * Self.baselineDrift } ?? unitLatency)
+            self.baselineLatency = baseline
+
+            if unitLatency > max(baseline, Self.latencyFloor) * Self.latencyTolerance {
+                self.decrease(startedInGeneration: generation)
+            } else if hadQueuedWork {
+                self.window = min(Double(self.maximumLimit), self.window + 1 / self.window)
+            }
+        }
+
+        return self.limit != previousLimit
+    }
+
+}
+
+private extension RemoteConfigBlobConcurrencyLimiter {
+
+    mutating func decrease(startedInGeneration generation: Int) {
+        guard generation == self.generation else {
+            return
+        }
+
+        self.window = max(Double(self.minimumLimit), (self.window * Self.decreaseFactor).rounded(.down))
+        self.generation += 1
+    }
+
+}
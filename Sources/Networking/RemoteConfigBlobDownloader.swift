@@ -11,6 +11,18 @@ protocol RemoteConfigBlobDownloaderType: AnyObject {
 
     func data(from url: URL) async throws -> Data
 
+    /// Like `data(from:)`, but only requests the bytes after `partial.prefix` and saves what it received
+    /// into `partial` if the attempt is interrupted. Returns the whole blob, prefix included.
+    func data(from url: URL, resuming partial: RemoteConfigBlobPartialDownload) async throws -> Data
+
+}
+
+extension RemoteConfigBlobDownloaderType {
+
+    func data(from url: URL, resuming partial: RemoteConfigBlobPartialDownload) async throws -> Data {
+        return try await self.data(from: url)
+    }
+
 }
 
 /// Small `URLSession.dataTask` async adapter for remote config blobs.
@@ -26,16 +38,25 @@ final class URLSessionRemoteConfigBlobDownloader: RemoteConfigBlobDownloaderType
 
     private let session: URLSession
     private let timeoutManager: HTTPRequestTimeoutManagerType
+    private let sourceHealthMonitor: SourceHealthMonitorType?
+    private let dateProvider: DateProvider
 
-    convenience init(timeoutManager: HTTPRequestTimeoutManagerType) {
+    convenience init(timeoutManager: HTTPRequestTimeoutManagerType,
+                     sourceHealthMonitor: SourceHealthMonitorType? = nil) {
         let ceiling = timeoutManager.blobDownloadTimeoutCeiling
         self.init(timeoutManager: timeoutManager,
-                  session: URLSession(configuration: Self.sessionConfiguration(timeoutCeiling: ceiling)))
+                  session: URLSession(configuration: Self.sessionConfiguration(timeoutCeiling: ceiling)),
+                  sourceHealthMonitor: sourceHealthMonitor)
     }
 
-    init(timeoutManager: HTTPRequestTimeoutManagerType, session: URLSession) {
+    init(timeoutManager: HTTPRequestTimeoutManagerType,
+         session: URLSession,
+         sourceHealthMonitor: SourceHealthMonitorType? = nil,
+         dateProvider: DateProvider = DateProvider()) {
         self.timeoutManager = timeoutManager
         self.session = session
+        self.sourceHealthMonitor = sourceHealthMonitor
+        self.dateProvider = dateProvider
     }
 
     static func sessionConfiguration(timeoutCeiling: TimeInterval) -> URLSessionConfiguration {
@@ -49,27 +70,97 @@ final class URLSessionRemoteConfigBlobDownloader: RemoteConfigBlobDownloaderType
     }
 
     func data(from url: URL) async throws -> Data {
-        let host = url.host
+        let request = self.request(for: url)
 
+        return try await self.recordingResult(for: url) {
+            try await self.performRequest(request)
+        }
+    }
+
+    /// Resumes with a `Range` request where per-task delegates are available, which is what lets the received
+    /// bytes be kept when the request fails. Older systems always download the whole blob.
+    func data(from url: URL, resuming partial: RemoteConfigBlobPartialDownload) async throws -> Data {
+        guard #available(iOS 15.0, macOS 12.0, tvOS 15.0, watchOS 8.0, *) else {
+            return try await self.data(from: url)
+        }
+
+        var request = self.request(for: url)
+        if !partial.prefix.isEmpty {
+            request.setValue("bytes=\(partial.prefix.count)-",
+                             forHTTPHeaderField: HTTPClient.RequestHeader.range.rawValue)
+        }
+
+        do {
+            return try await self.recordingResult(for: url) {
+                try await self.performRequest(request, resuming: partial)
+            }
+        } catch Error.unexpectedStatusCode(HTTPStatusCode.rangeNotSatisfiable.rawValue) {
+            // The kept prefix does not fit this blob, so it cannot be resumed.
+            partial.discard()
+            return try await self.data(from: url)
+        }
+    }
+
+    private func request(for url: URL) -> URLRequest {
         var request = URLRequest(url: url)
-        request.timeoutInterval = self.timeoutManager.blobDownloadTimeout(host: host)
+        request.timeoutInterval = self.timeoutManager.blobDownloadTimeout(host: url.host)
+        return request
+    }
+
+    private func recordingResult(for url: URL, _ download: () async throws -> Data) async throws -> Data {
+        let host = url.host
+        let startTime = self.dateProvider.now()
 
         do {
-            let data = try await self.performRequest(request)
+            let data = try await download()
             self.timeoutManager.recordRequestResult(host: host, .successOnMainBackend)
+            self.sourceHealthMonitor?.record(
+                .success(latency: self.dateProvider.now().timeIntervalSince(startTime)),
+                host: host
+            )
             return data
         } catch {
             self.timeoutManager.recordRequestResult(
                 host: host,
                 error.isURLRequestTimeout ? .mainSourceTimedOut : .other
             )
+            if let outcome = Self.sourceHealthOutcome(
+                for: error,
+                latency: self.dateProvider.now().timeIntervalSince(startTime)
+            ) {
+                self.sourceHealthMonitor?.record(outcome, host: host)
+            }
             throw error
         }
     }
 
+    /// What a failed download says about its source, or `nil` if it says nothing: cancelled requests (e.g. the
+    /// losing side of a hedge) and device-connectivity failures. 4xx responses mean the source answered.
+    private static func sourceHealthOutcome(
+        for error: Swift.Error,
+        latency: TimeInterval
+    ) -> SourceHealthMonitor.Outcome? {
+        if error.isURLRequestTimeout {
+            return .timeout
+        }
+
+        switch error {
+        case let Error.unexpectedStatusCode(statusCode):
+            return HTTPStatusCode(rawValue: statusCode).isServerError ? .failure : .success(latency: latency)
+        case Error.invalidResponse:
+            return .failure
+        default:
+            let error = error as NSError
+            if error.domain == NSURLErrorDomain && error.code == NSURLErrorCancelled {
+                return nil
+            }
+            return NetworkError.networkError(error).isDeviceConnectivityError ? nil : .failure
+        }
+    }
+
     private func performRequest(_ request: URLRequest) async throws -> Data {
-        return try await withCheckedThrowingContinuation { continuation in
-            let task = self.session.dataTask(with: request) { data, response, error in
+        return try await self.perform { continuation in
+            self.session.dataTask(with: request) { data, response, error in
                 if let error {
                     continuation.resume(throwing: error)
                     return
@@ -87,11 +178,131 @@ final class URLSessionRemoteConfigBlobDownloader: RemoteConfigBlobDownloaderType
 
                 continuation.resume(returning: data ?? Data())
             }
+        }
+    }
 
-            task.resume()
+    @available(iOS 15.0, macOS 12.0, tvOS 15.0, watchOS 8.0, *)
+    private func performRequest(
+        _ request: URLRequest,
+        resuming partial: RemoteConfigBlobPartialDownload
+    ) async throws -> Data {
+        return try await self.perform { continuation in
+            let task = self.session.dataTask(with: request)
+            task.delegate = ResumableDataTaskDelegate(partial: partial, continuation: continuation)
+            return task
         }
     }
 
+    /// Runs the task built by `makeTask`, cancelling it if the calling task is cancelled, e.g. when a hedged
+    /// request for the same blob wins. `makeTask` must resume the continuation exactly once.
+    private func perform(
+        _ makeTask: @escaping (CheckedContinuation<Data, Swift.Error>) -> URLSessionDataTask
+    ) async throws -> Data {
+        let dataTask: Atomic<URLSessionDataTask?> = nil
+
+        return try await withTaskCancellationHandler {
+            try await withCheckedThrowingContinuation { continuation in
+                let task = makeTask(continuation)
+                dataTask.value = task
+                task.resume()
+
+                // Cancellation may have raced ahead of the task being stored.
+                if Task.isCancelled {
+                    task.cancel()
+                }
+            }
+        } onCancel: {
+            dataTask.value?.cancel()
+        }
+    }
+
+}
+
+/// Collects the body of one resumed blob request and keeps what arrived if the request fails.
+///
+/// A `206 Partial Content` response is appended to the kept prefix. A `200 OK` means the source ignored
+/// the range, so the prefix is dropped and the body is the whole blob.
+///
+/// A request cancelled by its caller keeps nothing. That is the losing side of a hedge, and the request that
+/// won is completing the same blob: saving here could land after the winner discarded the partial and leave
+/// an orphaned file behind.
+@available(iOS 15.0, macOS 12.0, tvOS 15.0, watchOS 8.0, *)
+private final class ResumableDataTaskDelegate: NSObject, URLSessionDataDelegate {
+
+    private let partial: RemoteConfigBlobPartialDownload
+    private let continuation: CheckedContinuation<Data, Error>
+
+    // Only touched from the session's delegate queue, which is serial.
+    private var received = Data()
+    private var failure: Error?
+
+    init(partial: RemoteConfigBlobPartialDownload, continuation: CheckedContinuation<Data, Error>) {
+        self.partial = partial
+        self.continuation = continuation
+    }
+
+    func urlSession(
+        _ session: URLSession,
+        dataTask: URLSessionDataTask,
+        didReceive response: URLResponse,
+        completionHandler: @escaping (URLSession.ResponseDisposition) -> Void
+    ) {
+        guard let response = response as? HTTPURLResponse else {
+            self.failure = URLSessionRemoteConfigBlobDownloader.Error.invalidResponse
+            completionHandler(.cancel)
+            return
+        }
+
+        switch response.statusCode {
+        case HTTPStatusCode.success.rawValue:
+            self.received = Data()
+        case HTTPStatusCode.partialContent.rawValue
+            where Self.rangeStart(of: response) == self.partial.prefix.count:
+            self.received = self.partial.prefix
+        case HTTPStatusCode.partialContent.rawValue:
+            self.partial.discard()
+            self.failure = URLSessionRemoteConfigBlobDownloader.Error.invalidResponse
+            completionHandler(.cancel)
+            return
+        default:
+            self.failure = URLSessionRemoteConfigBlobDownloader.Error.unexpectedStatusCode(response.statusCode)
+            completionHandler(.cancel)
+            return
+        }
+
+        if let expectedLength = Int(exactly: response.expectedContentLength), expectedLength > 0 {
+            self.received.reserveCapacity(self.received.count + expectedLength)
+        }
+        completionHandler(.allow)
+    }
+
+    func urlSession(_ session: URLSession, dataTask: URLSessionDataTask, didReceive data: Data) {
+        self.received.append(data)
+    }
+
+    func urlSession(_ session: URLSession, task: URLSessionTask, didCompleteWithError error: Error?) {
+        if let failure = self.failure {
+            self.continuation.resume(throwing: failure)
+        } else if let error {
+            if self.received.count > self.partial.prefix.count, (error as? URLError)?.code != .cancelled {
+                self.partial.save(self.received)
+            }
+            self.continuation.resume(throwing: error)
+        } else {
+            self.continuation.resume(returning: self.received)
+        }
+    }
+
+    /// The first byte offset of a `Content-Range: bytes <start>-<end>/<length>` header.
+    private static func rangeStart(of response: HTTPURLResponse) -> Int? {
+        guard let contentRange = response.value(forHTTPHeaderField: HTTPClient.ResponseHeader.contentRange.rawValue),
+              contentRange.hasPrefix("bytes ") else {
+            return nil
+        }
+
+        return contentRange.dropFirst("bytes ".count).split(separator: "-").first.flatMap { Int($0) }
+    }
+
 }
 
 private extension HTTPRequestTimeoutManagerType {
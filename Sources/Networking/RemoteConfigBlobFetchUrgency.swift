@@ -0,0 +1,81 @@
+//
+//  RemoteConfigBlobFetchUrgency.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+
+/// How urgently a caller needs a remote config blob, used to order queued downloads.
+///
+/// Queued downloads with a deadline start first, earliest deadline first. The rest are ordered by `weight`,
+/// which ages while the download waits: every `agingInterval` in the queue adds the original weight again.
+/// A prefetch therefore catches up with a fresh on-demand request after waiting
+/// `(onDemand.weight / prefetch.weight - 1) * agingInterval`, so a burst of consumer requests cannot starve
+/// prefetches forever.
+struct RemoteConfigBlobFetchUrgency: Equatable {
+
+    static let agingInterval: TimeInterval = 2
+
+    /// Weights are clamped to this so that every download ages and eventually runs.
+    static let minimumWeight = 0.1
+
+    /// A consumer is waiting for the blob.
+    static let onDemand = RemoteConfigBlobFetchUrgency(weight: 4)
+
+    /// The blob is likely needed soon, but nobody is waiting for it yet.
+    static let prefetch = RemoteConfigBlobFetchUrgency(weight: 1)
+
+    let weight: Double
+    let deadline: Date?
+
+    init(weight: Double, deadline: Date? = nil) {
+        self.weight = max(weight, Self.minimumWeight)
+        self.deadline = deadline
+    }
+
+    /// A copy of this urgency that must be met by `deadline`.
+    func withDeadline(_ deadline: Date) -> Self {
+        return .init(weight: self.weight, deadline: self.deadline.map { min($0, deadline) } ?? deadline)
+    }
+
+    /// Combines two requests for the same blob, keeping the higher weight and the earlier deadline.
+    func merged(with other: Self) -> Self {
+        let merged = Self(weight: max(self.weight, other.weight), deadline: self.deadline)
+        return other.deadline.map(merged.withDeadline) ?? merged
+    }
+
+    /// The position of a request that has been queued for `wait`. Smaller keys start first.
+    func sortKey(afterWaiting wait: TimeInterval) -> SortKey {
+        return SortKey(
+            deadline: self.deadline,
+            agedWeight: self.weight * (1 + max(wait, 0) / Self.agingInterval)
+        )
+    }
+
+}
+
+extension RemoteConfigBlobFetchUrgency {
+
+    struct SortKey: Comparable {
+
+        let deadline: Date?
+        let agedWeight: Double
+
+        static func < (lhs: SortKey, rhs: SortKey) -> Bool {
+            switch (lhs.deadline, rhs.deadline) {
+            case let (lhsDeadline?, rhsDeadline?) where lhsDeadline != rhsDeadline:
+                return lhsDeadline < rhsDeadline
+            case (.some, nil):
+                return true
+            case (nil, .some):
+                return false
+            default:
+                return lhs.agedWeight > rhs.agedWeight
+            }
+        }
+
+    }
+
+}
@@ -13,12 +13,47 @@ protocol RemoteConfigBlobFetcherType {
     func ensureAllDownloaded(refs: [String]) async -> Bool
     func prefetch(refs: [String])
 
+    /// Like `ensureDownloaded(ref:)`, but queued with a caller-chosen weight and deadline.
+    func ensureDownloaded(ref: String, urgency: RemoteConfigBlobFetchUrgency) async -> Bool
+
+    /// Moves a ref that is still waiting in the download queue ahead of requests with later or no deadlines.
+    /// No-op if the ref is not queued.
+    func promote(ref: String, deadline: Date) async
+
+    /// How long `ref` waited in the download queue before its last download started, or has waited so far if
+    /// it is still queued. `nil` if the ref was never queued.
+    func queueWaitTime(for ref: String) async -> TimeInterval?
+
+    /// Forgets what is kept about refs outside `refs`, once the config no longer references them.
+    func retainOnly(_ refs: Set<String>)
+
+}
+
+extension RemoteConfigBlobFetcherType {
+
+    func ensureDownloaded(ref: String, urgency: RemoteConfigBlobFetchUrgency) async -> Bool {
+        return await self.ensureDownloaded(ref: ref)
+    }
+
+    func promote(ref: String, deadline: Date) async {}
+
+    func queueWaitTime(for ref: String) async -> TimeInterval? {
+        return nil
+    }
+
+    func retainOnly(_ refs: Set<String>) {}
+
 }
 
 /// Downloads remote config blobs into the same content-addressed store used for inline blobs.
 ///
-/// On-demand requests are high priority. Prefetches are low priority and can be boosted if a consumer
-/// later requests the same ref before the download starts.
+/// Queued downloads are ordered by `RemoteConfigBlobFetchUrgency`: deadlines first, then weights that age
+/// while waiting. Prefetches are boosted if a consumer requests the same ref before the download starts,
+/// and a queued ref can be promoted with a deadline. The number of parallel downloads adapts to the
+/// network through `RemoteConfigBlobConcurrencyLimiter`, and slow on-demand downloads are hedged against
+/// the next blob source as decided by `RemoteConfigBlobHedgingPolicy`. With a
+/// `RemoteConfigBlobPartialDownloadStore`, an interrupted download resumes where it stopped, even on another
+/// source.
 final class RemoteConfigBlobFetcher: RemoteConfigBlobFetcherType {
 
     private let scheduler: RemoteConfigBlobFetchScheduler
@@ -26,18 +61,32 @@ final class RemoteConfigBlobFetcher: RemoteConfigBlobFetcherType {
     init(
         blobStore: RemoteConfigBlobStoreType,
         sourceProvider: RemoteConfigSourceProviderType,
-        downloader: RemoteConfigBlobDownloaderType
+        downloader: RemoteConfigBlobDownloaderType,
+        concurrencyLimiter: RemoteConfigBlobConcurrencyLimiter = .init(),
+        hedgingPolicy: RemoteConfigBlobHedgingPolicy = .init(),
+        partialDownloads: RemoteConfigBlobPartialDownloadStore? = nil,
+        diagnosticsTracker: DiagnosticsTrackerType? = nil,
+        dateProvider: DateProvider = DateProvider()
     ) {
         self.scheduler = RemoteConfigBlobFetchScheduler(
             blobStore: blobStore,
             sourceProvider: sourceProvider,
-            downloader: downloader
+            downloader: downloader,
+            concurrencyLimiter: concurrencyLimiter,
+            hedgingPolicy: hedgingPolicy,
+            partialDownloads: partialDownloads,
+            diagnosticsTracker: diagnosticsTracker,
+            dateProvider: dateProvider
         )
     }
 
-    /// Ensures a consumer-requested blob is available locally, enqueueing high-priority work if needed.
+    /// Ensures a consumer-requested blob is available locally, enqueueing on-demand work if needed.
     func ensureDownloaded(ref: String) async -> Bool {
-        return await self.scheduler.ensureDownloaded(ref: ref)
+        return await self.scheduler.ensureDownloaded(ref: ref, urgency: .onDemand)
+    }
+
+    func ensureDownloaded(ref: String, urgency: RemoteConfigBlobFetchUrgency) async -> Bool {
+        return await self.scheduler.ensureDownloaded(ref: ref, urgency: urgency)
     }
 
     /// Ensures multiple consumer-requested blobs are available and returns whether all unique refs succeeded.
@@ -45,71 +94,99 @@ final class RemoteConfigBlobFetcher: RemoteConfigBlobFetcherType {
         return await self.scheduler.ensureAllDownloaded(refs: refs)
     }
 
-    /// Starts best-effort low-priority downloads for refs the backend suggests warming.
+    /// Starts best-effort prefetch downloads for refs the backend suggests warming.
     func prefetch(refs: [String]) {
         Task {
             await self.scheduler.prefetch(refs: refs)
         }
     }
 
-}
+    func promote(ref: String, deadline: Date) async {
+        await self.scheduler.promote(ref: ref, deadline: deadline)
+    }
 
-private actor RemoteConfigBlobFetchScheduler {
+    func queueWaitTime(for ref: String) async -> TimeInterval? {
+        return await self.scheduler.queueWaitTime(for: ref)
+    }
 
-    private enum Priority: Int {
-        case low
-        case high
+    func retainOnly(_ refs: Set<String>) {
+        Task {
+            await self.scheduler.retainOnly(refs)
+        }
     }
 
+}
+
+private actor RemoteConfigBlobFetchScheduler {
+
     private struct Download {
         let ref: String
-        var priority: Priority
+        let enqueuedAt: Date
+        var urgency: RemoteConfigBlobFetchUrgency
         var sequence: Int
         var continuations: [CheckedContinuation<Bool, Never>]
     }
 
-    private static let maxConcurrentDownloads = 4
     private static let blobRefPlaceholder = "{blob_ref}"
 
     private let blobStore: RemoteConfigBlobStoreType
     private let sourceProvider: RemoteConfigSourceProviderType
     private let downloader: RemoteConfigBlobDownloaderType
+    private let partialDownloads: RemoteConfigBlobPartialDownloadStore?
+    private let diagnosticsTracker: DiagnosticsTrackerType?
+    private let dateProvider: DateProvider
 
     private var queued: [String: Download] = [:]
     private var activeContinuations: [String: [CheckedContinuation<Bool, Never>]] = [:]
     private var inFlight: Set<String> = []
+    private var queueWaitTimes: [String: TimeInterval] = [:]
     private var sequence = 0
+    private var concurrencyLimiter: RemoteConfigBlobConcurrencyLimiter
+    private var hedgingPolicy: RemoteConfigBlobHedgingPolicy
+
+    /// The limit last sent to diagnostics, which happens once the scheduler goes idle.
+    private var reportedConcurrencyLimit: Int?
 
     init(
         blobStore: RemoteConfigBlobStoreType,
         sourceProvider: RemoteConfigSourceProviderType,
-        downloader: RemoteConfigBlobDownloaderType
+        downloader: RemoteConfigBlobDownloaderType,
+        concurrencyLimiter: RemoteConfigBlobConcurrencyLimiter,
+        hedgingPolicy: RemoteConfigBlobHedgingPolicy,
+        partialDownloads: RemoteConfigBlobPartialDownloadStore?,
+        diagnosticsTracker: DiagnosticsTrackerType?,
+        dateProvider: DateProvider
     ) {
         self.blobStore = blobStore
         self.sourceProvider = sourceProvider
         self.downloader = downloader
+        self.concurrencyLimiter = concurrencyLimiter
+        self.hedgingPolicy = hedgingPolicy
+        self.partialDownloads = partialDownloads
+        self.diagnosticsTracker = diagnosticsTracker
+        self.dateProvider = dateProvider
     }
 
-    /// Enqueues a high-priority consumer request and suspends until that ref resolves.
-    func ensureDownloaded(ref: String) async -> Bool {
+    /// Enqueues a consumer request and suspends until that ref resolves.
+    func ensureDownloaded(ref: String, urgency: RemoteConfigBlobFetchUrgency) async -> Bool {
         return await withCheckedContinuation { continuation in
             self.enqueue(
                 ref: ref,
-                priority: .high,
+                urgency: urgency,
                 continuation: continuation,
                 restartsExhaustedSources: true
             )
         }
     }
 
-    /// Fans out high-priority requests for each unique ref and succeeds only if every ref is available.
+    /// Fans out on-demand requests for each unique ref and succeeds only if every ref is available.
     func ensureAllDownloaded(refs: [String]) async -> Bool {
         let uniqueRefs = Array(Set(refs))
 
         return await withTaskGroup(of: Bool.self) { group in
             for ref in uniqueRefs {
                 group.addTask {
-                    return await self.ensureDownloaded(ref: ref)
+                    return await self.ensureDownloaded(ref: ref, urgency: .onDemand)
                 }
             }
 
@@ -122,7 +199,7 @@ private actor RemoteConfigBlobFetchScheduler {
         }
     }
 
-    /// Enqueues low-priority work without a waiting continuation.
+    /// Enqueues prefetch work without a waiting continuation.
     func prefetch(refs: [String]) {
         let wouldDownload: (String) -> Bool = { ref in
             RemoteConfigBlobRefHelpers.isValid(ref) && !self.blobStore.contains(ref: ref)
@@ -135,12 +212,37 @@ private actor RemoteConfigBlobFetchScheduler {
         }
 
         for ref in refs {
-            self.enqueue(ref: ref, priority: .low, continuation: nil)
+            self.enqueue(ref: ref, urgency: .prefetch, continuation: nil)
+        }
+    }
+
+    func promote(ref: String, deadline: Date) {
+        guard let download = self.queued[ref] else {
+            return
+        }
+
+        self.queued[ref]?.urgency = download.urgency.withDeadline(deadline)
+    }
+
+    func queueWaitTime(for ref: String) -> TimeInterval? {
+        if let download = self.queued[ref] {
+            return self.dateProvider.now().timeIntervalSince(download.enqueuedAt)
+        }
+
+        return self.queueWaitTimes[ref]
+    }
+
+    /// Drops the recorded queue wait times of refs outside `refs`, so they don't outlive the config.
+    func retainOnly(_ refs: Set<String>) {
+        self.queueWaitTimes = self.queueWaitTimes.filter { ref, _ in
+            refs.contains(ref) || self.inFlight.contains(ref)
         }
     }
 
     /// Performs the actual download, source failover, checksum validation, and disk write.
-    private func downloadVerifyAndStore(ref: String) async -> Bool {
+    ///
+    /// - Parameter hedges: Whether a slow download is raced against the next blob source.
+    private func downloadVerifyAndStore(ref: String, hedges: Bool) async -> Bool {
         guard RemoteConfigBlobRefHelpers.isValid(ref) else {
             Logger.error(Strings.remoteConfig.malformedBlobRef(ref))
             return false
@@ -157,8 +259,16 @@ private actor RemoteConfigBlobFetchScheduler {
                 continue
             }
 
+            let generation = self.concurrencyLimiter.generation
+            let startTime = self.dateProvider.now()
+            let partial = self.partialDownloads?.partialDownload(for: ref)
             do {
-                let data = try await self.downloader.data(from: url)
+                let (data, dataURL) = try await self.data(for: ref, from: url, resuming: partial, hedges: hedges)
+                let latency = self.dateProvider.now().timeIntervalSince(startTime)
+                self.hedgingPolicy.record(latency: latency)
+                self.recordDownload(.success(latency: latency, byteCount: data.count), startedInGeneration: generation)
+                // A complete blob that fails verification means the kept prefix cannot be trusted either.
+                partial?.discard()
                 return data.withUnsafeBytes { bytes in
                     guard RemoteConfigBlobRefHelpers.isValidPayload(bytes, expectedRef: ref) else {
                         Logger.error(Strings.remoteConfig.skippingInvalidBlob(ref))
@@ -167,13 +277,14 @@ private actor RemoteConfigBlobFetchScheduler {
 
                     let didWrite = self.blobStore.write(ref: ref, bytes: bytes)
                     if didWrite {
-                        Logger.verbose(Strings.remoteConfig.storedBlob(ref, byteCount: bytes.count, url))
+                        Logger.verbose(Strings.remoteConfig.storedBlob(ref, byteCount: bytes.count, dataURL))
                     }
 
                     return didWrite
                 }
             } catch {
                 Logger.error(Strings.remoteConfig.failedToDownloadBlob(ref, url, error))
+                self.recordDownload(self.limiterOutcome(for: error), startedInGeneration: generation)
                 guard self.shouldReportSourceUnhealthy(for: error) else {
                     return false
                 }
@@ -193,6 +304,75 @@ private actor RemoteConfigBlobFetchScheduler {
         return false
     }
 
+    /// Downloads `url`, racing it against the next blob source once it outlives the hedging delay.
+    ///
+    /// The first successful response wins and the other request is cancelled. A failure of `url` is only
+    /// thrown once the hedge has failed too (or before it started), so the caller's source failover still
+    /// judges the primary source. Only the primary request resumes `partial`, so the two never write it at
+    /// the same time.
+    private func data(
+        for ref: String,
+        from url: URL,
+        resuming partial: RemoteConfigBlobPartialDownload?,
+        hedges: Bool
+    ) async throws -> (Data, URL) {
+        let downloader = self.downloader
+        let primaryData = { () async throws -> Data in
+            guard let partial else {
+                return try await downloader.data(from: url)
+            }
+
+            return try await downloader.data(from: url, resuming: partial)
+        }
+
+        guard hedges,
+              let hedgeSource = self.sourceProvider.peekNext(for: .blob),
+              let hedgeURL = self.url(for: ref, source: hedgeSource),
+              hedgeURL != url else {
+            return (try await primaryData(), url)
+        }
+
+        let delayNanoseconds = UInt64(self.hedgingPolicy.delay * 1_000_000_000)
+        let hedgeStarted: Atomic<Bool> = false
+
+        let result: Result<(Data, URL), Error> = await withTaskGroup(of: HedgedAttempt.self) { group in
+            group.addTask {
+                return await HedgedAttempt(url: url, download: primaryData)
+            }
+            group.addTask {
+                do {
+                    try await Task.sleep(nanoseconds: delayNanoseconds)
+                } catch {
+                    return HedgedAttempt(url: hedgeURL, result: .failure(error))
+                }
+
+                hedgeStarted.value = true
+                Logger.debug(Strings.remoteConfig.hedgingBlobDownload(ref, hedgeURL))
+                return await HedgedAttempt(url: hedgeURL) { try await downloader.data(from: hedgeURL) }
+            }
+
+            var primaryError: Error?
+            for await attempt in group {
+                switch attempt.result {
+                case let .success(data):
+                    group.cancelAll()
+                    return .success((data, attempt.url))
+                case let .failure(error) where attempt.url == url:
+                    primaryError = error
+                    if !hedgeStarted.value {
+                        group.cancelAll()
+                    }
+                case .failure:
+                    break
+                }
+            }
+
+            return .failure(primaryError ?? CancellationError())
+        }
+
+        return try result.get()
+    }
+
     /// Whether a download failure is a source-health signal rather than a request-specific outcome.
     private func shouldReportSourceUnhealthy(for error: Error) -> Bool {
         if error is CancellationError {
@@ -215,10 +395,53 @@ private actor RemoteConfigBlobFetchScheduler {
         }
     }
 
+    /// Whether a download failure suggests the network is congested by too many parallel downloads.
+    private func limiterOutcome(for error: Error) -> RemoteConfigBlobConcurrencyLimiter.Outcome {
+        if let urlError = error as? URLError {
+            return urlError.code == .cancelled ? .ignored : .congestion
+        }
+
+        if case let .unexpectedStatusCode(statusCode)? = error as? URLSessionRemoteConfigBlobDownloader.Error {
+            // `HTTPStatusCode(rawValue: 429)` is `.other(429)`, so compare raw values.
+            let isThrottled = statusCode == HTTPStatusCode.tooManyRequests.rawValue
+            return HTTPStatusCode(rawValue: statusCode).isServerError || isThrottled ? .congestion : .ignored
+        }
+
+        return self.shouldReportSourceUnhealthy(for: error) ? .congestion : .ignored
+    }
+
+    /// Feeds one finished download attempt to the concurrency limiter.
+    private func recordDownload(
+        _ outcome: RemoteConfigBlobConcurrencyLimiter.Outcome,
+        startedInGeneration generation: Int
+    ) {
+        let limitChanged = self.concurrencyLimiter.record(
+            outcome,
+            startedInGeneration: generation,
+            hadQueuedWork: !self.queued.isEmpty
+        )
+        if limitChanged {
+            Logger.debug(Strings.remoteConfig.blobConcurrencyLimitChanged(self.concurrencyLimiter.limit))
+        }
+    }
+
+    /// Reports the limit the scheduler settled on once a burst of downloads has drained.
+    private func reportConcurrencyLimitIfIdle() {
+        let limit = self.concurrencyLimiter.limit
+        guard self.queued.isEmpty, self.inFlight.isEmpty, limit != self.reportedConcurrencyLimit else {
+            return
+        }
+
+        self.reportedConcurrencyLimit = limit
+        if #available(iOS 15.0, macOS 12.0, tvOS 15.0, watchOS 8.0, *) {
+            self.diagnosticsTracker?.trackRemoteConfigBlobConcurrencyLimit(limit: limit)
+        }
+    }
+
     /// Adds a ref to the scheduler, coalescing duplicate queued or in-flight requests.
     private func enqueue(
         ref: String,
-        priority: Priority,
+        urgency: RemoteConfigBlobFetchUrgency,
         continuation: CheckedContinuation<Bool, Never>?,
         restartsExhaustedSources: Bool = false
     ) {
@@ -242,11 +465,8 @@ private actor RemoteConfigBlobFetchScheduler {
             if let continuation {
                 download.continuations.append(continuation)
             }
-            // A consumer request upgrades queued prefetch work, but keeps it behind already queued high-priority work.
-            if priority.rawValue > download.priority.rawValue {
-                download.priority = priority
-                download.sequence = self.nextSequence()
-            }
+            // A consumer request upgrades queued prefetch work. Time already spent in the queue keeps counting.
+            download.urgency = download.urgency.merged(with: urgency)
             self.queued[ref] = download
             return
         }
@@ -261,7 +481,8 @@ private actor RemoteConfigBlobFetchScheduler {
 
         self.queued[ref] = Download(
             ref: ref,
-            priority: priority,
+            enqueuedAt: self.dateProvider.now(),
+            urgency: urgency,
             sequence: self.nextSequence(),
             continuations: continuation.map { [$0] } ?? []
         )
@@ -273,16 +494,19 @@ private actor RemoteConfigBlobFetchScheduler {
         self.sourceProvider.restartIfExhausted(for: .blob)
     }
 
-    /// Starts queued downloads until the concurrency limit is reached.
+    /// Starts queued downloads until the current concurrency limit is reached.
     private func scheduleDownloads() {
-        while self.inFlight.count < Self.maxConcurrentDownloads,
+        while self.inFlight.count < self.concurrencyLimiter.limit,
               let download = self.nextDownload() {
             self.queued[download.ref] = nil
             self.inFlight.insert(download.ref)
             self.activeContinuations[download.ref] = download.continuations
+            self.recordQueueWait(of: download)
 
+            // Only downloads a consumer is waiting for are worth duplicating.
+            let hedges = !download.continuations.isEmpty
             Task {
-                let result = await self.downloadVerifyAndStore(ref: download.ref)
+                let result = await self.downloadVerifyAndStore(ref: download.ref, hedges: hedges)
                 self.complete(ref: download.ref, result: result)
             }
         }
@@ -296,17 +520,33 @@ private actor RemoteConfigBlobFetchScheduler {
         continuations.forEach { $0.resume(returning: resolvedResult) }
 
         self.scheduleDownloads()
+        self.reportConcurrencyLimitIfIdle()
     }
 
-    /// Chooses the next queued item by priority first, then FIFO order within that priority.
+    /// Chooses the next queued item by urgency first, then FIFO order among equally urgent items.
     private func nextDownload() -> Download? {
-        return self.queued.values.sorted {
-            if $0.priority != $1.priority {
-                return $0.priority.rawValue > $1.priority.rawValue
-            }
+        let now = self.dateProvider.now()
+        let sortKey = { (download: Download) in
+            download.urgency.sortKey(afterWaiting: now.timeIntervalSince(download.enqueuedAt))
+        }
 
-            return $0.sequence < $1.sequence
-        }.first
+        return self.queued.values.min {
+            let (lhs, rhs) = (sortKey($0), sortKey($1))
+            return lhs == rhs ? $0.sequence < $1.sequence : lhs < rhs
+        }
+    }
+
+    /// Remembers how long a download waited for a slot, and logs when it started after its deadline.
+    private func recordQueueWait(of download: Download) {
+        let now = self.dateProvider.now()
+        self.queueWaitTimes[download.ref] = now.timeIntervalSince(download.enqueuedAt)
+
+        if let deadline = download.urgency.deadline, deadline < now {
+            Logger.debug(Strings.remoteConfig.blobDownloadStartedAfterDeadline(
+                download.ref,
+                lateness: now.timeIntervalSince(deadline)
+            ))
+        }
     }
 
     /// Returns a monotonically increasing sequence number used to preserve FIFO ordering.
@@ -329,3 +569,24 @@ private actor RemoteConfigBlobFetchScheduler {
     }
 
 }
+
+/// The outcome of one of the requests raced by a hedged blob download.
+private struct HedgedAttempt: Sendable {
+
+    let url: URL
+    let result: Result<Data, Error>
+
+    init(url: URL, result: Result<Data, Error>) {
+        self.url = url
+        self.result = result
+    }
+
+    init(url: URL, download: () async throws -> Data) async {
+        do {
+            self.init(url: url, result: .success(try await download()))
+        } catch {
+            self.init(url: url, result: .failure(error))
+        }
+    }
+
+}
@@ -0,0 +1,61 @@
+//
+//  RemoteConfigBlobHedgingPolicy.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+
+/// Decides how long a consumer-requested blob download may run before a duplicate request is sent to the
+/// next blob source.
+///
+/// The delay is the `percentile` of the latencies of the last `sampleCapacity` successful downloads, so
+/// only the slowest few requests are hedged. Until `minimumSampleCount` downloads have completed the delay
+/// is `initialDelay`. It never drops below `minimumDelay`, so jitter on fast networks does not double
+/// most requests.
+struct RemoteConfigBlobHedgingPolicy {
+
+    static let defaultPercentile = 0.95
+    static let defaultInitialDelay: TimeInterval = 1
+    static let minimumDelay: TimeInterval = 0.05
+    static let sampleCapacity = 64
+    static let minimumSampleCount = 8
+
+    let percentile: Double
+    let initialDelay: TimeInterval
+
+    /// Latency ring buffer, overwritten starting at `nextSampleIndex` once full.
+    private var samples: [TimeInterval] = []
+    private var nextSampleIndex = 0
+
+    init(
+        percentile: Double = RemoteConfigBlobHedgingPolicy.defaultPercentile,
+        initialDelay: TimeInterval = RemoteConfigBlobHedgingPolicy.defaultInitialDelay
+    ) {
+        self.percentile = min(max(percentile, 0), 1)
+        self.initialDelay = initialDelay
+    }
+
+    /// How long to wait for a download before hedging it.
+    var delay: TimeInterval {
+        guard self.samples.count >= Self.minimumSampleCount else {
+            return max(Self.minimumDelay, self.initialDelay)
+        }
+
+        let sorted = self.samples.sorted()
+        let rank = Int((Double(sorted.count) * self.percentile).rounded(.up)) - 1
+        return max(Self.minimumDelay, sorted[min(max(rank, 0), sorted.count - 1)])
+    }
+
+    /// Records the latency of a successful download.
+    mutating func record(latency: TimeInterval) {
+        if self.samples.count < Self.sampleCapacity {
+            self.samples.append(latency)
+        } else {
+            self.samples[self.nextSampleIndex] = latency
+        }
+        self.nextSampleIndex = (self.nextSampleIndex + 1) % Self.sampleCapacity
+    }
+
+}
@@ -0,0 +1,146 @@
+//
+//  RemoteConfigBlobPartialDownloadStore.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+
+/// Keeps the bytes received by interrupted blob downloads so the next attempt, against any blob source,
+/// can ask for the rest with a `Range` request instead of starting over.
+///
+/// Blobs are content-addressed, so a prefix received from one source is valid for every other source. The
+/// bytes are only trusted once the whole blob matches its ref, which the fetcher checks as usual. Prefixes
+/// shorter than `minimumByteCount` are not worth a file, and only the `maximumFileCount` most recent
+/// prefixes are kept.
+final class RemoteConfigBlobPartialDownloadStore {
+
+    static let minimumByteCount = 64 * 1024
+    static let maximumFileCount = 8
+    static let directoryName = "blob-downloads"
+
+    private let fileManager: FileManager
+    private let directoryURL: URL?
+    private let lock = Lock(.nonRecursive)
+
+    init(
+        fileManager: FileManager = .default,
+        directoryURL: URL? = RemoteConfigBlobPartialDownloadStore.defaultDirectoryURL
+    ) {
+        self.fileManager = fileManager
+        self.directoryURL = directoryURL
+    }
+
+    /// The partial download of `ref`, loaded with whatever earlier attempts received.
+    func partialDownload(for ref: String) -> RemoteConfigBlobPartialDownload {
+        let prefix = self.lock.perform {
+            self.fileURL(for: ref).flatMap { try? Data(contentsOf: $0) }
+        }
+
+        return RemoteConfigBlobPartialDownload(ref: ref, prefix: prefix ?? Data(), store: self)
+    }
+
+    static var defaultDirectoryURL: URL? {
+        return DirectoryHelper.baseUrl(for: RemoteConfigDiskCache.directoryType)?
+            .appendingPathComponent(RemoteConfigDiskCache.basePath, isDirectory: true)
+            .appendingPathComponent(Self.directoryName, isDirectory: true)
+    }
+
+    fileprivate func save(_ data: Data, for ref: String) {
+        guard data.count >= Self.minimumByteCount else {
+            self.remove(ref: ref)
+            return
+        }
+
+        self.lock.perform {
+            guard let directoryURL = self.directoryURL, let fileURL = self.fileURL(for: ref) else {
+                return
+            }
+
+            do {
+                try self.fileManager.createDirectory(at: directoryURL, withIntermediateDirectories: true)
+                try data.write(to: fileURL, options: .atomic)
+                self.removeOldestFilesWithoutLock(in: directoryURL)
+            } catch {
+                Logger.error(Strings.remoteConfig.failedToWriteBlob(ref, error))
+            }
+        }
+    }
+
+    fileprivate func remove(ref: String) {
+        self.lock.perform {
+            guard let fileURL = self.fileURL(for: ref),
+                  self.fileManager.fileExists(atPath: fileURL.path) else {
+                return
+            }
+
+            do {
+                try self.fileManager.removeItem(at: fileURL)
+            } catch {
+                Logger.error(Strings.remoteConfig.failedToDeleteBlob(ref, error))
+            }
+        }
+    }
+
+}
+
+private extension RemoteConfigBlobPartialDownloadStore {
+
+    func fileURL(for ref: String) -> URL? {
+        guard RemoteConfigBlobRefHelpers.isValid(ref) else {
+            return nil
+        }
+
+        return self.directoryURL?.appendingPathComponent(ref, isDirectory: false)
+    }
+
+    func removeOldestFilesWithoutLock(in directoryURL: URL) {
+        guard let contents = try? self.fileManager.contentsOfDirectory(
+            at: directoryURL,
+            includingPropertiesForKeys: [.contentModificationDateKey],
+            options: []
+        ), contents.count > Self.maximumFileCount else {
+            return
+        }
+
+        let modificationDate = { (fileURL: URL) in
+            (try? fileURL.resourceValues(forKeys: [.contentModificationDateKey]).contentModificationDate)
+                ?? .distantPast
+        }
+
+        for fileURL in contents.sorted(by: { modificationDate($0) < modificationDate($1) })
+            .dropLast(Self.maximumFileCount) {
+            try? self.fileManager.removeItem(at: fileURL)
+        }
+    }
+
+}
+
+/// The bytes of one blob received by earlier attempts, handed to the downloader so it can resume.
+final class RemoteConfigBlobPartialDownload {
+
+    let ref: String
+
+    /// The first bytes of the blob, empty if nothing was kept.
+    let prefix: Data
+
+    private let store: RemoteConfigBlobPartialDownloadStore?
+
+    init(ref: String, prefix: Data, store: RemoteConfigBlobPartialDownloadStore?) {
+        self.ref = ref
+        self.prefix = prefix
+        self.store = store
+    }
+
+    /// Keeps `received`, the first bytes of the blob, after an attempt was interrupted.
+    func save(_ received: Data) {
+        self.store?.save(received, for: self.ref)
+    }
+
+    /// Forgets the kept bytes, once the blob is complete or the bytes turned out to be unusable.
+    func discard() {
+        self.store?.remove(ref: self.ref)
+    }
+
+}
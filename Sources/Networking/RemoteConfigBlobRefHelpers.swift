@@ -11,14 +11,14 @@ import Foundation
 enum RemoteConfigBlobRefHelpers {
 
     static func isValid(_ ref: String) -> Bool {
-        return ref.range(of: Self.validRefPattern, options: .regularExpression) != nil
+        return RCContainer.ChecksumKey(ref: ref) != nil
     }
 
     static func ref(for bytes: UnsafeRawBufferPointer) -> String {
-        var hash = SHA256()
-        hash.update(bufferPointer: bytes)
+        var hasher = RefHasher()
+        hasher.update(bytes)
 
-        return Self.base64URLString(from: Array(hash.finalize().prefix(Self.checksumSize)))
+        return hasher.finalize()
     }
 
     static func isValidPayload(
@@ -28,19 +28,21 @@ enum RemoteConfigBlobRefHelpers {
         return self.isValid(ref) && self.ref(for: bytes) == ref
     }
 
-}
+    /// Computes a blob ref incrementally over bytes that arrive in chunks.
+    struct RefHasher {
+
+        private var hash = SHA256()
 
-private extension RemoteConfigBlobRefHelpers {
+        mutating func update(_ bytes: UnsafeRawBufferPointer) {
+            self.hash.update(bufferPointer: bytes)
+        }
 
-    static let checksumSize = 24
-    static let validRefPattern = #"^[A-Za-z0-9_-]{32}$"#
+        func finalize() -> String {
+            return self.hash.finalize().withUnsafeBytes { digest in
+                RCContainer.ChecksumKey(bytes: digest).ref
+            }
+        }
 
-    static func base64URLString(from bytes: [UInt8]) -> String {
-        return Data(bytes)
-            .base64EncodedString()
-            .replacingOccurrences(of: "+", with: "-")
-            .replacingOccurrences(of: "/", with: "_")
-            .replacingOccurrences(of: "=", with: "")
     }
 
 }
@@ -15,11 +15,50 @@ protocol RemoteConfigBlobStoreType: AnyObject {
         ref: String,
         bytes: UnsafeRawBufferPointer
     ) -> Bool
+    /// Stores the bytes that `writeChunks` passes to its `writeChunk` argument, in order, as the blob for `ref`.
+    ///
+    /// The blob is only stored if the streamed bytes hash to `ref`.
+    ///
+    /// - Returns: The number of bytes stored, or `nil` if the blob could not be written.
+    /// - Throws: Errors thrown by `writeChunks`, or `RCContainer.Parser.FormatError.checksumMismatch` when the
+    /// streamed bytes do not match `ref`.
+    @discardableResult
+    func write(
+        ref: String,
+        streamingChunks writeChunks: (_ writeChunk: (UnsafeRawBufferPointer) throws -> Void) throws -> Void
+    ) throws -> Int?
     func cachedRefs() -> Set<String>
     func retainOnly(_ refs: Set<String>)
     func clear()
 }
 
+extension RemoteConfigBlobStoreType {
+
+    /// Buffers the streamed chunks and stores them through `write(ref:bytes:)`.
+    @discardableResult
+    func write(
+        ref: String,
+        streamingChunks writeChunks: (_ writeChunk: (UnsafeRawBufferPointer) throws -> Void) throws -> Void
+    ) throws -> Int? {
+        var data = Data()
+        try writeChunks { chunk in
+            data.append(contentsOf: chunk)
+        }
+
+        return try data.withUnsafeBytes { bytes in
+            guard RemoteConfigBlobRefHelpers.isValidPayload(bytes, expectedRef: ref) else {
+                throw RCContainer.Parser.FormatError.checksumMismatch(
+                    expected: ref,
+                    actual: RemoteConfigBlobRefHelpers.ref(for: bytes)
+                )
+            }
+
+            return self.write(ref: ref, bytes: bytes) ? bytes.count : nil
+        }
+    }
+
+}
+
 /// Content-addressed disk cache for remote config blobs, keyed by 32-character URL-safe base64 refs.
 final class RemoteConfigBlobStore: RemoteConfigBlobStoreType {
 
@@ -61,6 +100,62 @@ final class RemoteConfigBlobStore: RemoteConfigBlobStoreType {
         }
     }
 
+    /// Streams chunks into a partial file outside the lock while hashing them, then moves the file into place
+    /// under the lock once the hash matches `ref`. Peak memory is a single chunk rather than the whole blob.
+    @discardableResult
+    func write(
+        ref: String,
+        streamingChunks writeChunks: (_ writeChunk: (UnsafeRawBufferPointer) throws -> Void) throws -> Void
+    ) throws -> Int? {
+        guard let directoryURL = self.directoryURL else {
+            Logger.error(Strings.remoteConfig.cacheURLNotAvailable)
+            return nil
+        }
+
+        guard let fileURL = self.fileURL(for: ref) else {
+            Logger.error(Strings.remoteConfig.malformedBlobRef(ref))
+            return nil
+        }
+
+        let partialDirectoryURL = directoryURL.appendingPathComponent(Self.partialDirectoryName, isDirectory: true)
+        let partialFileURL = partialDirectoryURL.appendingPathComponent(UUID().uuidString, isDirectory: false)
+        defer { try? self.fileManager.removeItem(at: partialFileURL) }
+
+        do {
+            try self.fileManager.createDirectory(
+                at: partialDirectoryURL,
+                withIntermediateDirectories: true,
+                attributes: nil
+            )
+        } catch {
+            Logger.error(Strings.remoteConfig.failedToWriteBlob(ref, error))
+            return nil
+        }
+
+        let byteCount: Int
+        do {
+            byteCount = try Self.stream(writeChunks, to: partialFileURL, expectedRef: ref)
+        } catch let error as PartialFileWriteError {
+            Logger.error(Strings.remoteConfig.failedToWriteBlob(ref, error.underlyingError))
+            return nil
+        }
+
+        return self.lock.perform {
+            do {
+                if self.fileManager.fileExists(atPath: fileURL.path) {
+                    try self.fileManager.removeItem(at: fileURL)
+                }
+                try self.fileManager.moveItem(at: partialFileURL, to: fileURL)
+            } catch {
+                Logger.error(Strings.remoteConfig.failedToWriteBlob(ref, error))
+                return nil
+            }
+
+            self.knownRefs?.insert(ref)
+            return byteCount
+        }
+    }
+
     func cachedRefs() -> Set<String> {
         return self.lock.perform {
             return self.loadedRefsWithoutLock()
@@ -102,7 +197,11 @@ private extension RemoteConfigBlobStore {
         }
 
         do {
-            return try Data(contentsOf: fileURL)
+            // Blobs are only ever replaced through atomic writes, so large ones can be mapped safely.
+            return try Data(
+                contentsOf: fileURL,
+                options: RCContainer.Backing.memoryMapped.readingOptions(for: fileURL)
+            )
         } catch {
             Logger.error(Strings.remoteConfig.failedToReadBlob(ref, error))
             return nil
@@ -250,3 +349,65 @@ private extension RemoteConfigBlobStore {
     }
 
 }
+
+// MARK: - Streamed writes
+
+/// Shared with `RemoteConfigPackedBlobStore`, which streams into the same kind of partial files.
+extension RemoteConfigBlobStore {
+
+    /// In-progress streamed writes live in a subdirectory so directory scans, which only consider regular
+    /// files, never see partial blobs.
+    static let partialDirectoryName = ".partial"
+
+    /// Wraps file errors from `stream(_:to:expectedRef:)` so they are not confused with producer errors.
+    struct PartialFileWriteError: Error {
+
+        let underlyingError: Error
+
+    }
+
+    /// Writes streamed chunks to `fileURL` and returns the byte count once their hash has been verified.
+    static func stream(
+        _ writeChunks: (_ writeChunk: (UnsafeRawBufferPointer) throws -> Void) throws -> Void,
+        to fileURL: URL,
+        expectedRef ref: String
+    ) throws -> Int {
+        guard let output = OutputStream(url: fileURL, append: false) else {
+            throw PartialFileWriteError(underlyingError: CocoaError(.fileWriteUnknown))
+        }
+
+        output.open()
+        defer { output.close() }
+
+        var hasher = RemoteConfigBlobRefHelpers.RefHasher()
+        var byteCount = 0
+        try writeChunks { chunk in
+            hasher.update(chunk)
+            byteCount += chunk.count
+            try Self.writeAll(chunk, to: output)
+        }
+
+        let actualRef = hasher.finalize()
+        guard actualRef == ref else {
+            throw RCContainer.Parser.FormatError.checksumMismatch(expected: ref, actual: actualRef)
+        }
+
+        return byteCount
+    }
+
+    static func writeAll(_ chunk: UnsafeRawBufferPointer, to output: OutputStream) throws {
+        guard var address = chunk.bindMemory(to: UInt8.self).baseAddress else { return }
+
+        var remaining = chunk.count
+        while remaining > 0 {
+            let written = output.write(address, maxLength: remaining)
+            guard written > 0 else {
+                throw PartialFileWriteError(underlyingError: output.streamError ?? CocoaError(.fileWriteUnknown))
+            }
+
+            address += written
+            remaining -= written
+        }
+    }
+
+}
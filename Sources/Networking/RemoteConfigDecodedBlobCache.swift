@@ -0,0 +1,114 @@
+//
+//  RemoteConfigDecodedBlobCache.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+
+/// Memory cache of remote config blobs that were already decoded into `Decodable` values.
+///
+/// Blob refs are content checksums, so a decoded value stays correct for as long as its refs exist and
+/// entries are only invalidated alongside the blob store through `retainOnly(_:)` and `clear()`. Storage is
+/// an `NSCache` bounded by entry count and by the encoded byte size of the decoded blobs, which also lets
+/// the system evict entries under memory pressure.
+final class RemoteConfigDecodedBlobCache {
+
+    /// Identifies one decoded value: the blobs it was decoded from and the type it was decoded as.
+    struct Key: Hashable {
+
+        /// Item keys used to build a merged JSON envelope, or empty for a single blob.
+        let itemKeys: [String]
+        let refs: [String]
+        let type: ObjectIdentifier
+
+        init<T>(ref: String, type: T.Type) {
+            self.init(itemKeys: [], refs: [ref], type: type)
+        }
+
+        init<T>(itemKeys: [String], refs: [String], type: T.Type) {
+            self.itemKeys = itemKeys
+            self.refs = refs
+            self.type = ObjectIdentifier(type)
+        }
+
+    }
+
+    static let defaultCountLimit = 64
+    static let defaultTotalCostLimit = 8 * 1024 * 1024
+
+    private let cache = NSCache<KeyBox, ValueBox>()
+
+    /// Keys currently or recently stored in `cache`, which cannot be enumerated for ref-based invalidation.
+    private let keys: Atomic<Set<Key>> = .init([])
+
+    init(
+        countLimit: Int = RemoteConfigDecodedBlobCache.defaultCountLimit,
+        totalCostLimit: Int = RemoteConfigDecodedBlobCache.defaultTotalCostLimit
+    ) {
+        self.cache.countLimit = countLimit
+        self.cache.totalCostLimit = totalCostLimit
+    }
+
+    func value<T>(for key: Key, as type: T.Type = T.self) -> T? {
+        return self.cache.object(forKey: KeyBox(key))?.value as? T
+    }
+
+    /// Stores `value`, costed by `byteCount`, the size of the encoded blob data it was decoded from.
+    func store<T>(_ value: T, for key: Key, byteCount: Int) {
+        self.keys.modify { $0.insert(key) }
+        self.cache.setObject(ValueBox(value), forKey: KeyBox(key), cost: byteCount)
+    }
+
+    /// Drops every value decoded from a ref outside `refs`.
+    func retainOnly(_ refs: Set<String>) {
+        let removedKeys: [Key] = self.keys.modify { keys in
+            let removed = keys.filter { !$0.refs.allSatisfy(refs.contains) }
+            keys.subtract(removed)
+            return Array(removed)
+        }
+
+        for key in removedKeys {
+            self.cache.removeObject(forKey: KeyBox(key))
+        }
+    }
+
+    func clear() {
+        self.keys.value = []
+        self.cache.removeAllObjects()
+    }
+
+}
+
+private extension RemoteConfigDecodedBlobCache {
+
+    final class KeyBox: NSObject {
+
+        let key: Key
+
+        init(_ key: Key) {
+            self.key = key
+        }
+
+        override var hash: Int {
+            return self.key.hashValue
+        }
+
+        override func isEqual(_ object: Any?) -> Bool {
+            return (object as? KeyBox)?.key == self.key
+        }
+
+    }
+
+    final class ValueBox {
+
+        let value: Any
+
+        init(_ value: Any) {
+            self.value = value
+        }
+
+    }
+
+}
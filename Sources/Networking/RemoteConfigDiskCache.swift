@@ -22,6 +22,15 @@ protocol RemoteConfigDiskCacheType: RemoteConfigTopicStoreType {
     @discardableResult
     func write(_ configuration: PersistedRemoteConfiguration) -> Bool
 
+    /// Persists the latest response container together with its `RCContainer.ElementIndex` sidecar.
+    ///
+    /// Returns without waiting for the write, so callers holding a lock don't hold it through the file I/O.
+    func writeContainer(_ container: RemoteConfigContainer)
+
+    /// Reopens the container last written by `writeContainer(_:)`, or `nil` if there is none.
+    /// Waits for container writes that are still pending.
+    func readContainer() -> RCContainer?
+
     func clear()
 
 }
@@ -104,6 +113,12 @@ final class RemoteConfigDiskCache: RemoteConfigDiskCacheType {
 
     private let snapshot: Atomic<Snapshot> = .init(.notLoaded)
 
+    /// Serializes container writes and reads off the caller's thread.
+    private let containerQueue = DispatchQueue(label: "com.revenuecat.remote-config.container")
+
+    /// Incremented by `clear()`, so container writes queued before it are skipped.
+    private let containerGeneration: Atomic<Int> = .init(0)
+
     init(
         cache: SynchronizedLargeItemCache = .init(
             cache: FileManager.default,
@@ -141,9 +156,29 @@ final class RemoteConfigDiskCache: RemoteConfigDiskCacheType {
         }
     }
 
+    func writeContainer(_ container: RemoteConfigContainer) {
+        let generation = self.containerGeneration.value
+
+        self.containerQueue.async {
+            guard self.containerGeneration.value == generation else { return }
+
+            self.writeContainerToDisk(container)
+        }
+    }
+
+    func readContainer() -> RCContainer? {
+        return self.containerQueue.sync {
+            self.readContainerFromDisk()
+        }
+    }
+
     func clear() {
         self.snapshot.modify { snapshot in
-            self.cache.clear()
+            self.containerGeneration.modify { $0 += 1 }
+            // Waits for a container write already in progress, so it can't land after the directory is removed.
+            self.containerQueue.sync {
+                self.cache.clear()
+            }
             snapshot = .loaded(nil)
         }
     }
@@ -157,6 +192,39 @@ final class RemoteConfigDiskCache: RemoteConfigDiskCacheType {
         }
     }
 
+    private func writeContainerToDisk(_ container: RemoteConfigContainer) {
+        guard let containerURL = self.cache.fileURL(forKey: Self.containerFileName) else {
+            Logger.error(Strings.remoteConfig.cacheURLNotAvailable)
+            return
+        }
+
+        do {
+            // `clear()` removes the whole cache directory.
+            try FileManager.default.createDirectory(
+                at: containerURL.deletingLastPathComponent(),
+                withIntermediateDirectories: true,
+                attributes: nil
+            )
+            try RCContainer.persist(container.rcContainer, data: container.data, to: containerURL)
+        } catch {
+            Logger.error(Strings.remoteConfig.failedToWriteContainer(error))
+        }
+    }
+
+    private func readContainerFromDisk() -> RCContainer? {
+        guard let containerURL = self.cache.fileURL(forKey: Self.containerFileName),
+              FileManager.default.fileExists(atPath: containerURL.path) else {
+            return nil
+        }
+
+        do {
+            return try RCContainer(contentsOf: containerURL)
+        } catch {
+            Logger.error(Strings.remoteConfig.failedToReadContainer(error))
+            return nil
+        }
+    }
+
 }
 
 extension RemoteConfigDiskCache {
@@ -183,6 +251,7 @@ extension RemoteConfigDiskCache {
 
     static let basePath = "remote_config"
     static let fileName = "remote_config.json"
+    static let containerFileName = "remote_config.rc"
 
     static var directoryType: DirectoryHelper.DirectoryType {
         #if os(tvOS)
@@ -57,6 +57,14 @@ protocol RemoteConfigManagerType: AnyObject {
     @discardableResult
     func ensureBlobsDownloaded(_ refs: [String]) async -> Bool
 
+    /// Marks the blobs of `itemKeys` as needed within `timeInterval` from now, so their downloads start ahead of
+    /// other queued downloads and later `blobData` reads of them keep that deadline.
+    ///
+    /// The deadline is taken from the manager's own clock, the one expired deadlines are checked against.
+    /// Reads the committed topic without triggering a refresh, and skips items that are missing or already
+    /// downloaded.
+    func prioritizeBlobs(for topic: RemoteConfigTopic, itemKeys: [String], within timeInterval: TimeInterval) async
+
     /// Decodes multiple blob payloads into one keyed JSON object.
     ///
     /// Each requested item must be backed by `blob_ref`. The merged object is keyed by item key, so item
@@ -140,6 +148,15 @@ extension RemoteConfigManagerType {
         itemKeys: [String],
         as type: T.Type
     ) async throws -> T? {
+        return try await self.decodeMergedItemsBlobData(for: topic, itemKeys: itemKeys, as: type)?.value
+    }
+
+    /// Resolves, merges and decodes `itemKeys` blobs, also returning the merged JSON byte count.
+    func decodeMergedItemsBlobData<T: Decodable>(
+        for topic: RemoteConfigTopic,
+        itemKeys: [String],
+        as type: T.Type
+    ) async throws -> (value: T, byteCount: Int)? {
         let uniqueItemKeys = itemKeys.deduplicated()
         guard !self.isDisabled else {
             Logger.warn(Strings.remoteConfig.mergeItemsBlobDataDisabled(topic: topic, itemKeys: uniqueItemKeys))
@@ -183,7 +200,7 @@ extension RemoteConfigManagerType {
             return nil
         }
 
-        return try JSONDecoder.default.decode(type, from: mergedData)
+        return (try JSONDecoder.default.decode(type, from: mergedData), mergedData.count)
     }
 
     /// Builds a keyed JSON object `{"<itemKey>":<blobBytes>,...}` from already-encoded blob payloads.
@@ -251,6 +268,8 @@ final class NoOpRemoteConfigManager: RemoteConfigManagerType {
         return false
     }
 
+    func prioritizeBlobs(for topic: RemoteConfigTopic, itemKeys: [String], within timeInterval: TimeInterval) async {}
+
     func clearCache() {}
 
     func clearCache(forAppUserID appUserID: String) {}
@@ -277,6 +296,9 @@ final class RemoteConfigManager: RemoteConfigManagerType {
     private let dateProvider: DateProvider
     private let cacheDurationInSeconds: (Bool) -> TimeInterval
 
+    /// Decoded blob values, invalidated together with `blobStore` so repeated reads skip file I/O and decoding.
+    private let decodedBlobCache: RemoteConfigDecodedBlobCache
+
     /// Immutable per-request snapshot chosen under `lock`.
     fileprivate struct RefreshRequestContext {
         let epoch: Int
@@ -338,6 +360,12 @@ final class RemoteConfigManager: RemoteConfigManagerType {
     /// refresh, clear, close, or failure completes.
     private var refreshContinuations: [CheckedContinuation<Void, Never>] = []
 
+    /// Deadlines set by `prioritizeBlobs(for:itemKeys:within:)` for blobs that have not been read yet.
+    ///
+    /// Taken by the next on-demand read of each ref, and pruned with the blob store so refs dropped from the
+    /// config don't linger.
+    private var blobDeadlines: [String: Date] = [:]
+
     init(
         remoteConfigAPI: RemoteConfigAPIType,
         diskCache: RemoteConfigDiskCacheType,
@@ -345,7 +373,8 @@ final class RemoteConfigManager: RemoteConfigManagerType {
         blobFetcher: RemoteConfigBlobFetcherType,
         currentUserProvider: CurrentUserProvider,
         dateProvider: DateProvider = DateProvider(),
-        cacheDurationInSeconds: @escaping (Bool) -> TimeInterval = { _ in 60 * 5.0 }
+        cacheDurationInSeconds: @escaping (Bool) -> TimeInterval = { _ in 60 * 5.0 },
+        decodedBlobCache: RemoteConfigDecodedBlobCache = .init()
     ) {
         self.remoteConfigAPI = remoteConfigAPI
         self.diskCache = diskCache
@@ -354,6 +383,7 @@ final class RemoteConfigManager: RemoteConfigManagerType {
         self.currentUserProvider = currentUserProvider
         self.dateProvider = dateProvider
         self.cacheDurationInSeconds = cacheDurationInSeconds
+        self.decodedBlobCache = decodedBlobCache
     }
 
     var isDisabled: Bool {
@@ -426,14 +456,9 @@ final class RemoteConfigManager: RemoteConfigManagerType {
     }
 
     func blobData(for topic: RemoteConfigTopic, itemKey: String) async -> Data? {
-        guard let itemSnapshot = await self.readCommittedStateSnapshot(refreshIfMissing: true, {
-            await self.committedTopic(topic)?[itemKey]
-        }),
-              let item = itemSnapshot.value else {
-            return nil
-        }
+        guard let (item, epoch) = await self.committedItem(for: topic, itemKey: itemKey) else { return nil }
 
-        return await self.readCommittedState(epoch: itemSnapshot.epoch) {
+        return await self.readCommittedState(epoch: epoch) {
             await self.blobData(for: item)
         }
     }
@@ -443,15 +468,61 @@ final class RemoteConfigManager: RemoteConfigManagerType {
         itemKey: String,
         as type: T.Type
     ) async throws -> T? {
-        guard let data = await self.blobData(for: topic, itemKey: itemKey) else { return nil }
+        let generation = self.configGeneration
+        guard let (item, epoch) = await self.committedItem(for: topic, itemKey: itemKey),
+              let ref = item.blobRef else {
+            return nil
+        }
+
+        let key = RemoteConfigDecodedBlobCache.Key(ref: ref, type: type)
+        if let cached = self.decodedBlobCache.value(for: key, as: type), self.isReadable(epoch: epoch) {
+            return cached
+        }
 
-        return try JSONDecoder.default.decode(type, from: data)
+        guard let data = await self.readCommittedState(epoch: epoch, {
+            await self.blobData(for: item)
+        }) else {
+            return nil
+        }
+
+        let value = try JSONDecoder.default.decode(type, from: data)
+        self.storeDecodedBlob(value, for: key, byteCount: data.count, generation: generation)
+        return value
     }
 
     func ensureBlobsDownloaded(_ refs: [String]) async -> Bool {
         return await self.blobFetcher.ensureAllDownloaded(refs: refs)
     }
 
+    func prioritizeBlobs(for topic: RemoteConfigTopic, itemKeys: [String], within timeInterval: TimeInterval) async {
+        let deadline = self.dateProvider.now().addingTimeInterval(timeInterval)
+        guard let snapshot = await self.readCurrentCommittedState({ () -> Set<String>? in
+            guard let committed = await self.committedTopic(topic) else { return nil }
+
+            let refs = Set(itemKeys.compactMap { committed[$0]?.blobRef })
+            return await self.performRead {
+                refs.filter { !self.blobStore.contains(ref: $0) }
+            }
+        }),
+              let refs = snapshot.value else {
+            return
+        }
+
+        let isCurrent = self.lock.perform { () -> Bool in
+            guard self.epoch == snapshot.epoch else { return false }
+
+            for ref in refs {
+                self.blobDeadlines[ref] = self.blobDeadlines[ref].map { min($0, deadline) } ?? deadline
+            }
+            return true
+        }
+        guard isCurrent else { return }
+
+        for ref in refs {
+            await self.blobFetcher.promote(ref: ref, deadline: deadline)
+        }
+    }
+
     /// Wipes cached remote config state, for example after an identity change.
     ///
     /// The epoch bump, refresh-guard release, and cache wipe are serialized with response persistence so a late
@@ -470,6 +541,9 @@ final class RemoteConfigManager: RemoteConfigManagerType {
             self.lastRefreshAttemptAt = nil
             self.diskCache.clear()
             self.blobStore.clear()
+            self.decodedBlobCache.clear()
+            self.blobDeadlines.removeAll()
+            self.blobFetcher.retainOnly([])
             return self.drainRefreshContinuations()
         }
         continuations.forEach { $0.resume() }
@@ -488,6 +562,41 @@ final class RemoteConfigManager: RemoteConfigManagerType {
 
 }
 
+extension RemoteConfigManager {
+
+    /// Merges blobs like the `RemoteConfigManagerType` default, reusing the decoded value while the items' refs
+    /// are unchanged.
+    func mergeItemsBlobData<T: Decodable>(
+        for topic: RemoteConfigTopic,
+        itemKeys: [String],
+        as type: T.Type
+    ) async throws -> T? {
+        let generation = self.configGeneration
+        let uniqueItemKeys = itemKeys.deduplicated()
+        let cacheKey = await self.mergedBlobCacheKey(for: topic, itemKeys: uniqueItemKeys, as: type)
+
+        if let cacheKey,
+           let cached = self.decodedBlobCache.value(for: cacheKey.key, as: type),
+           self.isReadable(epoch: cacheKey.epoch) {
+            return cached
+        }
+
+        guard let merged = try await self.decodeMergedItemsBlobData(
+            for: topic,
+            itemKeys: uniqueItemKeys,
+            as: type
+        ) else {
+            return nil
+        }
+
+        if let cacheKey {
+            self.storeDecodedBlob(merged.value, for: cacheKey.key, byteCount: merged.byteCount, generation: generation)
+        }
+        return merged.value
+    }
+
+}
+
 private extension RemoteConfigManager {
 
     /// Overrides a refresh's context to `.appStart` until the session's first config is committed, so the backend
@@ -961,6 +1070,57 @@ private extension RemoteConfigManager {
         }
     }
 
+    /// Reads a committed item, refreshing once if it is missing, along with the epoch it was read in.
+    func committedItem(
+        for topic: RemoteConfigTopic,
+        itemKey: String
+    ) async -> (item: RemoteConfiguration.ConfigItem, epoch: Int)? {
+        guard let itemSnapshot = await self.readCommittedStateSnapshot(refreshIfMissing: true, {
+            await self.committedTopic(topic)?[itemKey]
+        }),
+              let item = itemSnapshot.value else {
+            return nil
+        }
+
+        return (item, itemSnapshot.epoch)
+    }
+
+    /// Returns the decoded-blob cache key for merging `itemKeys`, or `nil` if any item is not committed with
+    /// a `blob_ref` yet; those reads take the uncached path, which handles refreshes and missing items.
+    /// The key comes with the epoch it was read in, so cache hits can be dropped after a clear or close.
+    func mergedBlobCacheKey<T>(
+        for topic: RemoteConfigTopic,
+        itemKeys: [String],
+        as type: T.Type
+    ) async -> (key: RemoteConfigDecodedBlobCache.Key, epoch: Int)? {
+        guard !itemKeys.isEmpty,
+              let snapshot = await self.readCurrentCommittedState({ await self.committedTopic(topic) }),
+              let committed = snapshot.value else {
+            return nil
+        }
+
+        let refs = itemKeys.compactMap { committed[$0]?.blobRef }
+        guard refs.count == itemKeys.count else { return nil }
+
+        return (.init(itemKeys: itemKeys, refs: refs, type: type), snapshot.epoch)
+    }
+
+    /// Caches a decoded blob value unless committed config changed while it was being read.
+    ///
+    /// Values keyed by refs read before a config change could otherwise outlive the `retainOnly(_:)` that
+    /// dropped those refs.
+    func storeDecodedBlob<T>(
+        _ value: T,
+        for key: RemoteConfigDecodedBlobCache.Key,
+        byteCount: Int,
+        generation: Int
+    ) {
+        self.lock.perform {
+            guard self.generation == generation else { return }
+            self.decodedBlobCache.store(value, for: key, byteCount: byteCount)
+        }
+    }
+
     /// Reads committed topic metadata off the caller's executor.
     func committedTopic(_ topic: RemoteConfigTopic) async -> RemoteConfiguration.ConfigTopic? {
         return await self.performRead {
@@ -975,11 +1135,47 @@ private extension RemoteConfigManager {
     func blobData(for item: RemoteConfiguration.ConfigItem) async -> Data? {
         guard let ref = item.blobRef else { return nil }
 
-        guard await self.blobFetcher.ensureDownloaded(ref: ref) else { return nil }
+        if let data = await self.restoreInlineBlob(ref: ref) {
+            return data
+        }
+
+        guard await self.blobFetcher.ensureDownloaded(ref: ref, urgency: self.onDemandUrgency(for: ref)) else {
+            return nil
+        }
 
         return await self.readBlob(ref: ref)
     }
 
+    /// The urgency of an on-demand read of `ref`, taking the deadline `prioritizeBlobs` set for it, if any.
+    ///
+    /// Expired deadlines are dropped rather than applied.
+    func onDemandUrgency(for ref: String) -> RemoteConfigBlobFetchUrgency {
+        let now = self.dateProvider.now()
+        let deadline: Date? = self.lock.perform {
+            self.blobDeadlines = self.blobDeadlines.filter { $0.value > now }
+            return self.blobDeadlines.removeValue(forKey: ref)
+        }
+
+        return deadline.map(RemoteConfigBlobFetchUrgency.onDemand.withDeadline) ?? .onDemand
+    }
+
+    /// Restores a blob missing from the blob store out of the persisted response container, if it was shipped
+    /// inline, so inline blobs whose extraction failed are not downloaded again.
+    ///
+    /// The container is reopened from its `ElementIndex` sidecar and memory-mapped, so this reads the index and
+    /// the pages of the one element rather than the whole container.
+    func restoreInlineBlob(ref: String) async -> Data? {
+        return await self.performRead {
+            guard !self.blobStore.contains(ref: ref),
+                  let element = self.diskCache.readContainer()?.element(withChecksum: ref),
+                  self.storeInlineBlob(element, ref: ref) else {
+                return nil
+            }
+
+            return self.blobStore.read(ref: ref)
+        }
+    }
+
     /// Reads committed blob bytes off the caller's executor.
     func readBlob(ref: String) async -> Data? {
         return await self.performRead {
@@ -1005,7 +1201,8 @@ private extension RemoteConfigManager {
         return persisted.prefetchBlobs.filter { cachedRefs.contains($0) }
     }
 
-    /// Persists the config sync state and any valid inline blobs from a successful container response.
+    /// Persists the config sync state, the response container and any valid inline blobs from a successful
+    /// container response.
     func persist(
         container: RemoteConfigContainer?,
         previous: PersistedRemoteConfiguration?,
@@ -1037,9 +1234,13 @@ private extension RemoteConfigManager {
         guard self.diskCache.write(persistedConfiguration) else { return false }
 
         if let container {
+            self.diskCache.writeContainer(container)
             self.extractInlineBlobs(from: container, keepingOnly: postSyncReferencedBlobRefs)
         }
         self.blobStore.retainOnly(postSyncReferencedBlobRefs)
+        self.decodedBlobCache.retainOnly(postSyncReferencedBlobRefs)
+        self.blobFetcher.retainOnly(postSyncReferencedBlobRefs)
+        self.blobDeadlines = self.blobDeadlines.filter { postSyncReferencedBlobRefs.contains($0.key) }
 
         Logger.debug(Strings.remoteConfig.persistedConfiguration(
             domain: response.domain,
@@ -1108,25 +1309,28 @@ private extension RemoteConfigManager {
         from container: RemoteConfigContainer,
         keepingOnly referencedBlobRefs: Set<String>
     ) {
-        for (ref, element) in container.inlineContentElements {
-            guard referencedBlobRefs.contains(ref) else { continue }
-
-            do {
-                try element.withDecodedPayloadBytes { bytes in
-                    guard RemoteConfigBlobRefHelpers.isValidPayload(bytes, expectedRef: ref) else {
-                        throw RCContainer.Parser.FormatError.checksumMismatch(
-                            expected: ref,
-                            actual: RemoteConfigBlobRefHelpers.ref(for: bytes)
-                        )
-                    }
-
-                    if self.blobStore.write(ref: ref, bytes: bytes) {
-                        Logger.verbose(Strings.remoteConfig.storedInlineBlob(ref, byteCount: bytes.count))
-                    }
-                }
-            } catch {
-                Logger.error(Strings.remoteConfig.skippingInvalidBlob(ref))
+        for (ref, element) in container.inlineContentElements where referencedBlobRefs.contains(ref) {
+            self.storeInlineBlob(element, ref: ref)
+        }
+    }
+
+    /// Writes the decoded payload of inline `element` to the blob store if it matches `ref`.
+    @discardableResult
+    func storeInlineBlob(_ element: RCContainer.Element, ref: String) -> Bool {
+        do {
+            // Decoded chunks are hashed and written as they are produced, so compressed inline blobs are
+            // never held in memory in full.
+            let byteCount = try self.blobStore.write(ref: ref) { writeChunk in
+                try element.forEachDecodedPayloadChunk(writeChunk)
             }
+
+            guard let byteCount else { return false }
+
+            Logger.verbose(Strings.remoteConfig.storedInlineBlob(ref, byteCount: byteCount))
+            return true
+        } catch {
+            Logger.error(Strings.remoteConfig.skippingInvalidBlob(ref))
+            return false
         }
     }
 
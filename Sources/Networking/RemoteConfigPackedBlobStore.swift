@@ -0,0 +1,721 @@
+//
+//  RemoteConfigPackedBlobStore.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import CryptoKit
+import Foundation
+
+/// Remote config blob store that appends blobs to a few large segment files instead of one file per blob.
+///
+/// Blobs are located through an offset index that is kept in memory. Each appended blob adds one record to
+/// the `index-journal` file, and the `index` snapshot is only rewritten atomically once the journal has grown
+/// to half its size, when refs are dropped, or on compaction; writing N blobs therefore costs O(N) index bytes.
+/// Reads map the segment file once and copy the blob's bytes out of the mapping, so loading many small blobs
+/// costs no per-blob `open` call. `retainOnly(_:)` drops refs from the index and compacts the live blobs into
+/// fresh segments once unreferenced bytes outweigh them.
+///
+/// Layout of the `index` file (all multi-byte integers little-endian):
+/// ```
+/// Header (8 bytes):  magic byte[2]="RP" | version u8 | reserved u8 | entry count u32
+/// Entry (40 bytes):  checksum byte[24]  | segment u32 | length u32 | offset u64
+/// Digest (32 bytes): SHA-256 of every preceding index byte
+/// ```
+/// Layout of each `index-journal` record, replayed over the snapshot in order:
+/// ```
+/// Entry (40 bytes):  as in the snapshot
+/// Digest (8 bytes):  first 8 bytes of the SHA-256 of the entry
+/// ```
+/// Segment bytes the index does not reference, such as the tail of an append that failed, are reclaimed by
+/// the next compaction. A missing or corrupted index only loses the cached blobs, which are fetched again.
+final class RemoteConfigPackedBlobStore: RemoteConfigBlobStoreType {
+
+    /// Where one blob lives inside the pack.
+    struct Location: Equatable {
+
+        let segment: UInt32
+        let offset: Int
+        let length: Int
+
+    }
+
+    static let defaultMaximumSegmentSize = 8 * 1024 * 1024
+
+    private let fileManager: FileManager
+    private let directoryURL: URL?
+    private let maximumSegmentSize: Int
+    private let lock = Lock(.nonRecursive)
+
+    /// One-file-per-blob store whose blobs are moved into the pack the first time the index is loaded.
+    private var legacyStore: RemoteConfigBlobStoreType?
+
+    /// Index and segment sizes, loaded from disk on first use and then kept in sync by every mutation.
+    private var state: PackState?
+
+    /// Segment files mapped by earlier reads. A segment's mapping is dropped whenever it grows or is deleted.
+    private var mappedSegments: [UInt32: Data] = [:]
+
+    init(
+        fileManager: FileManager = .default,
+        directoryURL: URL? = RemoteConfigPackedBlobStore.defaultDirectoryURL,
+        maximumSegmentSize: Int = RemoteConfigPackedBlobStore.defaultMaximumSegmentSize,
+        migratingFrom legacyStore: RemoteConfigBlobStoreType? = nil
+    ) {
+        self.fileManager = fileManager
+        self.directoryURL = directoryURL
+        self.maximumSegmentSize = maximumSegmentSize
+        self.legacyStore = legacyStore
+    }
+
+    func contains(ref: String) -> Bool {
+        guard let key = RCContainer.ChecksumKey(ref: ref) else {
+            return false
+        }
+
+        return self.lock.perform {
+            return self.loadedStateWithoutLock().entries[key] != nil
+        }
+    }
+
+    func read(ref: String) -> Data? {
+        guard let key = RCContainer.ChecksumKey(ref: ref) else {
+            return nil
+        }
+
+        return self.lock.perform {
+            guard let location = self.loadedStateWithoutLock().entries[key] else {
+                return nil
+            }
+
+            do {
+                return try self.blobDataWithoutLock(at: location)
+            } catch {
+                Logger.error(Strings.remoteConfig.failedToReadBlob(ref, error))
+                self.mutateStateWithoutLock { $0.entries[key] = nil }
+                return nil
+            }
+        }
+    }
+
+    @discardableResult
+    func write(
+        ref: String,
+        bytes: UnsafeRawBufferPointer
+    ) -> Bool {
+        guard let key = RCContainer.ChecksumKey(ref: ref) else {
+            Logger.error(Strings.remoteConfig.malformedBlobRef(ref))
+            return false
+        }
+
+        return self.lock.perform {
+            return self.appendBlobWithoutLock(key: key, ref: ref, bytes: bytes)
+        }
+    }
+
+    /// Streams chunks into a partial file outside the lock while hashing them, then appends the verified file
+    /// to the pack under the lock. Peak memory is a single chunk rather than the whole blob.
+    @discardableResult
+    func write(
+        ref: String,
+        streamingChunks writeChunks: (_ writeChunk: (UnsafeRawBufferPointer) throws -> Void) throws -> Void
+    ) throws -> Int? {
+        guard let directoryURL = self.directoryURL else {
+            Logger.error(Strings.remoteConfig.cacheURLNotAvailable)
+            return nil
+        }
+
+        guard let key = RCContainer.ChecksumKey(ref: ref) else {
+            Logger.error(Strings.remoteConfig.malformedBlobRef(ref))
+            return nil
+        }
+
+        let partialDirectoryURL = directoryURL.appendingPathComponent(
+            RemoteConfigBlobStore.partialDirectoryName,
+            isDirectory: true
+        )
+        let partialFileURL = partialDirectoryURL.appendingPathComponent(UUID().uuidString, isDirectory: false)
+        defer { try? self.fileManager.removeItem(at: partialFileURL) }
+
+        do {
+            try self.fileManager.createDirectory(
+                at: partialDirectoryURL,
+                withIntermediateDirectories: true,
+                attributes: nil
+            )
+        } catch {
+            Logger.error(Strings.remoteConfig.failedToWriteBlob(ref, error))
+            return nil
+        }
+
+        let byteCount: Int
+        do {
+            byteCount = try RemoteConfigBlobStore.stream(writeChunks, to: partialFileURL, expectedRef: ref)
+        } catch let error as RemoteConfigBlobStore.PartialFileWriteError {
+            Logger.error(Strings.remoteConfig.failedToWriteBlob(ref, error.underlyingError))
+            return nil
+        }
+
+        let blob: Data
+        do {
+            blob = try Data(contentsOf: partialFileURL, options: .mappedIfSafe)
+        } catch {
+            Logger.error(Strings.remoteConfig.failedToWriteBlob(ref, error))
+            return nil
+        }
+
+        return self.lock.perform {
+            let stored = blob.withUnsafeBytes { bytes in
+                self.appendBlobWithoutLock(key: key, ref: ref, bytes: bytes)
+            }
+            return stored ? byteCount : nil
+        }
+    }
+
+    func cachedRefs() -> Set<String> {
+        return self.lock.perform {
+            return Set(self.loadedStateWithoutLock().entries.keys.lazy.map(\.ref))
+        }
+    }
+
+    /// Drops every ref outside `refs` from the index, compacting the pack if most of it is now unreferenced.
+    func retainOnly(_ refs: Set<String>) {
+        var keys: Set<RCContainer.ChecksumKey> = []
+        for ref in refs {
+            if let key = RCContainer.ChecksumKey(ref: ref) {
+                keys.insert(key)
+            } else {
+                Logger.error(Strings.remoteConfig.malformedBlobRef(ref))
+            }
+        }
+
+        self.lock.perform {
+            self.mutateStateWithoutLock { state in
+                let entryCount = state.entries.count
+                state.entries = state.entries.filter { keys.contains($0.key) }
+
+                guard let directoryURL = self.directoryURL else { return }
+
+                if state.totalByteCount - state.liveByteCount > state.liveByteCount {
+                    self.compactWithoutLock(&state, in: directoryURL)
+                } else if state.entries.count != entryCount {
+                    self.writeIndexWithoutLock(&state, in: directoryURL)
+                }
+            }
+        }
+    }
+
+    func clear() {
+        self.lock.perform {
+            self.mappedSegments = [:]
+            self.legacyStore?.clear()
+            self.legacyStore = nil
+
+            guard let directoryURL = self.directoryURL,
+                  self.fileManager.fileExists(atPath: directoryURL.path) else {
+                self.state = PackState()
+                return
+            }
+
+            do {
+                try self.fileManager.removeItem(at: directoryURL)
+                self.state = PackState()
+            } catch {
+                Logger.error(Strings.remoteConfig.failedToClearBlobStore(error))
+                self.state = nil
+            }
+        }
+    }
+
+}
+
+extension RemoteConfigPackedBlobStore {
+
+    static let packsDirectoryName = "blob-packs"
+    static var defaultDirectoryURL: URL? {
+        return DirectoryHelper.baseUrl(for: RemoteConfigDiskCache.directoryType)?
+            .appendingPathComponent(RemoteConfigDiskCache.basePath, isDirectory: true)
+            .appendingPathComponent(Self.packsDirectoryName, isDirectory: true)
+    }
+
+    /// Serializes `entries` in the index layout described on `RemoteConfigPackedBlobStore`.
+    static func serializedIndex(_ entries: [RCContainer.ChecksumKey: Location]) -> Data {
+        var bytes: [UInt8] = []
+        bytes.reserveCapacity(Self.indexHeaderSize + entries.count * Self.indexEntrySize + Self.indexDigestSize)
+
+        bytes += [Self.indexMagic.0, Self.indexMagic.1, Self.indexVersion, 0]
+        Self.appendLittleEndian(UInt64(entries.count), count: 4, to: &bytes)
+
+        for (key, location) in entries {
+            Self.appendIndexEntry(key: key, location: location, to: &bytes)
+        }
+
+        bytes += SHA256.hash(data: bytes)
+        return Data(bytes)
+    }
+
+    /// Decodes a serialized index, returning `nil` if it is truncated, corrupted or from another version.
+    static func entries(fromSerializedIndex data: Data) -> [RCContainer.ChecksumKey: Location]? {
+        let bytes = [UInt8](data)
+        guard bytes.count >= Self.indexHeaderSize + Self.indexDigestSize else {
+            return nil
+        }
+
+        let digestOffset = bytes.count - Self.indexDigestSize
+        guard Array(SHA256.hash(data: bytes[..<digestOffset])) == Array(bytes[digestOffset...]),
+              bytes[0] == Self.indexMagic.0,
+              bytes[1] == Self.indexMagic.1,
+              bytes[2] == Self.indexVersion else {
+            return nil
+        }
+
+        let entryCount = Int(Self.littleEndianValue(in: bytes, at: 4, count: 4))
+        guard digestOffset - Self.indexHeaderSize == entryCount * Self.indexEntrySize else {
+            return nil
+        }
+
+        var entries: [RCContainer.ChecksumKey: Location] = [:]
+        entries.reserveCapacity(entryCount)
+        for index in 0..<entryCount {
+            let offset = Self.indexHeaderSize + index * Self.indexEntrySize
+            guard let entry = Self.indexEntry(in: bytes, at: offset) else {
+                return nil
+            }
+
+            entries[entry.key] = entry.location
+        }
+
+        return entries
+    }
+
+    /// Serializes one `index-journal` record for a blob appended at `location`.
+    static func serializedJournalRecord(key: RCContainer.ChecksumKey, location: Location) -> Data {
+        var bytes: [UInt8] = []
+        bytes.reserveCapacity(Self.journalRecordSize)
+
+        Self.appendIndexEntry(key: key, location: location, to: &bytes)
+        bytes += SHA256.hash(data: bytes).prefix(Self.journalDigestSize)
+        return Data(bytes)
+    }
+
+    /// Decodes the records of an `index-journal`, oldest first, stopping at the first torn or corrupted one.
+    /// - Returns: the records, and whether every byte of `data` belonged to one of them.
+    static func records(
+        fromSerializedJournal data: Data
+    ) -> (records: [(key: RCContainer.ChecksumKey, location: Location)], isComplete: Bool) {
+        let bytes = [UInt8](data)
+        var records: [(key: RCContainer.ChecksumKey, location: Location)] = []
+        records.reserveCapacity(bytes.count / Self.journalRecordSize)
+
+        var offset = 0
+        while offset + Self.journalRecordSize <= bytes.count {
+            let digestOffset = offset + Self.indexEntrySize
+            guard Array(SHA256.hash(data: bytes[offset..<digestOffset]).prefix(Self.journalDigestSize))
+                    == Array(bytes[digestOffset..<offset + Self.journalRecordSize]),
+                  let record = Self.indexEntry(in: bytes, at: offset) else {
+                break
+            }
+
+            records.append(record)
+            offset += Self.journalRecordSize
+        }
+
+        return (records, offset == bytes.count)
+    }
+
+}
+
+private extension RemoteConfigPackedBlobStore {
+
+    struct PackState {
+
+        var entries: [RCContainer.ChecksumKey: Location] = [:]
+
+        /// On-disk byte count of every segment file, including bytes no entry references.
+        var segmentSizes: [UInt32: Int] = [:]
+
+        /// The segment new blobs are appended to.
+        var activeSegment: UInt32 = 0
+
+        /// Records appended to `index-journal` since the `index` snapshot was last written.
+        var journalRecordCount = 0
+
+        var liveByteCount: Int {
+            return self.entries.values.reduce(0) { $0 + $1.length }
+        }
+
+        var totalByteCount: Int {
+            return self.segmentSizes.values.reduce(0, +)
+        }
+
+    }
+
+    static let indexFileName = "index"
+    static let journalFileName = "index-journal"
+    static let segmentFilePrefix = "segment-"
+    static let indexMagic = (UInt8(ascii: "R"), UInt8(ascii: "P"))
+    static let indexVersion: UInt8 = 1
+    static let indexHeaderSize = 8
+    static let indexEntrySize = 40
+    static let indexDigestSize = 32
+    static let journalDigestSize = 8
+    static let journalRecordSize = 48
+
+    /// Journals shorter than this are never folded into the snapshot, however small the index is.
+    static let minimumJournalRecordCountBeforeSnapshot = 64
+
+    static func segmentURL(_ segment: UInt32, in directoryURL: URL) -> URL {
+        return directoryURL.appendingPathComponent("\(Self.segmentFilePrefix)\(segment)", isDirectory: false)
+    }
+
+    func loadedStateWithoutLock() -> PackState {
+        if let state = self.state {
+            return state
+        }
+
+        var state = PackState()
+        if let directoryURL = self.directoryURL {
+            state.segmentSizes = self.scannedSegmentSizes(in: directoryURL)
+            state.activeSegment = state.segmentSizes.keys.max() ?? 0
+
+            let indexURL = directoryURL.appendingPathComponent(Self.indexFileName, isDirectory: false)
+            var entries: [RCContainer.ChecksumKey: Location] = [:]
+            if let serialized = try? Data(contentsOf: indexURL),
+               let snapshotEntries = Self.entries(fromSerializedIndex: serialized) {
+                entries = snapshotEntries
+            }
+
+            let journalURL = directoryURL.appendingPathComponent(Self.journalFileName, isDirectory: false)
+            var isJournalComplete = true
+            if let serialized = try? Data(contentsOf: journalURL) {
+                let journal = Self.records(fromSerializedJournal: serialized)
+                for record in journal.records {
+                    entries[record.key] = record.location
+                }
+                state.journalRecordCount = journal.records.count
+                isJournalComplete = journal.isComplete
+            }
+
+            // Entries pointing past the end of their segment describe appends that never reached disk.
+            let segmentSizes = state.segmentSizes
+            state.entries = entries.filter { _, location in
+                location.length == 0
+                    || location.offset + location.length <= segmentSizes[location.segment] ?? 0
+            }
+
+            // Records appended after a torn one would never be replayed, so start a fresh journal.
+            if !isJournalComplete {
+                self.writeIndexWithoutLock(&state, in: directoryURL)
+            }
+
+            self.migrateLegacyBlobsWithoutLock(into: &state, in: directoryURL)
+        }
+
+        self.state = state
+        return state
+    }
+
+    /// Moves every blob cached by `legacyStore` into the pack and then clears it, so this runs at most once.
+    func migrateLegacyBlobsWithoutLock(into state: inout PackState, in directoryURL: URL) {
+        guard let legacyStore = self.legacyStore else { return }
+        self.legacyStore = nil
+
+        let refs = legacyStore.cachedRefs()
+        guard !refs.isEmpty else { return }
+
+        do {
+            try self.fileManager.createDirectory(at: directoryURL, withIntermediateDirectories: true, attributes: nil)
+        } catch {
+            Logger.error(Strings.remoteConfig.failedToWriteBlobPackIndex(error))
+            return
+        }
+
+        var migratedCount = 0
+        for ref in refs {
+            guard let key = RCContainer.ChecksumKey(ref: ref),
+                  state.entries[key] == nil,
+                  let blob = legacyStore.read(ref: ref) else {
+                continue
+            }
+
+            do {
+                state.entries[key] = try blob.withUnsafeBytes { bytes in
+                    try self.appendWithoutLock(bytes, to: &state, in: directoryURL)
+                }
+                migratedCount += 1
+            } catch {
+                Logger.error(Strings.remoteConfig.failedToWriteBlob(ref, error))
+            }
+        }
+
+        // Blobs that failed to move are fetched again when needed.
+        self.writeIndexWithoutLock(&state, in: directoryURL)
+        legacyStore.clear()
+        Logger.debug(Strings.remoteConfig.migratedBlobsToPack(migratedCount))
+    }
+
+    /// Runs `body` on the loaded state without leaving a second reference to it in `self.state`, so that
+    /// mutating its dictionaries does not copy them.
+    @discardableResult
+    func mutateStateWithoutLock<T>(_ body: (inout PackState) throws -> T) rethrows -> T {
+        var state = self.loadedStateWithoutLock()
+        self.state = nil
+        defer { self.state = state }
+
+        return try body(&state)
+    }
+
+    func scannedSegmentSizes(in directoryURL: URL) -> [UInt32: Int] {
+        guard let contents = try? self.fileManager.contentsOfDirectory(atPath: directoryURL.path) else {
+            return [:]
+        }
+
+        return contents.reduce(into: [:]) { sizes, fileName in
+            guard fileName.hasPrefix(Self.segmentFilePrefix),
+                  let segment = UInt32(fileName.dropFirst(Self.segmentFilePrefix.count)),
+                  let attributes = try? self.fileManager.attributesOfItem(
+                    atPath: Self.segmentURL(segment, in: directoryURL).path
+                  ),
+                  let size = (attributes[.size] as? NSNumber)?.intValue else {
+                return
+            }
+
+            sizes[segment] = size
+        }
+    }
+
+    func appendBlobWithoutLock(key: RCContainer.ChecksumKey, ref: String, bytes: UnsafeRawBufferPointer) -> Bool {
+        guard let directoryURL = self.directoryURL else {
+            Logger.error(Strings.remoteConfig.cacheURLNotAvailable)
+            return false
+        }
+
+        return self.mutateStateWithoutLock { state in
+            // Refs are content checksums, so a blob that is already packed never needs rewriting.
+            guard state.entries[key] == nil else {
+                return true
+            }
+
+            do {
+                try self.fileManager.createDirectory(
+                    at: directoryURL,
+                    withIntermediateDirectories: true,
+                    attributes: nil
+                )
+                let location = try self.appendWithoutLock(bytes, to: &state, in: directoryURL)
+                state.entries[key] = location
+                self.recordAppendWithoutLock(key: key, location: location, in: &state, directoryURL: directoryURL)
+            } catch {
+                Logger.error(Strings.remoteConfig.failedToWriteBlob(ref, error))
+                return false
+            }
+
+            return true
+        }
+    }
+
+    /// Appends `bytes` to the active segment, starting a new one if they would grow it past the maximum size.
+    func appendWithoutLock(
+        _ bytes: UnsafeRawBufferPointer,
+        to state: inout PackState,
+        in directoryURL: URL
+    ) throws -> Location {
+        // Index entries store blob lengths as `u32`.
+        guard bytes.count <= UInt32.max else {
+            throw CocoaError(.fileWriteOutOfSpace)
+        }
+
+        let activeSize = state.segmentSizes[state.activeSegment] ?? 0
+        if activeSize > 0 && activeSize + bytes.count > self.maximumSegmentSize {
+            state.activeSegment += 1
+        }
+
+        let segment = state.activeSegment
+        let offset = state.segmentSizes[segment] ?? 0
+
+        guard let output = OutputStream(url: Self.segmentURL(segment, in: directoryURL), append: true) else {
+            throw CocoaError(.fileWriteUnknown)
+        }
+
+        output.open()
+        defer { output.close() }
+
+        do {
+            try RemoteConfigBlobStore.writeAll(bytes, to: output)
+        } catch let error as RemoteConfigBlobStore.PartialFileWriteError {
+            // The segment may now end in a partial blob, so later offsets cannot be derived from its size.
+            state.activeSegment += 1
+            throw error.underlyingError
+        }
+
+        state.segmentSizes[segment] = offset + bytes.count
+        self.mappedSegments[segment] = nil
+
+        return Location(segment: segment, offset: offset, length: bytes.count)
+    }
+
+    func blobDataWithoutLock(at location: Location) throws -> Data {
+        guard location.length > 0 else {
+            return Data()
+        }
+
+        let segmentData: Data
+        if let mapped = self.mappedSegments[location.segment] {
+            segmentData = mapped
+        } else if let directoryURL = self.directoryURL {
+            // Segments only ever grow while mapped ones are in use, and are replaced rather than rewritten.
+            segmentData = try Data(
+                contentsOf: Self.segmentURL(location.segment, in: directoryURL),
+                options: .mappedIfSafe
+            )
+            self.mappedSegments[location.segment] = segmentData
+        } else {
+            throw CocoaError(.fileNoSuchFile)
+        }
+
+        guard location.offset + location.length <= segmentData.count else {
+            throw CocoaError(.fileReadCorruptFile)
+        }
+
+        let start = segmentData.index(segmentData.startIndex, offsetBy: location.offset)
+        return segmentData.subdata(in: start..<segmentData.index(start, offsetBy: location.length))
+    }
+
+    /// Persists a newly appended blob's entry, folding the journal into a new snapshot once it has grown to half
+    /// the size of the index so that total index writes stay linear in the number of blobs.
+    func recordAppendWithoutLock(
+        key: RCContainer.ChecksumKey,
+        location: Location,
+        in state: inout PackState,
+        directoryURL: URL
+    ) {
+        let maximumJournalRecordCount = max(Self.minimumJournalRecordCountBeforeSnapshot, state.entries.count / 2)
+        let journalURL = directoryURL.appendingPathComponent(Self.journalFileName, isDirectory: false)
+
+        guard state.journalRecordCount < maximumJournalRecordCount,
+              let output = OutputStream(url: journalURL, append: true) else {
+            self.writeIndexWithoutLock(&state, in: directoryURL)
+            return
+        }
+
+        output.open()
+        defer { output.close() }
+
+        do {
+            try Self.serializedJournalRecord(key: key, location: location).withUnsafeBytes { bytes in
+                try RemoteConfigBlobStore.writeAll(bytes, to: output)
+            }
+            state.journalRecordCount += 1
+        } catch {
+            // The journal may now end in a torn record, which the snapshot makes irrelevant.
+            self.writeIndexWithoutLock(&state, in: directoryURL)
+        }
+    }
+
+    func writeIndexWithoutLock(_ state: inout PackState, in directoryURL: URL) {
+        do {
+            try self.writeSnapshotWithoutLock(&state, in: directoryURL)
+        } catch {
+            Logger.error(Strings.remoteConfig.failedToWriteBlobPackIndex(error))
+        }
+    }
+
+    /// Atomically rewrites the `index` snapshot from `state` and deletes the journal it now includes.
+    ///
+    /// A journal left behind by an interruption between the two steps is replayed over the new snapshot on the
+    /// next launch. That can only re-add refs whose bytes are still in a live segment, which is harmless since
+    /// refs are content checksums; refs into deleted segments are dropped when the index is loaded.
+    func writeSnapshotWithoutLock(_ state: inout PackState, in directoryURL: URL) throws {
+        try Self.serializedIndex(state.entries).write(
+            to: directoryURL.appendingPathComponent(Self.indexFileName, isDirectory: false),
+            options: .atomic
+        )
+
+        try? self.fileManager.removeItem(
+            at: directoryURL.appendingPathComponent(Self.journalFileName, isDirectory: false)
+        )
+        state.journalRecordCount = 0
+    }
+
+    /// Copies every live blob into new segments, points the index at them and deletes the old segments.
+    ///
+    /// The old segments are only deleted once the new index is on disk, so an interrupted compaction leaves
+    /// either the old pack or the new one readable; leftover segments are reclaimed by the next compaction.
+    func compactWithoutLock(_ state: inout PackState, in directoryURL: URL) {
+        var compacted = PackState()
+        compacted.activeSegment = (state.segmentSizes.keys.max() ?? state.activeSegment) + 1
+
+        let liveEntries = state.entries.sorted { lhs, rhs in
+            (lhs.value.segment, lhs.value.offset) < (rhs.value.segment, rhs.value.offset)
+        }
+
+        do {
+            for (key, location) in liveEntries {
+                guard let blob = try? self.blobDataWithoutLock(at: location) else {
+                    continue
+                }
+
+                compacted.entries[key] = try blob.withUnsafeBytes { bytes in
+                    try self.appendWithoutLock(bytes, to: &compacted, in: directoryURL)
+                }
+            }
+
+            try self.writeSnapshotWithoutLock(&compacted, in: directoryURL)
+        } catch {
+            Logger.error(Strings.remoteConfig.failedToCompactBlobPack(error))
+            for segment in compacted.segmentSizes.keys {
+                try? self.fileManager.removeItem(at: Self.segmentURL(segment, in: directoryURL))
+                self.mappedSegments[segment] = nil
+            }
+            self.writeIndexWithoutLock(&state, in: directoryURL)
+            return
+        }
+
+        for segment in state.segmentSizes.keys {
+            try? self.fileManager.removeItem(at: Self.segmentURL(segment, in: directoryURL))
+            self.mappedSegments[segment] = nil
+        }
+
+        state = compacted
+    }
+
+    static func appendIndexEntry(key: RCContainer.ChecksumKey, location: Location, to bytes: inout [UInt8]) {
+        key.withUnsafeBytes { bytes += $0 }
+        Self.appendLittleEndian(UInt64(location.segment), count: 4, to: &bytes)
+        Self.appendLittleEndian(UInt64(location.length), count: 4, to: &bytes)
+        Self.appendLittleEndian(UInt64(location.offset), count: 8, to: &bytes)
+    }
+
+    /// Decodes the 40-byte index entry starting at `offset`, or `nil` if its blob offset does not fit an `Int`.
+    static func indexEntry(
+        in bytes: [UInt8],
+        at offset: Int
+    ) -> (key: RCContainer.ChecksumKey, location: Location)? {
+        let checksumEnd = offset + RCContainer.ChecksumKey.byteCount
+        let rawOffset = Self.littleEndianValue(in: bytes, at: checksumEnd + 8, count: 8)
+        guard let blobOffset = Int(exactly: rawOffset) else {
+            return nil
+        }
+
+        let key = bytes[offset..<checksumEnd].withUnsafeBytes { RCContainer.ChecksumKey(bytes: $0) }
+        return (key, Location(
+            segment: UInt32(Self.littleEndianValue(in: bytes, at: checksumEnd, count: 4)),
+            offset: blobOffset,
+            length: Int(Self.littleEndianValue(in: bytes, at: checksumEnd + 4, count: 4))
+        ))
+    }
+
+    static func littleEndianValue(in bytes: [UInt8], at offset: Int, count: Int) -> UInt64 {
+        return (0..<count).reduce(UInt64(0)) { value, byteIndex in
+            value | UInt64(bytes[offset + byteIndex]) << (8 * UInt64(byteIndex))
+        }
+    }
+
+    static func appendLittleEndian(_ value: UInt64, count: Int, to bytes: inout [UInt8]) {
+        for byteIndex in 0..<count {
+            bytes.append(UInt8(truncatingIfNeeded: value >> (8 * UInt64(byteIndex))))
+        }
+    }
+
+}
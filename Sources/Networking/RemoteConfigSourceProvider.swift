@@ -55,6 +55,10 @@ protocol RemoteConfigSourceProviderType: AnyObject {
     /// The current healthy API base source, or `nil` once every API source has been reported unhealthy.
     func currentAPISource() -> RemoteConfigSourceHandle?
 
+    /// The source `purpose` would fall back to after the current one, without falling back. Used to hedge
+    /// slow requests; the returned handle is never current, so reporting it unhealthy is a no-op.
+    func peekNext(for purpose: RemoteConfigSourceHandle.Purpose) -> RemoteConfigSourceHandle?
+
     /// Falls back to the next source for the handle's purpose. No-op if `handle` is no longer current.
     func reportUnhealthy(_ handle: RemoteConfigSourceHandle)
 
@@ -73,6 +77,10 @@ extension RemoteConfigSourceProviderType {
         return self.getCurrent(for: .api)
     }
 
+    func peekNext(for purpose: RemoteConfigSourceHandle.Purpose) -> RemoteConfigSourceHandle? {
+        return nil
+    }
+
 }
 
 /// The address book for remote config: hands out the current healthy api and blob sources and
@@ -92,6 +100,9 @@ extension RemoteConfigSourceProviderType {
 /// retries the primary at most once per interval. Blob failover has no such timer: it is restarted
 /// per fetch cycle by its callers.
 ///
+/// When a `healthMonitor` is given, sources whose recent requests went badly move behind the rest of their
+/// priority tier whenever a list is built or restarted.
+///
 /// - Note: Thread-safe.
 final class RemoteConfigSourceProvider: RemoteConfigSourceProviderType {
 
@@ -117,6 +128,7 @@ final class RemoteConfigSourceProvider: RemoteConfigSourceProviderType {
     private let topicStore: RemoteConfigTopicStoreType?
     private let randomizer: WeightedSourceRandomizer?
     private let dateProvider: DateProvider
+    private let healthRank: ((RemoteConfigSource) -> Int)?
     private let lock = Lock()
 
     /// Topic the current failovers were built from. `nil` means there is no sources topic (absent, or
@@ -133,20 +145,26 @@ final class RemoteConfigSourceProvider: RemoteConfigSourceProviderType {
     init(
         topicStore: RemoteConfigTopicStoreType?,
         randomizer: WeightedSourceRandomizer? = nil,
-        dateProvider: DateProvider = DateProvider()
+        dateProvider: DateProvider = DateProvider(),
+        healthMonitor: SourceHealthMonitorType? = nil
     ) {
+        let healthRank = healthMonitor.map(Self.healthRank(using:))
+
         self.topicStore = topicStore
         self.randomizer = randomizer
         self.dateProvider = dateProvider
+        self.healthRank = healthRank
         self.api = SourceFailover(
             purpose: .api,
             sources: Self.dedupe(Self.sources(from: nil, for: .api)),
-            randomizer: randomizer
+            randomizer: randomizer,
+            healthRank: healthRank
         )
         self.blob = SourceFailover(
             purpose: .blob,
             sources: Self.dedupe(Self.sources(from: nil, for: .blob)),
-            randomizer: randomizer
+            randomizer: randomizer,
+            healthRank: healthRank
         )
     }
 
@@ -158,6 +176,14 @@ final class RemoteConfigSourceProvider: RemoteConfigSourceProviderType {
         }
     }
 
+    func peekNext(for purpose: RemoteConfigSourceHandle.Purpose) -> RemoteConfigSourceHandle? {
+        return self.lock.perform {
+            self.rebuildIfNeeded()
+            self.restartAPIIfExpired()
+            return self.failover(for: purpose).next
+        }
+    }
+
     func reportUnhealthy(_ handle: RemoteConfigSourceHandle) {
         self.lock.perform {
             // Rebuild happened, no need to report unhealthy
@@ -236,12 +262,14 @@ final class RemoteConfigSourceProvider: RemoteConfigSourceProviderType {
             purpose: .api,
             sources: Self.dedupe(Self.sources(from: topic, for: .api)),
             randomizer: self.randomizer,
+            healthRank: self.healthRank,
             initialToken: nextToken
         )
         self.blob = SourceFailover(
             purpose: .blob,
             sources: Self.dedupe(Self.sources(from: topic, for: .blob)),
             randomizer: self.randomizer,
+            healthRank: self.healthRank,
             initialToken: nextToken
         )
         self.sourcesTopic = topic
@@ -249,6 +277,15 @@ final class RemoteConfigSourceProvider: RemoteConfigSourceProviderType {
         return true
     }
 
+    /// Ranks a source by the passive health of its host: sources without recent traffic rank as healthy.
+    private static func healthRank(using monitor: SourceHealthMonitorType) -> (RemoteConfigSource) -> Int {
+        return { source in
+            // Blob sources are `url_format` templates; the placeholder only ever appears in the path.
+            let url = URL(string: source.url.replacingOccurrences(of: "{blob_ref}", with: "_"))
+            return monitor.health(ofHost: url?.host)?.verdict.rawValue ?? SourceHealthMonitor.Verdict.healthy.rawValue
+        }
+    }
+
     /// The sources for `purpose`, parsed from the `sources` `topic`. Api falls back to the embedded
     /// default while the topic has no usable api sources; blob has no default, so it can be empty.
     private static func sources(
@@ -327,10 +364,11 @@ private final class SourceFailover {
         purpose: RemoteConfigSourceHandle.Purpose,
         sources: [RemoteConfigSource],
         randomizer: WeightedSourceRandomizer?,
+        healthRank: ((RemoteConfigSource) -> Int)? = nil,
         initialToken: Int = 0
     ) {
         self.purpose = purpose
-        self.selector = WeightedSourceSelector(sources: sources, randomizer: randomizer)
+        self.selector = WeightedSourceSelector(sources: sources, randomizer: randomizer, healthRank: healthRank)
         self.token = initialToken
     }
 
@@ -345,6 +383,14 @@ private final class SourceFailover {
         }
     }
 
+    /// The source after `current`, stamped with a token that is already stale so it can never advance the
+    /// list: a hedge against a slow source says nothing about that source's health.
+    var next: RemoteConfigSourceHandle? {
+        return self.selector.next.map {
+            RemoteConfigSourceHandle(purpose: self.purpose, source: $0, token: self.token - 1)
+        }
+    }
+
     /// Advances past the handle's source, returning whether it did (stale reports are ignored).
     @discardableResult
     func reportUnhealthy(_ handle: RemoteConfigSourceHandle) -> Bool {
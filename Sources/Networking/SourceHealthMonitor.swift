@@ -0,0 +1,154 @@
+//
+//  SourceHealthMonitor.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+
+protocol SourceHealthMonitorType: AnyObject, Sendable {
+
+    /// Records the outcome of a real request to `host`. Requests without a host are ignored.
+    func record(_ outcome: SourceHealthMonitor.Outcome, host: String?)
+
+    /// What recent requests say about `host`, or `nil` if there are too few of them to tell.
+    func health(ofHost host: String?) -> SourceHealthMonitor.Health?
+
+}
+
+/// Passively tracks how each host behaves, from the requests the SDK makes anyway.
+///
+/// Every outcome updates exponentially weighted moving averages of the host's latency, error rate and
+/// timeout rate. Once a host has been quiet for `freshnessInterval` its averages are dropped, so a verdict
+/// is always based on recent traffic; callers fall back to an active probe when there is none.
+///
+/// Thread-safe.
+final class SourceHealthMonitor: SourceHealthMonitorType {
+
+    enum Outcome: Equatable {
+
+        /// The host answered, even if with an error status that is not its fault (e.g. a 4xx).
+        case success(latency: TimeInterval)
+
+        /// A connection failure or 5xx that points at the host.
+        case failure
+
+        case timeout
+
+    }
+
+    /// Ordered from best to worst.
+    enum Verdict: Int {
+
+        case healthy
+        case degraded
+        case unhealthy
+
+    }
+
+    struct Health: Equatable {
+
+        /// Average latency of successful requests, or `nil` if none succeeded.
+        var latency: TimeInterval?
+        var errorRate: Double
+        var timeoutRate: Double
+        var sampleCount: Int
+
+        var verdict: Verdict {
+            if self.errorRate >= SourceHealthMonitor.unhealthyErrorRate {
+                return .unhealthy
+            }
+
+            if self.errorRate >= SourceHealthMonitor.degradedErrorRate
+                || self.timeoutRate >= SourceHealthMonitor.degradedTimeoutRate
+                || (self.latency ?? 0) >= SourceHealthMonitor.degradedLatency {
+                return .degraded
+            }
+
+            return .healthy
+        }
+
+    }
+
+    static let smoothingFactor = 0.2
+    static let minimumSampleCount = 3
+    static let freshnessInterval: TimeInterval = 60
+
+    static let degradedErrorRate = 0.2
+    static let unhealthyErrorRate = 0.6
+    static let degradedTimeoutRate = 0.1
+    static let degradedLatency: TimeInterval = 2
+
+    private struct Entry {
+        var health: Health
+        var updatedAt: Date
+    }
+
+    private let entries: Atomic<[String: Entry]> = .init([:])
+    private let dateProvider: DateProvider
+
+    init(dateProvider: DateProvider = DateProvider()) {
+        self.dateProvider = dateProvider
+    }
+
+    func record(_ outcome: Outcome, host: String?) {
+        guard let host else { return }
+
+        let now = self.dateProvider.now()
+        let (error, timeout, latency): (Double, Double, TimeInterval?) = {
+            switch outcome {
+            case let .success(latency): return (0, 0, latency)
+            case .failure: return (1, 0, nil)
+            case .timeout: return (1, 1, nil)
+            }
+        }()
+
+        self.entries.modify { entries in
+            guard var entry = entries[host], !self.isStale(entry, now: now) else {
+                entries[host] = Entry(
+                    health: Health(latency: latency, errorRate: error, timeoutRate: timeout, sampleCount: 1),
+                    updatedAt: now
+                )
+                return
+            }
+
+            entry.health.errorRate = Self.average(entry.health.errorRate, error)
+            entry.health.timeoutRate = Self.average(entry.health.timeoutRate, timeout)
+            if let latency {
+                entry.health.latency = entry.health.latency.map { Self.average($0, latency) } ?? latency
+            }
+            entry.health.sampleCount += 1
+            entry.updatedAt = now
+            entries[host] = entry
+        }
+    }
+
+    func health(ofHost host: String?) -> Health? {
+        guard let host, let entry = self.entries.value[host] else { return nil }
+
+        guard entry.health.sampleCount >= Self.minimumSampleCount,
+              !self.isStale(entry, now: self.dateProvider.now()) else {
+            return nil
+        }
+
+        return entry.health
+    }
+
+    private func isStale(_ entry: Entry, now: Date) -> Bool {
+        return now.timeIntervalSince(entry.updatedAt) >= Self.freshnessInterval
+    }
+
+}
+
+private extension SourceHealthMonitor {
+
+    static func average(_ current: Double, _ sample: Double) -> Double {
+        return current + Self.smoothingFactor * (sample - current)
+    }
+
+}
+
+// @unchecked because the compiler can't verify the hand-rolled synchronization:
+// all mutable state is guarded by `Atomic`.
+extension SourceHealthMonitor: @unchecked Sendable {}
@@ -40,27 +40,41 @@ private struct SystemWeightedSourceRandomizer: WeightedSourceRandomizer {
 ///
 /// The order is computed up front: priority tiers from lowest to highest, each tier arranged into a
 /// weight-biased random order. Negative weights are treated as `0`; when a group's weights sum to
-/// `0`, the next source is drawn uniformly at random.
+/// `0`, the next source is drawn uniformly at random. If a `healthRank` is given, sources it ranks worse
+/// move behind the rest of their tier, keeping the weighted order among equals. Ranks are read again
+/// on every `reset()`, so the order follows how sources have been behaving.
 ///
 /// - Note: Not thread-safe. Callers sharing an instance must serialize access.
 class WeightedSourceSelector<Source: WeightedSource> {
 
-    private let orderedSources: [Source]
+    private let weightedSources: [Source]
+    private let healthRank: ((Source) -> Int)?
+    private var orderedSources: [Source]
     private var iterator: IndexingIterator<[Source]>
 
     /// The source currently in use, or `nil` if there are no sources left to try.
     private(set) var current: Source?
 
+    /// - Parameter healthRank: Lower is better. Only compared between sources of the same priority.
     init(
         sources: [Source],
-        randomizer: WeightedSourceRandomizer? = nil
+        randomizer: WeightedSourceRandomizer? = nil,
+        healthRank: ((Source) -> Int)? = nil
     ) {
         let randomizer = randomizer ?? SystemWeightedSourceRandomizer()
-        self.orderedSources = Self.computeOrder(of: sources, randomizer: randomizer)
+        self.weightedSources = Self.computeOrder(of: sources, randomizer: randomizer)
+        self.healthRank = healthRank
+        self.orderedSources = Self.rankedByHealth(self.weightedSources, healthRank: healthRank)
         self.iterator = self.orderedSources.makeIterator()
         self.current = self.iterator.next()
     }
 
+    /// The source after `current` in the fallback order, without moving to it. `nil` if none remain.
+    var next: Source? {
+        var iterator = self.iterator
+        return iterator.next()
+    }
+
     /// Moves to the next source in the fallback order. Returns `nil` if none remain.
     @discardableResult
     func advance() -> Source? {
@@ -70,6 +84,7 @@ class WeightedSourceSelector<Source: WeightedSource> {
 
     /// Rewinds to the first source in the fallback order.
     func reset() {
+        self.orderedSources = Self.rankedByHealth(self.weightedSources, healthRank: self.healthRank)
         self.iterator = self.orderedSources.makeIterator()
         self.current = self.iterator.next()
     }
@@ -84,6 +99,16 @@ class WeightedSourceSelector<Source: WeightedSource> {
             .flatMap { weightedShuffle(sourcesByPriority[$0] ?? [], randomizer: randomizer) }
     }
 
+    /// Stable-sorts `sources`, already in tier order, by health within each tier.
+    private static func rankedByHealth(_ sources: [Source], healthRank: ((Source) -> Int)?) -> [Source] {
+        guard let healthRank, sources.count > 1 else { return sources }
+
+        return sources.enumerated()
+            .map { (index: $0.offset, source: $0.element, rank: healthRank($0.element)) }
+            .sorted { ($0.source.priority, $0.rank, $0.index) < ($1.source.priority, $1.rank, $1.index) }
+            .map(\.source)
+    }
+
     private static func weightedShuffle(
         _ tier: [Source],
         randomizer: WeightedSourceRandomizer
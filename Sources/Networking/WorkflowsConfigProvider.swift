@@ -14,6 +14,7 @@ protocol WorkflowsConfigProviderType {
     func offeringIdByWorkflowId() async -> [String: String]
     func workflowId(forOfferingId offeringId: String) async -> String?
     func getWorkflow(workflowId: String) async -> Result<WorkflowDataResult, WorkflowResolutionError>
+    func prioritizeWorkflows(_ workflowIds: [String], within timeInterval: TimeInterval) async
     func decodeCachedWorkflowForAssetPrewarming(
         workflowId: String
     ) async -> Result<WorkflowDataResult, WorkflowResolutionError>
@@ -102,6 +103,12 @@ final class WorkflowsConfigProvider: WorkflowsConfigProviderType {
         return map[offeringId]
     }
 
+    /// Gives the bodies of `workflowIds` a download deadline `timeInterval` from now, so a workflow that is
+    /// about to be read doesn't wait behind prefetched blobs. Bodies that are already downloaded are left alone.
+    func prioritizeWorkflows(_ workflowIds: [String], within timeInterval: TimeInterval) async {
+        await self.manager.prioritizeBlobs(for: .workflows, itemKeys: workflowIds, within: timeInterval)
+    }
+
     /// Builds the offeringId → workflowId map in a stable pass over `topic`. A duplicate `offeringId`
     /// across items signals a backend issue and is logged once per rebuild; the last workflow id wins
     /// without relying on Swift dictionary iteration order.
@@ -419,7 +419,11 @@ public typealias StartPurchaseBlock = (@escaping PurchaseCompletedBlock) -> Void
             : StoreKit2TransactionFetcher(diagnosticsTracker: diagnosticsTracker)
 
         let remoteConfigDiskCache = systemInfo.remoteConfigEnabled ? RemoteConfigDiskCache() : nil
-        let apiSourceProvider = RemoteConfigSourceProvider(topicStore: remoteConfigDiskCache)
+        // Fed by every request to a source (both backend HTTPClients and the blob downloader) and read
+        // when ordering sources and deciding whether a failing one needs a health check.
+        let sourceHealthMonitor = SourceHealthMonitor()
+        let apiSourceProvider = RemoteConfigSourceProvider(topicStore: remoteConfigDiskCache,
+                                                           healthMonitor: sourceHealthMonitor)
 
         // One instance for every request kind that consults the per-host fail-fast memory: both backend
         // HTTPClients and the blob downloader.
@@ -441,7 +445,8 @@ public typealias StartPurchaseBlock = (@escaping PurchaseCompletedBlock) -> Void
             ),
             diagnosticsTracker: diagnosticsTracker,
             apiSourceProvider: apiSourceProvider,
-            timeoutManager: requestTimeoutManager
+            timeoutManager: requestTimeoutManager,
+            sourceHealthMonitor: sourceHealthMonitor
         )
 
         let paymentQueueWrapper: EitherPaymentQueueWrapper = systemInfo.storeKitVersion.isStoreKit2EnabledAndAvailable
@@ -527,11 +532,14 @@ public typealias StartPurchaseBlock = (@escaping PurchaseCompletedBlock) -> Void
         let remoteConfigManager: RemoteConfigManagerType = {
             guard let remoteConfigDiskCache else { return NoOpRemoteConfigManager() }
 
-            let blobStore = RemoteConfigBlobStore()
+            let blobStore = RemoteConfigPackedBlobStore(migratingFrom: RemoteConfigBlobStore())
             let blobFetcher = RemoteConfigBlobFetcher(
                 blobStore: blobStore,
                 sourceProvider: apiSourceProvider,
-                downloader: URLSessionRemoteConfigBlobDownloader(timeoutManager: requestTimeoutManager)
+                downloader: URLSessionRemoteConfigBlobDownloader(timeoutManager: requestTimeoutManager,
+                                                                 sourceHealthMonitor: sourceHealthMonitor),
+                partialDownloads: RemoteConfigBlobPartialDownloadStore(),
+                diagnosticsTracker: diagnosticsTracker
             )
 
             return RemoteConfigManager(
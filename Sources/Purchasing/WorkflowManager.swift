@@ -91,6 +91,12 @@ class WorkflowManager: WorkflowAssetPrewarmingType {
         return await self.workflowsConfigProvider.offeringIdByWorkflowId()
     }
 
+    /// Asks for the bodies of `workflowIds` to be downloaded within `timeInterval`, ahead of prefetched blobs,
+    /// for a caller that is about to read one of them.
+    func prioritizeWorkflows(_ workflowIds: [String], within timeInterval: TimeInterval) async {
+        await self.workflowsConfigProvider.prioritizeWorkflows(workflowIds, within: timeInterval)
+    }
+
     func workflowId(forOfferingId offeringId: String) async -> String? {
         return await self.workflowsConfigProvider.workflowId(forOfferingId: offeringId)
     }
@@ -0,0 +1,52 @@
+//
+//  SignatureVerificationMetrics.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+
+/// How much response signature verification `HTTPClient` does, and how long it takes.
+///
+/// Thread-safe.
+final class SignatureVerificationMetrics {
+
+    struct Snapshot: Equatable {
+
+        /// Responses whose signature was checked, whatever the outcome.
+        var performedCount = 0
+
+        /// Responses that needed no check: verification disabled, unsuccessful status or unsigned path.
+        var skippedCount = 0
+
+        /// Total time spent checking the signatures counted in `performedCount`.
+        var totalDuration: TimeInterval = 0
+
+        var averageDuration: TimeInterval {
+            return self.performedCount > 0 ? self.totalDuration / Double(self.performedCount) : 0
+        }
+
+    }
+
+    private let snapshot: Atomic<Snapshot> = .init(.init())
+
+    var value: Snapshot {
+        return self.snapshot.value
+    }
+
+    func record(_ result: VerificationResult, duration: TimeInterval) {
+        self.snapshot.modify {
+            switch result {
+            case .notRequested:
+                $0.skippedCount += 1
+            case .verified, .verifiedOnDevice, .failed:
+                $0.performedCount += 1
+                $0.totalDuration += duration
+            }
+        }
+    }
+
+}
+
+extension SignatureVerificationMetrics: Sendable {}
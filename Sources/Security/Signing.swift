@@ -50,10 +50,16 @@ final class Signing: SigningType {
 
     private let apiKey: String
     private let clock: ClockType
+    private let intermediateKeys: IntermediateKeyCache
 
-    init(apiKey: String, clock: ClockType = Clock.default) {
+    init(
+        apiKey: String,
+        clock: ClockType = Clock.default,
+        intermediateKeys: IntermediateKeyCache = .init()
+    ) {
         self.apiKey = apiKey
         self.clock = clock
+        self.intermediateKeys = intermediateKeys
     }
 
     /// Parses the binary `key` and returns a `PublicKey`
@@ -90,11 +96,7 @@ final class Signing: SigningType {
             return false
         }
 
-        guard let intermediatePublicKey = Self.extractAndVerifyIntermediateKey(
-            from: signature,
-            publicKey: publicKey,
-            clock: self.clock
-        ) else {
+        guard let intermediatePublicKey = self.intermediatePublicKey(from: signature, publicKey: publicKey) else {
             return false
         }
 
@@ -102,17 +104,19 @@ final class Signing: SigningType {
 
         let salt = signature.component(.salt)
         let payload = signature.component(.payload)
-        let messageToVerify = parameters.signature(salt: salt, authValue: authValue)
+        let messageToVerify = parameters.signedMessage(salt: salt, authValue: authValue)
 
         #if DEBUG
-        Logger.verbose(Strings.signing.verifying_signature(
-            signature: signature,
-            publicKey: intermediatePublicKey.rawRepresentation,
-            parameters: parameters,
-            salt: salt,
-            payload: payload,
-            message: messageToVerify
-        ))
+        if Logger.logLevel <= .verbose {
+            Logger.verbose(Strings.signing.verifying_signature(
+                signature: signature,
+                publicKey: intermediatePublicKey.rawRepresentation,
+                parameters: parameters,
+                salt: salt,
+                payload: payload,
+                message: Data(messageToVerify)
+            ))
+        }
         #endif
 
         let isValid = intermediatePublicKey.isValidSignature(payload, for: messageToVerify)
@@ -193,7 +197,7 @@ extension Signing {
 /// The current type used is `CryptoKit.Curve25519.Signing.PublicKey`
 protocol SigningPublicKey {
 
-    func isValidSignature(_ signature: Data, for data: Data) -> Bool
+    func isValidSignature<D: DataProtocol>(_ signature: Data, for data: D) -> Bool
     var rawRepresentation: Data { get }
 
 }
@@ -204,6 +208,158 @@ extension Signing.Algorithm: SigningPublicKey {}
 
 extension Signing {
 
+    /// Bytes made of several `Data` components, read in place rather than concatenated.
+    ///
+    /// Signed responses are verified over a message that includes the whole response body. Exposing the
+    /// components as the `regions` of a `DataProtocol` lets the verifier walk them one after the other,
+    /// instead of first copying all of them, body included, into a new buffer.
+    struct SignedMessage: DataProtocol {
+
+        let regions: [Data]
+
+        /// The offset where each region begins, followed by `endIndex`.
+        private let offsets: [Int]
+
+        init(_ components: [Data]) {
+            let regions = components.filter { !$0.isEmpty }
+
+            self.regions = regions
+            self.offsets = regions.reduce(into: [0]) { offsets, region in
+                // swiftlint:disable:next force_unwrapping
+                offsets.append(offsets.last! + region.count)
+            }
+        }
+
+        var startIndex: Int { return 0 }
+
+        var endIndex: Int {
+            // swiftlint:disable:next force_unwrapping
+            return self.offsets.last!
+        }
+
+        /// Random access to a single byte. Sequential reads go through `makeIterator()` or `copyBytes`, which
+        /// walk the regions instead of looking each byte up.
+        subscript(position: Int) -> UInt8 {
+            precondition(position >= self.startIndex && position < self.endIndex, "Index out of range")
+
+            // Binary search for the last region starting at or before `position`.
+            var lower = 0
+            var upper = self.regions.count - 1
+            while lower < upper {
+                let middle = (lower + upper + 1) / 2
+                if self.offsets[middle] <= position {
+                    lower = middle
+                } else {
+                    upper = middle - 1
+                }
+            }
+
+            let region = self.regions[lower]
+            return region[region.startIndex + position - self.offsets[lower]]
+        }
+
+        func makeIterator() -> Iterator {
+            return Iterator(regions: self.regions)
+        }
+
+        /// Reads the bytes of each region in turn.
+        struct Iterator: IteratorProtocol {
+
+            private var regions: IndexingIterator<[Data]>
+            private var region: Data.Iterator?
+
+            init(regions: [Data]) {
+                self.regions = regions.makeIterator()
+            }
+
+            mutating func next() -> UInt8? {
+                while true {
+                    if let byte = self.region?.next() {
+                        return byte
+                    }
+                    guard let region = self.regions.next() else {
+                        return nil
+                    }
+                    self.region = region.makeIterator()
+                }
+            }
+
+        }
+
+    }
+
+    /// A bounded cache of intermediate keys that already passed verification.
+    ///
+    /// Every signed response carries the intermediate key, its expiration and the root key's signature
+    /// over both, but the backend rarely rotates that key. Entries are keyed by all of those bytes and the
+    /// root key, so a hit stands for a check that would pass again. Expiration is still checked on every use.
+    ///
+    /// Thread-safe.
+    final class IntermediateKeyCache {
+
+        struct Entry {
+
+            let publicKey: PublicKey
+            let expiration: Date
+
+        }
+
+        static let defaultCapacity = 4
+
+        private struct Storage {
+
+            var entries: [Data: Entry] = [:]
+            /// Keys in insertion order, oldest first.
+            var keys: [Data] = []
+
+        }
+
+        private let capacity: Int
+        private let storage: Atomic<Storage> = .init(.init())
+
+        init(capacity: Int = IntermediateKeyCache.defaultCapacity) {
+            self.capacity = capacity
+        }
+
+        var count: Int {
+            return self.storage.value.entries.count
+        }
+
+        subscript(key: Data) -> Entry? {
+            return self.storage.value.entries[key]
+        }
+
+        func store(_ entry: Entry, for key: Data) {
+            self.storage.modify { storage in
+                if storage.entries.updateValue(entry, forKey: key) == nil {
+                    storage.keys.append(key)
+                }
+
+                while storage.keys.count > self.capacity {
+                    storage.entries.removeValue(forKey: storage.keys.removeFirst())
+                }
+            }
+        }
+
+        func remove(_ key: Data) {
+            self.storage.modify { storage in
+                storage.entries.removeValue(forKey: key)
+                storage.keys.removeAll { $0 == key }
+            }
+        }
+
+        /// The bytes identifying an intermediate key: the root key and the signature's key components.
+        static func key(for signature: Data, publicKey: PublicKey) -> Data {
+            let intermediateKeySize = SignatureComponent.allCases
+                .prefix { $0 != .salt }
+                .map(\.size)
+                .sum()
+
+            return publicKey.rawRepresentation + signature.prefix(intermediateKeySize)
+        }
+
+    }
+
     enum SignatureComponent: CaseIterable, Comparable {
 
         case intermediatePublicKey
@@ -265,12 +421,19 @@ extension Signing.SignatureParameters {
         self.useFallbackPath = useFallbackPath
     }
 
+    /// The message signed by the backend, in a single buffer.
+    /// - Seealso: `signedMessage(salt:authValue:)`, which avoids copying the components.
     func signature(salt: Data, authValue: String) -> Data {
+        return Data(self.signedMessage(salt: salt, authValue: authValue))
+    }
+
+    /// The message signed by the backend, made of the components it already has in memory.
+    func signedMessage(salt: Data, authValue: String) -> Signing.SignedMessage {
         let auth = self.path.authenticated ? authValue : ""
-        return salt + auth.asData + self.asData
+        return Signing.SignedMessage([salt, auth.asData] + self.components)
     }
 
-    var asData: Data {
+    private var components: [Data] {
         let nonce: Data = self.nonce ?? .init()
         let relativePath: String
         if useFallbackPath, let fallbackRelativePath = self.path.fallbackRelativePath {
@@ -289,7 +452,7 @@ extension Signing.SignatureParameters {
         let etag: Data = (self.etag ?? "").asData
         let message: Data = self.message ?? .init()
 
-        return (nonce + path + postParameterHash + headerParametersHash + requestDate + etag + message)
+        return [nonce, path, postParameterHash, headerParametersHash, requestDate, etag, message]
     }
 
 }
@@ -330,11 +493,36 @@ private extension Signing {
         return try Algorithm(rawRepresentation: data)
     }
 
+    /// Returns the intermediate key in `signature`, only verifying it against `publicKey` the first time it's seen.
+    func intermediatePublicKey(from signature: Data, publicKey: Signing.PublicKey) -> Signing.PublicKey? {
+        let cacheKey = IntermediateKeyCache.key(for: signature, publicKey: publicKey)
+
+        if let cached = self.intermediateKeys[cacheKey] {
+            guard Self.verifyIntermediateKeyHasNotExpired(cached.expiration,
+                                                          signature.component(.intermediateKeyExpiration),
+                                                          self.clock) else {
+                self.intermediateKeys.remove(cacheKey)
+                return nil
+            }
+
+            return cached.publicKey
+        }
+
+        guard let entry = Self.extractAndVerifyIntermediateKey(from: signature,
+                                                               publicKey: publicKey,
+                                                               clock: self.clock) else {
+            return nil
+        }
+
+        self.intermediateKeys.store(entry, for: cacheKey)
+        return entry.publicKey
+    }
+
     static func extractAndVerifyIntermediateKey(
         from signature: Data,
         publicKey: Signing.PublicKey,
         clock: ClockType
-    ) -> Signing.PublicKey? {
+    ) -> IntermediateKeyCache.Entry? {
         let intermediatePublicKey = signature.component(.intermediatePublicKey)
         let intermediateKeyExpiration = signature.component(.intermediateKeyExpiration)
         let intermediateKeySignature = signature.component(.intermediateKeySignature)
@@ -354,7 +542,7 @@ private extension Signing {
                                                                  data: intermediatePublicKey))
 
         do {
-            return try Self.createPublicKey(with: intermediatePublicKey)
+            return .init(publicKey: try Self.createPublicKey(with: intermediatePublicKey), expiration: expirationDate)
         } catch {
             Logger.error(Strings.signing.intermediate_key_failed_creation(error))
             return nil
@@ -374,14 +562,26 @@ private extension Signing {
         }
 
         let expirationDate = Date(daysSince1970: daysSince1970)
-        guard expirationDate.timeIntervalSince(clock.now) >= 0 else {
-            Logger.warn(Strings.signing.intermediate_key_expired(expirationDate, expirationData))
+        guard Self.verifyIntermediateKeyHasNotExpired(expirationDate, expirationData, clock) else {
             return nil
         }
 
         return expirationDate
     }
 
+    private static func verifyIntermediateKeyHasNotExpired(
+        _ expirationDate: Date,
+        _ expirationData: Data,
+        _ clock: ClockType
+    ) -> Bool {
+        guard expirationDate.timeIntervalSince(clock.now) >= 0 else {
+            Logger.warn(Strings.signing.intermediate_key_expired(expirationDate, expirationData))
+            return false
+        }
+
+        return true
+    }
+
 }
 
 // MARK: - Extensions
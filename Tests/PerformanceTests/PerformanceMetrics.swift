@@ -0,0 +1,176 @@
+//
+//  Copyright RevenueCat Inc. All Rights Reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/MIT
+//
+//  PerformanceMetrics.swift
+//
+//  Metrics the benchmarks report next to wall-clock time: throughput, so results compare across input
+//  sizes, and heap allocation counts, which move before timings do when a copy sneaks into a hot path.
+
+import Darwin
+import Foundation
+import os
+import XCTest
+
+extension XCTestCase {
+
+    /// Measures `block`, which processes `byteCount` bytes per iteration, reporting wall-clock time,
+    /// throughput, heap allocations and peak memory.
+    func measure(processing byteCount: Int, block: () -> Void) {
+        self.measure(
+            metrics: [
+                XCTClockMetric(),
+                ThroughputMetric(byteCount: byteCount),
+                AllocationCountMetric(),
+                XCTMemoryMetric()
+            ],
+            block: block
+        )
+    }
+
+}
+
+/// Reports the bytes per second (as MB/s) a measured block processes. Higher is better.
+final class ThroughputMetric: NSObject, XCTMetric {
+
+    private let byteCount: Int
+
+    init(byteCount: Int) {
+        self.byteCount = byteCount
+    }
+
+    func copy(with zone: NSZone? = nil) -> Any {
+        return ThroughputMetric(byteCount: self.byteCount)
+    }
+
+    func reportMeasurements(
+        from startTime: XCTPerformanceMeasurementTimestamp,
+        to endTime: XCTPerformanceMeasurementTimestamp
+    ) throws -> [XCTPerformanceMeasurement] {
+        guard endTime.absoluteTimeNanoSeconds > startTime.absoluteTimeNanoSeconds else { return [] }
+
+        let seconds = Double(endTime.absoluteTimeNanoSeconds - startTime.absoluteTimeNanoSeconds) / 1_000_000_000
+
+        return [
+            .init(identifier: "com.revenuecat.performance.throughput",
+                  displayName: "Throughput",
+                  doubleValue: Double(self.byteCount) / seconds / Self.bytesPerMegabyte,
+                  unitSymbol: "MB/s")
+        ]
+    }
+
+    private static let bytesPerMegabyte: Double = 1024 * 1024
+
+}
+
+/// Counts the heap allocations made while a measured block runs, on any thread.
+///
+/// Counting goes through libmalloc's `malloc_logger` hook, the one malloc stack logging uses. When that
+/// hook is unavailable or already taken (e.g. with `MallocStackLogging` enabled) nothing is reported.
+final class AllocationCountMetric: NSObject, XCTMetric {
+
+    private var isCounting = false
+    private var allocationCount: Int?
+
+    func copy(with zone: NSZone? = nil) -> Any {
+        return AllocationCountMetric()
+    }
+
+    func didStartMeasuring() {
+        self.isCounting = AllocationCounter.start()
+    }
+
+    func willStopMeasuring() {
+        if self.isCounting {
+            self.allocationCount = AllocationCounter.stop()
+            self.isCounting = false
+        }
+    }
+
+    func reportMeasurements(
+        from startTime: XCTPerformanceMeasurementTimestamp,
+        to endTime: XCTPerformanceMeasurementTimestamp
+    ) throws -> [XCTPerformanceMeasurement] {
+        guard let allocationCount = self.allocationCount else { return [] }
+
+        return [
+            .init(identifier: "com.revenuecat.performance.allocations",
+                  displayName: "Allocations",
+                  doubleValue: Double(allocationCount),
+                  unitSymbol: "allocations")
+        ]
+    }
+
+}
+
+// MARK: - Private
+
+/// Global state behind `AllocationCountMetric`. The hook is a C function pointer that can't capture
+/// context, and it runs inside `malloc`, so it only touches storage allocated before it's installed.
+private enum AllocationCounter {
+
+    /// `malloc_logger_t`: `(type, arg1, arg2, arg3, result, num_hot_frames_to_skip)`.
+    typealias Logger = @convention(c) (UInt32, UInt, UInt, UInt, UInt, UInt32) -> Void
+
+    /// `MALLOC_LOG_TYPE_ALLOCATE`, also set for the allocating half of `realloc`.
+    static let allocateFlag: UInt32 = 2
+
+    /// The `malloc_logger` variable exported by libmalloc.
+    static let hook: UnsafeMutablePointer<Logger?>? = dlsym(RTLD_DEFAULT, "malloc_logger")
+        .map { $0.assumingMemoryBound(to: Logger?.self) }
+
+    static let lock: UnsafeMutablePointer<os_unfair_lock> = {
+        let lock = UnsafeMutablePointer<os_unfair_lock>.allocate(capacity: 1)
+        lock.initialize(to: os_unfair_lock())
+        return lock
+    }()
+
+    static let count: UnsafeMutablePointer<Int> = {
+        let count = UnsafeMutablePointer<Int>.allocate(capacity: 1)
+        count.initialize(to: 0)
+        return count
+    }()
+
+    static let logger: Logger = { type, _, _, _, _, _ in
+        guard type & AllocationCounter.allocateFlag != 0 else { return }
+
+        os_unfair_lock_lock(AllocationCounter.lock)
+        AllocationCounter.count.pointee += 1
+        os_unfair_lock_unlock(AllocationCounter.lock)
+    }
+
+    /// Resets the count and installs the hook.
+    /// - Returns: whether allocations are being counted.
+    static func start() -> Bool {
+        guard let hook = Self.hook, hook.pointee == nil else { return false }
+
+        // Initialize the lazy globals now, so the hook itself never allocates.
+        let lock = Self.lock
+        let count = Self.count
+        let logger = Self.logger
+
+        os_unfair_lock_lock(lock)
+        count.pointee = 0
+        os_unfair_lock_unlock(lock)
+
+        hook.pointee = logger
+        return true
+    }
+
+    /// Removes the hook installed by `start()`.
+    /// - Returns: the number of allocations counted since `start()`.
+    static func stop() -> Int {
+        Self.hook?.pointee = nil
+
+        os_unfair_lock_lock(Self.lock)
+        defer { os_unfair_lock_unlock(Self.lock) }
+
+        return Self.count.pointee
+    }
+
+}
@@ -0,0 +1,180 @@
+//
+//  RCContainerPerformanceTests.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+/// Throughput and allocation baselines for reading containers.
+/// Run them from the `PerformanceTests` scheme to record or compare baselines; they only fail if the
+/// measured work itself fails.
+final class RCContainerPerformanceTests: TestCase {
+
+    private var directoryURL: URL!
+
+    override func setUpWithError() throws {
+        try super.setUpWithError()
+
+        self.directoryURL = FileManager.default.temporaryDirectory
+            .appendingPathComponent("rc_container_performance_tests", isDirectory: true)
+            .appendingPathComponent(UUID().uuidString, isDirectory: true)
+        try FileManager.default.createDirectory(at: self.directoryURL, withIntermediateDirectories: true)
+    }
+
+    override func tearDownWithError() throws {
+        if let directoryURL = self.directoryURL {
+            try? FileManager.default.removeItem(at: directoryURL)
+        }
+
+        try super.tearDownWithError()
+    }
+
+    // MARK: - Reopening persisted containers
+
+    func testReopenMemoryMapped100KBContainer() throws {
+        try self.measureReopeningPersistedContainer(size: 100 * 1024, backing: .memoryMapped)
+    }
+
+    func testReopenCopied100KBContainer() throws {
+        try self.measureReopeningPersistedContainer(size: 100 * 1024, backing: .copied)
+    }
+
+    func testReopenMemoryMapped1MBContainer() throws {
+        try self.measureReopeningPersistedContainer(size: 1024 * 1024, backing: .memoryMapped)
+    }
+
+    func testReopenCopied1MBContainer() throws {
+        try self.measureReopeningPersistedContainer(size: 1024 * 1024, backing: .copied)
+    }
+
+    func testReopenMemoryMapped10MBContainer() throws {
+        try self.measureReopeningPersistedContainer(size: 10 * 1024 * 1024, backing: .memoryMapped)
+    }
+
+    func testReopenCopied10MBContainer() throws {
+        try self.measureReopeningPersistedContainer(size: 10 * 1024 * 1024, backing: .copied)
+    }
+
+    // MARK: - Parsing
+
+    func testParseBuiltContainer() throws {
+        let data = try Self.builtContainer()
+
+        self.measure(processing: data.count) {
+            let container = try? RCContainer(data: data)
+            expect(container?.elements.count) == Self.builtContainerElementCount + 1
+        }
+    }
+
+    func testDecodeEveryElementOfBuiltContainer() throws {
+        let container = try RCContainer(data: Self.builtContainer())
+        let expectedByteCount = Self.decodedByteCount(of: container)
+
+        self.measure(processing: expectedByteCount) {
+            expect(Self.decodedByteCount(of: container)) == expectedByteCount
+        }
+    }
+
+
+    // MARK: - Validating every element
+
+    func testValidateAllSerially() throws {
+        try self.measureValidatingGzipContainer(concurrency: 1)
+    }
+
+    func testValidateAllInParallel() throws {
+        try self.measureValidatingGzipContainer(concurrency: ProcessInfo.processInfo.activeProcessorCount)
+    }
+
+}
+
+// MARK: - Private
+
+private extension RCContainerPerformanceTests {
+
+    /// Payload size of each content element. Containers are split into several elements so reopening one
+    /// and using a single element leaves most of the file untouched.
+    static let elementSize = 64 * 1024
+
+    /// Reopens a persisted container of about `size` bytes and validates its last element, which is what the
+    /// SDK does when it restores one inline blob at cold start.
+    /// Throughput is over the whole file, so it shows how much of it each backing avoids reading.
+    func measureReopeningPersistedContainer(size: Int, backing: RCContainer.Backing) throws {
+        let payloads = Self.payloads(totalSize: size)
+        let lastRef = RCContainerTestData.blobRef(for: try XCTUnwrap(payloads.last))
+        let url = self.directoryURL.appendingPathComponent("container.rc", isDirectory: false)
+        let container = RCContainerTestData.container(config: RCContainerTestData.configJSON, contentElements: payloads)
+        try RCContainer.persist(container, to: url)
+
+        var isValid = true
+        self.measure(processing: container.count) {
+            let element = try? RCContainer(contentsOf: url, backing: backing).element(withChecksum: lastRef)
+            isValid = isValid && element?.isChecksumValid() == true
+        }
+
+        expect(isValid) == true
+    }
+
+    static let builtContainerElementCount = 32
+
+    /// A container of 64 KB elements cycling through every encoding `RCContainer.Builder` produces.
+    static func builtContainer() throws -> Data {
+        let encodings: [RCContainer.Element.ContentEncoding] = [.none, .gzip, .brotli, .zstd]
+        let payloads = Self.payloads(totalSize: Self.builtContainerElementCount * Self.elementSize)
+
+        var builder = RCContainer.Builder()
+        try builder.append(RCContainerTestData.configJSON)
+        for (index, payload) in payloads.enumerated() {
+            try builder.append(payload, encoding: encodings[index % encodings.count])
+        }
+
+        return builder.build()
+    }
+
+    static func decodedByteCount(of container: RCContainer) -> Int {
+        return container.elements.reduce(0) { total, element in
+            total + ((try? element.withDecodedPayloadBytes { $0.count }) ?? 0)
+        }
+    }
+
+    /// Validates a 4 MB container of gzip elements, so each element costs a decompression and a hash.
+    /// Throughput is over the decoded bytes.
+    func measureValidatingGzipContainer(concurrency: Int) throws {
+        let decodedSize = 4 * 1024 * 1024
+        let container = try RCContainer(data: RCContainerTestData.compressedContainer(
+            config: RCContainerTestData.configJSON,
+            contentElements: Self.payloads(totalSize: decodedSize).map { ($0, .gzip) }
+        ))
+
+        let invalidCount: Atomic<Int> = .init(0)
+        self.measure(processing: decodedSize) {
+            let expectation = self.expectation(description: "validateAll")
+
+            Task {
+                let results = await container.validateAll(concurrency: concurrency)
+                let resultInvalidCount = results.filter { !$0.isValid }.count
+                invalidCount.modify { $0 += resultInvalidCount }
+                expectation.fulfill()
+            }
+
+            self.wait(for: [expectation], timeout: 30)
+        }
+
+        expect(invalidCount.value) == 0
+    }
+
+    static func payloads(totalSize: Int) -> [Data] {
+        return stride(from: 0, to: totalSize, by: Self.elementSize).map { offset -> Data in
+            let count = min(Self.elementSize, totalSize - offset)
+
+            // Distinct bytes per element, so no two elements share a checksum.
+            return Data((offset..<offset + count).map { UInt8(truncatingIfNeeded: $0 &* 31 &+ $0 >> 16) })
+        }
+    }
+
+}
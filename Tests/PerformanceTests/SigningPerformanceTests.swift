@@ -0,0 +1,103 @@
+//
+//  Copyright RevenueCat Inc. All Rights Reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/MIT
+//
+//  SigningPerformanceTests.swift
+//
+//  Created by RevenueCat.
+
+import CryptoKit
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+/// Baselines for verifying signed responses, with the intermediate key cache warm and disabled.
+/// Run them from the `PerformanceTests` scheme to record or compare baselines; they only fail if
+/// verification itself fails.
+final class SigningPerformanceTests: TestCase {
+
+    private typealias PrivateKey = Curve25519.Signing.PrivateKey
+
+    private let rootKey = PrivateKey()
+    private let intermediateKey = PrivateKey()
+
+    /// Only the first response verifies the intermediate key against the root key.
+    func testVerifyingResponsesWithCachedIntermediateKey() throws {
+        try self.measureVerifyingResponses(intermediateKeys: .init())
+    }
+
+    /// Every response verifies the intermediate key against the root key, like the first one after launch.
+    func testVerifyingResponsesWithoutIntermediateKeyCache() throws {
+        try self.measureVerifyingResponses(intermediateKeys: .init(capacity: 0))
+    }
+
+}
+
+// MARK: - Private
+
+private extension SigningPerformanceTests {
+
+    static let apiKey = "appl_fFVBVAoYujMZJnepIziGKVjnZBz"
+    static let path: HTTPRequest.Path = .getCustomerInfo(appUserID: "user")
+    static let mockDate = Date(timeIntervalSince1970: 1688769125)
+    static let responseCount = 100
+
+    func measureVerifyingResponses(intermediateKeys: Signing.IntermediateKeyCache) throws {
+        let signing = Signing(apiKey: Self.apiKey,
+                              clock: TestClock(now: Self.mockDate),
+                              intermediateKeys: intermediateKeys)
+        let signedIntermediateKey = try self.signedIntermediateKey()
+        let responses = try (0..<Self.responseCount).map {
+            try self.signedResponse(message: "response \($0)", intermediateKey: signedIntermediateKey)
+        }
+        let rootPublicKey = self.rootKey.publicKey
+
+        var verifiedCount = 0
+        self.measure(metrics: [XCTClockMetric(), XCTCPUMetric(), AllocationCountMetric()]) {
+            for response in responses where signing.verify(signature: response.signature,
+                                                           with: response.parameters,
+                                                           publicKey: rootPublicKey) {
+                verifiedCount += 1
+            }
+        }
+
+        expect(verifiedCount).to(beGreaterThan(0))
+        expect(verifiedCount % responses.count) == 0
+    }
+
+    /// The intermediate public key, its expiration and the root key's signature over both, as the backend
+    /// sends them. Expiration is encoded as little-endian days since 1970.
+    func signedIntermediateKey() throws -> Data {
+        let publicKey = self.intermediateKey.publicKey.rawRepresentation
+        let expirationDate = Self.mockDate.addingTimeInterval(DispatchTimeInterval.days(5).seconds)
+        let expiration = UInt32(DispatchTimeInterval(expirationDate.timeIntervalSince1970).days).littleEndianData
+        let signature = try self.rootKey.signature(for: expiration + publicKey)
+
+        return publicKey + expiration + signature
+    }
+
+    func signedResponse(
+        message: String,
+        intermediateKey: Data
+    ) throws -> (signature: String, parameters: Signing.SignatureParameters) {
+        let salt = Data(repeating: UInt8(ascii: "a"), count: Signing.SignatureComponent.salt.size)
+        let parameters: Signing.SignatureParameters = .init(
+            path: Self.path,
+            iamEnabled: false,
+            message: message.asData,
+            nonce: "nonce".asData,
+            requestDate: 1677005916012
+        )
+        let signature = try self.intermediateKey.signature(for: parameters.signature(salt: salt,
+                                                                                      authValue: Self.apiKey))
+
+        return ((intermediateKey + salt + signature).base64EncodedString(), parameters)
+    }
+
+}
@@ -143,6 +143,32 @@ final class DefaultCheckpointWorkflowResolverTests: TestCase {
         XCTAssertEqual(self.workflowsProvider.invokedGetWorkflowParameters, [self.workflowID])
     }
 
+    func testEveryRuleWorkflowIsPrioritizedWhileResolving() async throws {
+        let secondWorkflowID = "wf5678"
+        self.checkpointsProvider.result = .success(CheckpointRuleSet(rules: [
+            Self.rule(workflowID: self.workflowID),
+            Self.rule(workflowID: secondWorkflowID, audienceID: "second"),
+            Self.rule(workflowID: self.workflowID, audienceID: "third")
+        ]))
+
+        _ = try await self.resolve()
+
+        let workflowsProvider = try XCTUnwrap(self.workflowsProvider)
+        try await asyncWait { workflowsProvider.invokedPrioritizeWorkflowsParameters != nil }
+
+        let parameters = try XCTUnwrap(workflowsProvider.invokedPrioritizeWorkflowsParameters)
+        XCTAssertEqual(parameters.workflowIds, [self.workflowID, secondWorkflowID])
+        XCTAssertGreaterThan(parameters.timeInterval, 0)
+    }
+
+    func testUnconfiguredCheckpointPrioritizesNoWorkflows() async throws {
+        self.checkpointsProvider.result = .success(nil)
+
+        _ = try await self.resolve()
+
+        XCTAssertNil(self.workflowsProvider.invokedPrioritizeWorkflowsParameters)
+    }
+
     func testDimensionProviderFailureResolvesConfigurationUnavailableWithoutFetchingOfferings() async throws {
         let fetchCount = Atomic<Int>(0)
         let evaluator = LocalRulesEvaluator(dimensionProviders: [FailingDimensionProvider()])
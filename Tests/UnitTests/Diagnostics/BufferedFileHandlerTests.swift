@@ -0,0 +1,284 @@
+//
+//  Copyright RevenueCat Inc. All Rights Reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/MIT
+//
+//  BufferedFileHandlerTests.swift
+//
+//  Created by RevenueCat.
+
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+@available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
+class BufferedFileHandlerTests: TestCase {
+
+    private var underlyingHandler: MockFileHandler!
+    private var handler: BufferedFileHandler!
+
+    override func setUp() async throws {
+        try await super.setUp()
+
+        try AvailabilityChecks.iOS15APIAvailableOrSkipTest()
+
+        self.underlyingHandler = .init()
+        self.handler = .init(self.underlyingHandler, durability: .grouped(maxCount: 3, maxDelay: .seconds(60)))
+    }
+
+    func testAppendedLinesArePendingUntilMaxCount() async throws {
+        try await self.handler.append(line: "1")
+        try await self.handler.append(line: "2")
+
+        var committedLines = try await self.underlyingHandler.readLines().extractValues()
+        expect(committedLines).to(beEmpty())
+
+        try await self.handler.append(line: "3")
+
+        committedLines = try await self.underlyingHandler.readLines().extractValues()
+        expect(committedLines) == ["1", "2", "3"]
+
+        let counters = await self.handler.counters
+        expect(counters) == .init(bufferedCount: 3, committedCount: 3, droppedCount: 0)
+    }
+
+    func testReadLinesCommitsPendingLines() async throws {
+        try await self.handler.append(line: "1")
+
+        let lines = try await self.handler.readLines().extractValues()
+        expect(lines) == ["1"]
+
+        let pendingCount = await self.handler.pendingCount
+        expect(pendingCount) == 0
+    }
+
+    func testRemoveFirstLinesCommitsPendingLinesFirst() async throws {
+        try await self.handler.append(line: "1")
+        try await self.handler.append(line: "2")
+
+        try await self.handler.removeFirstLines(1)
+
+        let committedLines = try await self.underlyingHandler.readLines().extractValues()
+        expect(committedLines) == ["2"]
+    }
+
+    func testPendingLinesAreCommittedAfterMaxDelay() async throws {
+        self.handler = .init(self.underlyingHandler, durability: .grouped(maxCount: 3, maxDelay: .milliseconds(10)))
+
+        try await self.handler.append(line: "1")
+        try await Task.sleep(nanoseconds: DispatchTimeInterval.milliseconds(200).nanoseconds)
+
+        let committedLines = try await self.underlyingHandler.readLines().extractValues()
+        expect(committedLines) == ["1"]
+    }
+
+    func testImmediateDurabilityWritesEveryLine() async throws {
+        self.handler = .init(self.underlyingHandler, durability: .immediate)
+
+        try await self.handler.append(line: "1")
+
+        let committedLines = try await self.underlyingHandler.readLines().extractValues()
+        expect(committedLines) == ["1"]
+
+        let counters = await self.handler.counters
+        expect(counters) == .init(bufferedCount: 0, committedCount: 1, droppedCount: 0)
+    }
+
+    func testFullBufferDropsOldestLines() async throws {
+        self.handler = .init(self.underlyingHandler,
+                             durability: .grouped(maxCount: 10, maxDelay: .seconds(60)),
+                             capacity: 2)
+
+        try await self.handler.append(line: "1")
+        try await self.handler.append(line: "2")
+        try await self.handler.append(line: "3")
+
+        let lines = try await self.handler.readLines().extractValues()
+        expect(lines) == ["2", "3"]
+
+        let counters = await self.handler.counters
+        expect(counters) == .init(bufferedCount: 3, committedCount: 2, droppedCount: 1)
+    }
+
+    func testFailedCommitKeepsLinesPending() async throws {
+        struct FakeError: Error {}
+        await self.underlyingHandler.setAppendLineError(FakeError())
+
+        try await self.handler.append(line: "1")
+
+        do {
+            try await self.handler.commitPendingLines()
+            fail("Expected error")
+        } catch {}
+
+        let pendingCount = await self.handler.pendingCount
+        let counters = await self.handler.counters
+        expect(pendingCount) == 1
+        expect(counters.committedCount) == 0
+    }
+
+    func testLinesStayPendingWhileTheirCommitIsInFlight() async throws {
+        let gatedHandler = GatedFileHandler(self.underlyingHandler)
+        self.handler = .init(gatedHandler, durability: .grouped(maxCount: 3, maxDelay: .seconds(60)))
+
+        try await self.handler.append(line: "1")
+        try await self.handler.append(line: "2")
+
+        let firstCommit = Task { try await self.handler.commitPendingLines() }
+        await expect { await gatedHandler.waitingCount }.toEventually(equal(1))
+
+        let pendingCount = await self.handler.pendingCount
+        expect(pendingCount) == 2
+
+        let secondCommit = Task { try await self.handler.commitPendingLines() }
+        let read = Task { try await self.handler.readLines().extractValues() }
+        await gatedHandler.open()
+
+        try await firstCommit.value
+        try await secondCommit.value
+        let lines = try await read.value
+        let appendCount = await gatedHandler.appendCount
+        expect(lines) == ["1", "2"]
+        expect(appendCount) == 1
+    }
+
+    func testFailedCommitKeepsLinesInOrderWithLinesAppendedDuringIt() async throws {
+        struct FakeError: Error {}
+        let gatedHandler = GatedFileHandler(self.underlyingHandler)
+        self.handler = .init(gatedHandler, durability: .grouped(maxCount: 10, maxDelay: .seconds(60)))
+
+        try await self.handler.append(line: "1")
+        try await self.handler.append(line: "2")
+        await gatedHandler.setAppendError(FakeError())
+
+        let failedCommit = Task { try await self.handler.commitPendingLines() }
+        await expect { await gatedHandler.waitingCount }.toEventually(equal(1))
+
+        try await self.handler.append(line: "3")
+        await gatedHandler.open()
+
+        do {
+            try await failedCommit.value
+            fail("Expected error")
+        } catch {}
+
+        await gatedHandler.setAppendError(nil)
+        let lines = try await self.handler.readLines().extractValues()
+        let counters = await self.handler.counters
+        expect(lines) == ["1", "2", "3"]
+        expect(counters) == .init(bufferedCount: 3, committedCount: 3, droppedCount: 0)
+    }
+
+    func testLinesDroppedWhileTheirCommitIsInFlightAreStillCommitted() async throws {
+        let gatedHandler = GatedFileHandler(self.underlyingHandler)
+        self.handler = .init(gatedHandler,
+                             durability: .grouped(maxCount: 10, maxDelay: .seconds(60)),
+                             capacity: 2)
+
+        try await self.handler.append(line: "1")
+        try await self.handler.append(line: "2")
+
+        let commit = Task { try await self.handler.commitPendingLines() }
+        await expect { await gatedHandler.waitingCount }.toEventually(equal(1))
+
+        try await self.handler.append(line: "3")
+        await gatedHandler.open()
+        try await commit.value
+
+        let pendingCount = await self.handler.pendingCount
+        expect(pendingCount) == 1
+
+        let lines = try await self.handler.readLines().extractValues()
+        let counters = await self.handler.counters
+        expect(lines) == ["1", "2", "3"]
+        expect(counters) == .init(bufferedCount: 3, committedCount: 3, droppedCount: 0)
+    }
+
+    func testEmptyFileDiscardsPendingLines() async throws {
+        try await self.handler.append(line: "1")
+
+        try await self.handler.emptyFile()
+
+        let pendingCount = await self.handler.pendingCount
+        let lines = try await self.handler.readLines().extractValues()
+        expect(pendingCount) == 0
+        expect(lines).to(beEmpty())
+    }
+
+    func testFileSizeIncludesPendingLines() async throws {
+        try await self.handler.append(line: "1234")
+
+        let size = try await self.handler.fileSizeInKB()
+        expect(size).to(beCloseTo(5.0 / 1024))
+    }
+
+}
+
+/// Holds `append(lines:)` calls until it's opened.
+@available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
+private actor GatedFileHandler: FileHandlerType {
+
+    private let handler: FileHandlerType
+    private var isOpen = false
+    private var waiting: [CheckedContinuation<Void, Never>] = []
+    private var appendError: Error?
+
+    private(set) var appendCount = 0
+
+    init(_ handler: FileHandlerType) {
+        self.handler = handler
+    }
+
+    var waitingCount: Int {
+        return self.waiting.count
+    }
+
+    func open() {
+        self.isOpen = true
+        self.waiting.forEach { $0.resume() }
+        self.waiting.removeAll()
+    }
+
+    func setAppendError(_ error: Error?) {
+        self.appendError = error
+    }
+
+    func readLines() async throws -> AsyncThrowingStream<String, Swift.Error> {
+        return try await self.handler.readLines()
+    }
+
+    func append(line: String) async throws {
+        try await self.append(lines: [line])
+    }
+
+    func append(lines: [String]) async throws {
+        self.appendCount += 1
+
+        if !self.isOpen {
+            await withCheckedContinuation { self.waiting.append($0) }
+        }
+
+        if let appendError = self.appendError {
+            throw appendError
+        }
+        try await self.handler.append(lines: lines)
+    }
+
+    func emptyFile() async throws {
+        try await self.handler.emptyFile()
+    }
+
+    func removeFirstLines(_ count: Int) async throws {
+        try await self.handler.removeFirstLines(count)
+    }
+
+    func fileSizeInKB() async throws -> Double {
+        return try await self.handler.fileSizeInKB()
+    }
+
+}
@@ -883,6 +883,21 @@ class DiagnosticsTrackerTests: TestCase {
         ])
     }
 
+    func testTrackingRemoteConfigBlobConcurrencyLimit() async throws {
+        // When
+        self.tracker.trackRemoteConfigBlobConcurrencyLimit(limit: 6)
+
+        // Then
+        let entries = await self.handler.getEntries()
+
+        Self.expectEventArrayWithoutId(entries, [
+            .init(name: .remoteConfigBlobConcurrencyLimit,
+                  properties: DiagnosticsEvent.Properties(concurrencyLimit: 6),
+                  timestamp: Self.eventTimestamp1,
+                  appSessionId: SystemInfo.appSessionID)
+        ])
+    }
+
 }
 
 @available(iOS 15.0, macOS 12.0, tvOS 15.0, watchOS 8.0, *)
@@ -0,0 +1,225 @@
+//
+//  Copyright RevenueCat Inc. All Rights Reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/MIT
+//
+//  SegmentedFileHandlerTests.swift
+//
+//  Created by RevenueCat.
+
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+@available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
+class SegmentedFileHandlerTests: TestCase {
+
+    private var directory: URL!
+    private var handler: SegmentedFileHandler!
+
+    override func setUp() async throws {
+        try await super.setUp()
+
+        try AvailabilityChecks.iOS15APIAvailableOrSkipTest()
+
+        self.directory = Self.temporaryDirectoryURL()
+        self.handler = try self.createHandler()
+    }
+
+    override func tearDown() async throws {
+        self.handler = nil
+        try? FileManager.default.removeItem(at: self.directory)
+
+        try await super.tearDown()
+    }
+
+    func testReadLinesWithEmptyHandler() async throws {
+        let lines = try await self.handler.readLines().extractValues()
+        expect(lines).to(beEmpty())
+    }
+
+    func testAppendedLinesAreReadAcrossSegments() async throws {
+        let lines = (0..<5).map { _ in Self.sampleLine() }
+
+        for line in lines {
+            try await self.handler.append(line: line)
+        }
+
+        expect(try self.segmentCount()) == 3
+        let storedLines = try await self.handler.readLines().extractValues()
+        expect(storedLines) == lines
+    }
+
+    func testRemoveFirstLinesWithinSegment() async throws {
+        let lines = (0..<3).map { _ in Self.sampleLine() }
+        for line in lines {
+            try await self.handler.append(line: line)
+        }
+
+        try await self.handler.removeFirstLines(1)
+
+        let storedLines = try await self.handler.readLines().extractValues()
+        expect(storedLines) == Array(lines.dropFirst())
+        expect(try self.segmentCount()) == 2
+    }
+
+    func testRemoveFirstLinesDeletesConsumedSegments() async throws {
+        let lines = (0..<5).map { _ in Self.sampleLine() }
+        for line in lines {
+            try await self.handler.append(line: line)
+        }
+
+        try await self.handler.removeFirstLines(4)
+
+        let storedLines = try await self.handler.readLines().extractValues()
+        expect(storedLines) == [lines[4]]
+        expect(try self.segmentCount()) == 1
+    }
+
+    func testRemovingAllLinesAllowsAppendingAgain() async throws {
+        try await self.handler.append(line: Self.sampleLine())
+        try await self.handler.append(line: Self.sampleLine())
+
+        try await self.handler.removeFirstLines(5)
+        var storedLines = try await self.handler.readLines().extractValues()
+        expect(storedLines).to(beEmpty())
+        expect(try self.segmentCount()) == 0
+
+        let line = Self.sampleLine()
+        try await self.handler.append(line: line)
+
+        storedLines = try await self.handler.readLines().extractValues()
+        expect(storedLines) == [line]
+    }
+
+    func testRemovedLinesArePersisted() async throws {
+        let lines = (0..<5).map { _ in Self.sampleLine() }
+        for line in lines {
+            try await self.handler.append(line: line)
+        }
+
+        try await self.handler.removeFirstLines(3)
+
+        self.handler = try self.createHandler()
+
+        let storedLines = try await self.handler.readLines().extractValues()
+        expect(storedLines) == Array(lines.suffix(2))
+    }
+
+    func testFileSizeTracksAppendedAndRemovedLines() async throws {
+        let line = Self.sampleLine()
+        let lineSize = Double(line.asData.count + 1) / 1024
+
+        for _ in 0..<4 {
+            try await self.handler.append(line: line)
+        }
+        var fileSize = try await self.handler.fileSizeInKB()
+        expect(fileSize).to(beCloseTo(lineSize * 4))
+
+        try await self.handler.removeFirstLines(1)
+        fileSize = try await self.handler.fileSizeInKB()
+        expect(fileSize).to(beCloseTo(lineSize * 3))
+
+        try await self.handler.removeFirstLines(2)
+        fileSize = try await self.handler.fileSizeInKB()
+        expect(fileSize).to(beCloseTo(lineSize))
+
+        self.handler = try self.createHandler()
+        fileSize = try await self.handler.fileSizeInKB()
+        expect(fileSize).to(beCloseTo(lineSize))
+    }
+
+    func testEmptyFileRemovesAllSegments() async throws {
+        for _ in 0..<5 {
+            try await self.handler.append(line: Self.sampleLine())
+        }
+        try await self.handler.removeFirstLines(1)
+
+        try await self.handler.emptyFile()
+
+        let storedLines = try await self.handler.readLines().extractValues()
+        expect(storedLines).to(beEmpty())
+        let fileSize = try await self.handler.fileSizeInKB()
+        expect(fileSize) == 0
+        expect(try self.segmentCount()) == 0
+    }
+
+    func testMigratesLegacyFile() async throws {
+        let lines = (0..<3).map { _ in Self.sampleLine() }
+        let legacyFile = self.directory.deletingLastPathComponent().appendingPathComponent(UUID().uuidString)
+        try (lines.joined(separator: "\n") + "\n").asData.write(to: legacyFile)
+
+        try? FileManager.default.removeItem(at: self.directory)
+        self.handler = try self.createHandler(migratingFrom: legacyFile)
+
+        expect(FileManager.default.fileExists(atPath: legacyFile.path)) == false
+        var storedLines = try await self.handler.readLines().extractValues()
+        expect(storedLines) == lines
+
+        try await self.handler.removeFirstLines(1)
+        storedLines = try await self.handler.readLines().extractValues()
+        expect(storedLines) == Array(lines.dropFirst())
+    }
+
+    func testMigratesLegacyFileAfterExistingSegments() async throws {
+        let lines = (0..<3).map { _ in Self.sampleLine() }
+        for line in lines {
+            try await self.handler.append(line: line)
+        }
+        try await self.handler.removeFirstLines(1)
+
+        let legacyLines = (0..<2).map { _ in Self.sampleLine() }
+        let legacyFile = self.directory.deletingLastPathComponent().appendingPathComponent(UUID().uuidString)
+        try (legacyLines.joined(separator: "\n") + "\n").asData.write(to: legacyFile)
+
+        self.handler = try self.createHandler(migratingFrom: legacyFile)
+
+        expect(FileManager.default.fileExists(atPath: legacyFile.path)) == false
+        expect(try self.segmentCount()) == 3
+        var storedLines = try await self.handler.readLines().extractValues()
+        expect(storedLines) == Array(lines.dropFirst()) + legacyLines
+
+        let newLine = Self.sampleLine()
+        try await self.handler.append(line: newLine)
+        storedLines = try await self.handler.readLines().extractValues()
+        expect(storedLines) == Array(lines.dropFirst()) + legacyLines + [newLine]
+    }
+
+}
+
+// MARK: - Private
+
+@available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
+private extension SegmentedFileHandlerTests {
+
+    /// Fits two sample lines per segment.
+    static let segmentSize = 80
+
+    func createHandler(migratingFrom legacyFileURL: URL? = nil) throws -> SegmentedFileHandler {
+        return try .init(self.directory, segmentSize: Self.segmentSize, migratingFrom: legacyFileURL)
+    }
+
+    func segmentCount() throws -> Int {
+        return try FileManager.default
+            .contentsOfDirectory(atPath: self.directory.path)
+            .filter { $0.hasSuffix(".segment") }
+            .count
+    }
+
+    static func temporaryDirectoryURL() -> URL {
+        return FileManager.default
+            .temporaryDirectory
+            .appendingPathComponent("segmented_file_handler_tests", isDirectory: true)
+            .appendingPathComponent(UUID().uuidString, isDirectory: true)
+    }
+
+    static func sampleLine() -> String {
+        return UUID().uuidString
+    }
+
+}
@@ -1026,6 +1026,27 @@ class EventsManagerTests: TestCase {
         expect(self.api.invokedPostAdEvents) == true
     }
 
+    // MARK: - commitPendingEvents
+
+    func testCommitPendingEventsCommitsBothStores() async {
+        let adEventStore = MockAdEventStore()
+        self.manager = .init(
+            internalAPI: self.api,
+            userProvider: self.userProvider,
+            store: self.store,
+            systemInfo: MockSystemInfo(finishTransactions: true),
+            appSessionID: self.appSessionID,
+            adEventStore: adEventStore
+        )
+
+        await self.manager.commitPendingEvents()
+
+        let featureCommits = await self.store.commitPendingEventsCount
+        let adCommits = await adEventStore.commitPendingEventsCount
+        expect(featureCommits) == 1
+        expect(adCommits) == 1
+    }
+
     // MARK: - isPriorityEvent
 
     func testPaywallImpressionIsPriorityEvent() {
@@ -1530,6 +1551,12 @@ private actor MockFeatureEventStore: FeatureEventStoreType {
         self.storedEvents.removeFirst(min(count, self.storedEvents.count))
     }
 
+    var commitPendingEventsCount = 0
+
+    func commitPendingEvents() {
+        self.commitPendingEventsCount += 1
+    }
+
 }
 
 // MARK: - MockAdEventStore
@@ -1551,4 +1578,10 @@ private actor MockAdEventStore: AdEventStoreType {
         self.storedEvents.removeFirst(min(count, self.storedEvents.count))
     }
 
+    var commitPendingEventsCount = 0
+
+    func commitPendingEvents() {
+        self.commitPendingEventsCount += 1
+    }
+
 }
@@ -467,4 +467,10 @@ final class MockDiagnosticsTracker: DiagnosticsTrackerType, Sendable {
         }
     }
 
+    let trackedRemoteConfigBlobConcurrencyLimits: Atomic<[Int]> = .init([])
+
+    func trackRemoteConfigBlobConcurrencyLimit(limit: Int) {
+        self.trackedRemoteConfigBlobConcurrencyLimits.modify { $0.append(limit) }
+    }
+
 }
@@ -21,7 +21,7 @@ actor MockFileHandler: FileHandlerType {
     private var file: String = ""
 
     @available(iOS 15.0, tvOS 15.0, macOS 12.0, watchOS 8.0, *)
-    func readLines() throws -> AsyncLineSequence<FileHandle.AsyncBytes> {
+    func readLines() throws -> AsyncThrowingStream<String, Error> {
         let pipe = Pipe()
 
         pipe.fileHandleForWriting.write(self.file.asData)
@@ -30,6 +30,7 @@ actor MockFileHandler: FileHandlerType {
             .fileHandleForReading
             .bytes
             .lines
+            .toAsyncThrowingStream()
     }
 
     private var appendLineError: Error?
@@ -163,8 +163,13 @@ extension SynchronizedLargeItemCache {
             cacheDirectory?.appendingPathComponent(basePath)
         }
 
+        /// The files stubbed as existing directly inside `url`.
         func contentsOfDirectory(at url: URL) throws -> [URL] {
-            return []
+            lock.withLock {
+                cachedContentExistsByURL
+                    .filter { $0.value && $0.key.deletingLastPathComponent() == url }
+                    .map(\.key)
+            }
         }
 
         private func cacheURL(from url: URL) -> URL {
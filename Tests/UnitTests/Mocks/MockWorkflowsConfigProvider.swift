@@ -41,6 +41,16 @@ final class MockWorkflowsConfigProvider: WorkflowsConfigProviderType, @unchecked
         return self.workflowResult(workflowId: workflowId)
     }
 
+    private let _invokedPrioritizeWorkflowsParameters: Atomic<(workflowIds: [String], timeInterval: TimeInterval)?>
+        = .init(nil)
+    var invokedPrioritizeWorkflowsParameters: (workflowIds: [String], timeInterval: TimeInterval)? {
+        return self._invokedPrioritizeWorkflowsParameters.value
+    }
+
+    func prioritizeWorkflows(_ workflowIds: [String], within timeInterval: TimeInterval) async {
+        self._invokedPrioritizeWorkflowsParameters.value = (workflowIds, timeInterval)
+    }
+
     private(set) var invokedDecodeCachedWorkflowForAssetPrewarmingParameters: [String] = []
 
     func decodeCachedWorkflowForAssetPrewarming(
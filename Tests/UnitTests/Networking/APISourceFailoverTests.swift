@@ -161,20 +161,85 @@ final class APISourceFailoverTests: TestCase {
         expect(healthChecker.checkedSourceURLs.value) == [URL(string: "https://a.revenuecat.com/")]
     }
 
+    // MARK: - Passive health
+
+    func testOnRequestFailureFailsOverWithoutHealthCheckWhenRecentRequestsFailed() throws {
+        let provider = RecordingSourceProvider(urls: ["https://a.revenuecat.com/", "https://b.revenuecat.com/"])
+        let healthChecker = MockSourceHealthChecker()
+        let monitor = SourceHealthMonitor()
+        Self.record(.failure, count: SourceHealthMonitor.minimumSampleCount, host: "a.revenuecat.com", in: monitor)
+        let failover = Self.failover(provider, healthChecker: healthChecker, healthMonitor: monitor)
+
+        let source = try XCTUnwrap(failover.currentSource(for: Self.eligiblePath, isFallbackAttempt: false))
+        let decision = self.decision(of: failover, for: source)
+
+        guard case let .retryNextSource(next) = decision else {
+            fail("Expected retryNextSource, got \(String(describing: decision))")
+            return
+        }
+        expect(next.url) == URL(string: "https://b.revenuecat.com/")
+        expect(healthChecker.checkedSourceURLs.value).to(beEmpty())
+    }
+
+    func testOnRequestFailureStaysWithoutHealthCheckWhenRecentRequestsSucceeded() throws {
+        let provider = RecordingSourceProvider(urls: ["https://a.revenuecat.com/", "https://b.revenuecat.com/"])
+        let healthChecker = MockSourceHealthChecker()
+        healthChecker.stubbedIsHealthy.value = false
+        let monitor = SourceHealthMonitor()
+        Self.record(.success(latency: 0.1), count: 10, host: "a.revenuecat.com", in: monitor)
+        let failover = Self.failover(provider, healthChecker: healthChecker, healthMonitor: monitor)
+
+        let source = try XCTUnwrap(failover.currentSource(for: Self.eligiblePath, isFallbackAttempt: false))
+        let decision = self.decision(of: failover, for: source)
+
+        guard case .sourceHealthy = decision else {
+            fail("Expected sourceHealthy, got \(String(describing: decision))")
+            return
+        }
+        expect(healthChecker.checkedSourceURLs.value).to(beEmpty())
+        expect(provider.unhealthyReports.value).to(beEmpty())
+    }
+
+    func testOnRequestFailureHealthChecksWhenRecentRequestsAreInconclusive() throws {
+        let provider = RecordingSourceProvider(urls: ["https://a.revenuecat.com/", "https://b.revenuecat.com/"])
+        let healthChecker = MockSourceHealthChecker()
+        let monitor = SourceHealthMonitor()
+        Self.record(.success(latency: 0.1), count: 1, host: "a.revenuecat.com", in: monitor)
+        let failover = Self.failover(provider, healthChecker: healthChecker, healthMonitor: monitor)
+
+        let source = try XCTUnwrap(failover.currentSource(for: Self.eligiblePath, isFallbackAttempt: false))
+        _ = self.decision(of: failover, for: source)
+
+        expect(healthChecker.checkedSourceURLs.value) == [URL(string: "https://a.revenuecat.com/")]
+    }
+
     // MARK: - Helpers
 
     private static func failover(
         _ provider: RemoteConfigSourceProviderType,
         usesRemoteConfigAPISources: Bool = true,
-        healthChecker: SourceHealthCheckerType = MockSourceHealthChecker()
+        healthChecker: SourceHealthCheckerType = MockSourceHealthChecker(),
+        healthMonitor: SourceHealthMonitorType? = nil
     ) -> APISourceFailover {
         return APISourceFailover(
             usesRemoteConfigAPISources: usesRemoteConfigAPISources,
             sourceProvider: provider,
-            healthChecker: healthChecker
+            healthChecker: healthChecker,
+            healthMonitor: healthMonitor
         )
     }
 
+    private static func record(
+        _ outcome: SourceHealthMonitor.Outcome,
+        count: Int,
+        host: String,
+        in monitor: SourceHealthMonitor
+    ) {
+        for _ in 0..<count {
+            monitor.record(outcome, host: host)
+        }
+    }
+
     /// The mock health checker completes synchronously, so the decision is available on return.
     private func decision(
         of failover: APISourceFailover,
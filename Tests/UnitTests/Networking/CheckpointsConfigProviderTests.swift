@@ -303,6 +303,12 @@ private final class FakeCheckpointsDiskCache: RemoteConfigDiskCacheType {
         return true
     }
 
+    func writeContainer(_ container: RemoteConfigContainer) {}
+
+    func readContainer() -> RCContainer? {
+        return nil
+    }
+
     func clear() {
         self.lock.perform { self._stubbedRead = nil }
     }
@@ -118,9 +118,14 @@ class ETagManagerTests: TestCase {
         expect(response?.httpStatusCode) == .success
         expect(response?.body) == cachedResponse
 
-        let newCachedResponse = try self.getCachedResponse(for: request)
-        expect(newCachedResponse.validationTime).toNot(beCloseTo(validationTime, within: 1))
-        expect(newCachedResponse.validationTime).to(beCloseToNow())
+        // Only the index is updated, the response itself isn't written again
+        expect(self.responseSaveInvocations).to(beEmpty())
+
+        let header = self.eTagManager.eTagHeader(for: request, withSignatureVerification: false)
+        let newValidationTime = try XCTUnwrap(
+            header[ETagManager.lastRefreshTimeRequestHeader.rawValue].flatMap(Double.init)
+        )
+        expect(Date(timeIntervalSince1970: newValidationTime / 1000)).to(beCloseToNow())
     }
 
     func testStoredResponseIsNotUsedIfResponseCodeIs200() throws {
@@ -228,7 +233,7 @@ class ETagManagerTests: TestCase {
         )
 
         expect(response).toNot(beNil())
-        expect(self.mockCache.saveDataInvocations.count) == 1
+        expect(self.responseSaveInvocations).to(haveCount(1))
 
         let setData = try XCTUnwrap(self.mockCache.saveDataInvocations.first?.data)
         expect(setData).toNot(beNil())
@@ -258,7 +263,7 @@ class ETagManagerTests: TestCase {
         )
 
         expect(response).toNot(beNil())
-        expect(self.mockCache.saveDataInvocations.count) == 1
+        expect(self.responseSaveInvocations).to(haveCount(1))
 
         let setData = try XCTUnwrap(self.mockCache.saveDataInvocations.first?.data)
         expect(setData).toNot(beNil())
@@ -930,7 +935,7 @@ class ETagManagerTests: TestCase {
         )
 
         expect(response).toNot(beNil())
-        expect(self.mockCache.saveDataInvocations.count) == 1
+        expect(self.responseSaveInvocations).to(haveCount(1))
 
         let setData = try XCTUnwrap(self.mockCache.saveDataInvocations.first?.data)
         let eTagResponse = try ETagManager.Response.with(setData)
@@ -1019,7 +1024,7 @@ class ETagManagerTests: TestCase {
         )
 
         expect(response).toNot(beNil())
-        expect(self.mockCache.saveDataInvocations.count) == 1
+        expect(self.responseSaveInvocations).to(haveCount(1))
 
         let setData = try XCTUnwrap(self.mockCache.saveDataInvocations.first?.data)
         let eTagResponse = try ETagManager.Response.with(setData)
@@ -1083,6 +1088,263 @@ class ETagManagerTests: TestCase {
         expect(eTagResponse.isFallbackUrlResponse) == true
     }
 
+    // MARK: - Index
+
+    func testETagHeaderForStoredResponseDoesNotReadFromDisk() throws {
+        let request = URLRequest(url: Self.testURL)
+
+        _ = self.eTagManager.httpResultFromCacheOrBackend(
+            with: self.responseForTest(url: Self.testURL,
+                                       body: "response".asData,
+                                       eTag: Self.testETag,
+                                       statusCode: .success),
+            request: request,
+            retried: false,
+            isFallbackURLRequest: false
+        )
+        let loadFileCount = self.mockCache.loadFileInvocations.count
+        let cachedContentExistsCount = self.mockCache.cachedContentExistsInvocations.count
+
+        for _ in 0..<3 {
+            let header = self.eTagManager.eTagHeader(for: request, withSignatureVerification: false)
+            expect(header[ETagManager.eTagRequestHeader.rawValue]) == Self.testETag
+        }
+
+        expect(self.mockCache.loadFileInvocations).to(haveCount(loadFileCount))
+        expect(self.mockCache.cachedContentExistsInvocations).to(haveCount(cachedContentExistsCount))
+    }
+
+    func testStoringResponsePersistsIndex() throws {
+        let request = URLRequest(url: Self.testURL)
+        self.eTagManager = self.createManagerWritingIndexImmediately()
+
+        _ = self.eTagManager.httpResultFromCacheOrBackend(
+            with: self.responseForTest(url: Self.testURL,
+                                       body: "response".asData,
+                                       eTag: Self.testETag,
+                                       statusCode: .success,
+                                       verificationResult: .verified),
+            request: request,
+            retried: false,
+            isFallbackURLRequest: false
+        )
+
+        expect(self.indexSaveInvocations).toEventually(haveCount(1))
+        let indexData = try XCTUnwrap(self.indexSaveInvocations.last?.data)
+        let entries: [String: ETagManager.IndexEntry] = try JSONDecoder.default.decode(jsonData: indexData)
+        let cacheKey = try request.cacheKey
+
+        expect(entries.count) == 1
+        expect(entries[cacheKey]?.eTag) == Self.testETag
+        expect(entries[cacheKey]?.verificationResult) == .verified
+    }
+
+    func testETagHeaderIsLoadedFromPersistedIndex() throws {
+        let request = URLRequest(url: Self.testURL)
+        let validationTime = Date(timeIntervalSince1970: 800000)
+
+        try self.stubIndex([
+            try request.cacheKey: .init(ETagManager.Response(eTag: Self.testETag,
+                                                             statusCode: .success,
+                                                             data: Data(),
+                                                             validationTime: validationTime,
+                                                             verificationResult: .notRequested,
+                                                             isLoadShedderResponse: false,
+                                                             isFallbackUrlResponse: false))
+        ])
+
+        let header = self.eTagManager.eTagHeader(for: request, withSignatureVerification: false)
+        expect(header) == [
+            ETagManager.eTagRequestHeader.rawValue: Self.testETag,
+            ETagManager.lastRefreshTimeRequestHeader.rawValue: validationTime.millisecondsSince1970.description
+        ]
+        expect(self.mockCache.loadFileInvocations.map(\.lastPathComponent)) == [ETagManager.indexCacheKey]
+    }
+
+    func testResponsesMissingFromTheIndexAreAddedToItWhenLoaded() throws {
+        let request = URLRequest(url: Self.testURL)
+        self.eTagManager = self.createManagerWritingIndexImmediately()
+
+        try self.mockStoredETagResponse(for: request)
+        try self.stubIndex([:])
+
+        let header = self.eTagManager.eTagHeader(for: request, withSignatureVerification: false)
+        expect(header[ETagManager.eTagRequestHeader.rawValue]) == Self.testETag
+
+        expect(self.indexSaveInvocations).toEventually(haveCount(1))
+        let indexData = try XCTUnwrap(self.indexSaveInvocations.last?.data)
+        let entries: [String: ETagManager.IndexEntry] = try JSONDecoder.default.decode(jsonData: indexData)
+        expect(entries[try request.cacheKey]?.eTag) == Self.testETag
+        expect(entries[try request.cacheKey]?.byteCount) > 0
+    }
+
+    func testUnreadableResponsesMissingFromTheIndexAreDeleted() throws {
+        let request = URLRequest(url: Self.testURL)
+
+        self.mockCache.stubLoadFile(at: Self.testURL, with: .success("not a response".asData))
+
+        let header = self.eTagManager.eTagHeader(for: request, withSignatureVerification: false)
+        expect(header[ETagManager.eTagRequestHeader.rawValue]) == ""
+        expect(self.mockCache.removeInvocations).to(haveCount(1))
+    }
+
+    func testResponsesMissingFromTheIndexAreEvictedFirst() throws {
+        let body = "response".asData
+        let request1 = URLRequest(url: Self.testURL)
+        let request2 = URLRequest(url: Self.testURL2)
+
+        self.store(body, for: request1)
+        let responseByteCount = try XCTUnwrap(self.responseSaveInvocations.first?.data.count)
+
+        // Room for one response
+        self.eTagManager = ETagManager(
+            largeItemCache: SynchronizedLargeItemCache(cache: self.mockCache, basePath: "eviction"),
+            byteBudget: responseByteCount * 3 / 2
+        )
+        try self.mockStoredETagResponse(for: request1)
+
+        self.store(body, for: request2)
+
+        expect(self.mockCache.removeInvocations).to(haveCount(1))
+        expect(self.eTag(for: request1)) == ""
+        expect(self.eTag(for: request2)) == Self.testETag
+    }
+
+    func testMissingResponsesAreNotLookedUpOnDisk() throws {
+        let request = URLRequest(url: Self.testURL)
+
+        for _ in 0..<3 {
+            let header = self.eTagManager.eTagHeader(for: request, withSignatureVerification: false)
+            expect(header[ETagManager.eTagRequestHeader.rawValue]) == ""
+        }
+
+        let responseLookups = self.mockCache.cachedContentExistsInvocations.filter {
+            $0.lastPathComponent != ETagManager.indexCacheKey
+        }
+        expect(responseLookups).to(beEmpty())
+    }
+
+    func testIndexChangesAreWrittenOnce() throws {
+        self.eTagManager = self.createManagerWritingIndexImmediately()
+
+        self.store("response".asData, for: URLRequest(url: Self.testURL))
+        self.store("response".asData, for: URLRequest(url: Self.testURL2))
+        self.store("response".asData, for: URLRequest(url: Self.testURL3))
+
+        expect(self.indexSaveInvocations).toEventually(haveCount(1))
+        let entries: [String: ETagManager.IndexEntry] = try JSONDecoder.default.decode(
+            jsonData: try XCTUnwrap(self.indexSaveInvocations.last?.data)
+        )
+        expect(entries).to(haveCount(3))
+    }
+
+    func testStoredResponseBodyIsOnlyLoadedOnNotModified() throws {
+        let request = URLRequest(url: Self.testURL)
+
+        let cachedResponse = try self.mockStoredETagResponse(for: request)
+        _ = self.eTagManager.eTagHeader(for: request, withSignatureVerification: false)
+        let loadFileCount = self.mockCache.loadFileInvocations.count
+
+        _ = self.eTagManager.eTagHeader(for: request, withSignatureVerification: false)
+        expect(self.mockCache.loadFileInvocations).to(haveCount(loadFileCount))
+
+        let response = self.eTagManager.httpResultFromCacheOrBackend(
+            with: self.responseForTest(url: Self.testURL,
+                                       body: nil,
+                                       eTag: Self.testETag,
+                                       statusCode: .notModified),
+            request: request,
+            retried: false,
+            isFallbackURLRequest: false
+        )
+        expect(response?.body) == cachedResponse
+        expect(self.mockCache.loadFileInvocations).to(haveCount(loadFileCount + 1))
+    }
+
+    func testClearCachesClearsIndex() throws {
+        let request = URLRequest(url: Self.testURL)
+
+        try self.mockStoredETagResponse(for: request)
+        expect(self.eTagManager.eTagHeader(for: request, withSignatureVerification: false)
+            [ETagManager.eTagRequestHeader.rawValue]) == Self.testETag
+
+        self.eTagManager.clearCaches()
+
+        expect(self.eTagManager.eTagHeader(for: request, withSignatureVerification: false)
+            [ETagManager.eTagRequestHeader.rawValue]) == ""
+    }
+
+    // MARK: - Compression and eviction
+
+    func testSmallResponsesAreStoredUncompressed() throws {
+        let body = "response".asData
+
+        self.store(body, for: URLRequest(url: Self.testURL))
+
+        let stored = try ETagManager.Response.with(try XCTUnwrap(self.responseSaveInvocations.first?.data))
+        expect(stored.bodyCompression) == .uncompressed
+        expect(stored.data) == body
+    }
+
+    func testLargeResponsesAreStoredCompressed() throws {
+        let body = Self.largeBody
+
+        self.store(body, for: URLRequest(url: Self.testURL))
+
+        let stored = try ETagManager.Response.with(try XCTUnwrap(self.responseSaveInvocations.first?.data))
+        expect(stored.bodyCompression) == .lzfse
+        expect(stored.data.count) < body.count
+    }
+
+    func testCompressedResponseIsDecompressedWhenServingNotModified() throws {
+        let request = URLRequest(url: Self.testURL)
+        let body = Self.largeBody
+
+        self.store(body, for: request)
+        let storedData = try XCTUnwrap(self.responseSaveInvocations.first?.data)
+        self.mockCache.stubLoadFile(at: Self.testURL, with: .success(storedData))
+
+        let response = self.eTagManager.httpResultFromCacheOrBackend(
+            with: self.responseForTest(url: Self.testURL,
+                                       body: nil,
+                                       eTag: Self.testETag,
+                                       statusCode: .notModified),
+            request: request,
+            retried: false,
+            isFallbackURLRequest: false
+        )
+
+        expect(response?.httpStatusCode) == .success
+        expect(response?.body) == body
+    }
+
+    func testLeastRecentlyUsedResponsesAreEvictedOverByteBudget() throws {
+        let body = "response".asData
+        let request1 = URLRequest(url: Self.testURL)
+        let request2 = URLRequest(url: Self.testURL2)
+        let request3 = URLRequest(url: Self.testURL3)
+
+        self.store(body, for: request1)
+        let responseByteCount = try XCTUnwrap(self.responseSaveInvocations.first?.data.count)
+
+        // Room for two responses
+        self.eTagManager = ETagManager(
+            largeItemCache: SynchronizedLargeItemCache(cache: self.mockCache, basePath: "eviction"),
+            byteBudget: responseByteCount * 5 / 2
+        )
+
+        self.store(body, for: request1)
+        self.store(body, for: request2)
+        // Using the first response makes the second one the least recently used
+        _ = self.eTagManager.eTagHeader(for: request1, withSignatureVerification: false)
+        self.store(body, for: request3)
+
+        expect(self.mockCache.removeInvocations).to(haveCount(1))
+        expect(self.eTag(for: request1)) == Self.testETag
+        expect(self.eTag(for: request2)) == ""
+        expect(self.eTag(for: request3)) == Self.testETag
+    }
+
     // MARK: - Old directory deletion
 
     func testDeletesOldETagCacheDirectoryFromDocuments() throws {
@@ -1168,12 +1430,50 @@ private extension ETagManagerTests {
         return data
     }
 
-    func getCachedResponse(for request: URLRequest) throws -> ETagManager.Response {
-        let savedData = try XCTUnwrap(self.mockCache.saveDataInvocations.filter({ data in
-            data.url == request.url || data.url.absoluteString
-                .contains(request.url?.absoluteString.asData.md5String ?? "this should not happen")
-        }).first?.data)
-        return try ETagManager.Response.with(savedData)
+    func stubIndex(_ entries: [String: ETagManager.IndexEntry]) throws {
+        let indexURL = try XCTUnwrap(self.mockCache.workingCacheDirectory)
+            .appendingPathComponent(ETagManager.indexCacheKey)
+
+        self.mockCache.loadFileResponsesByURL[indexURL] = .success(try JSONEncoder.default.encode(entries))
+        self.mockCache.cachedContentExistsByURL[indexURL] = true
+    }
+
+    func store(_ body: Data, for request: URLRequest) {
+        _ = self.eTagManager.httpResultFromCacheOrBackend(
+            with: self.responseForTest(url: request.url.unsafelyUnwrapped,
+                                       body: body,
+                                       eTag: Self.testETag,
+                                       statusCode: .success),
+            request: request,
+            retried: false,
+            isFallbackURLRequest: false
+        )
+    }
+
+    func eTag(for request: URLRequest) -> String? {
+        return self.eTagManager.eTagHeader(for: request,
+                                           withSignatureVerification: false)[ETagManager.eTagRequestHeader.rawValue]
+    }
+
+    /// Writes of stored responses, leaving out those of the index.
+    var responseSaveInvocations: [SynchronizedLargeItemCache.MockUnderlyingSynchronizedFileCache.SaveData] {
+        return self.mockCache.saveDataInvocations.filter {
+            $0.url.lastPathComponent != ETagManager.indexCacheKey
+        }
+    }
+
+    var indexSaveInvocations: [SynchronizedLargeItemCache.MockUnderlyingSynchronizedFileCache.SaveData] {
+        return self.mockCache.saveDataInvocations.filter {
+            $0.url.lastPathComponent == ETagManager.indexCacheKey
+        }
+    }
+
+    /// Uses a short index write delay, so that writes can be awaited.
+    func createManagerWritingIndexImmediately() -> ETagManager {
+        return ETagManager(
+            largeItemCache: SynchronizedLargeItemCache(cache: self.mockCache, basePath: "index-\(UUID().uuidString)"),
+            indexWriteDelay: .milliseconds(50)
+        )
     }
 
     func responseForTest(
@@ -1197,6 +1497,11 @@ private extension ETagManagerTests {
 
     private static let testURL = HTTPRequest.Path.getCustomerInfo(appUserID: "appUserID").url(preferIAMPath: false)!
     private static let testURL2 = HTTPRequest.Path.getCustomerInfo(appUserID: "appUserID_2").url(preferIAMPath: false)!
+    private static let testURL3 = HTTPRequest.Path.getCustomerInfo(appUserID: "appUserID_3").url(preferIAMPath: false)!
+
+    /// A body above `ETagManager.compressionThreshold` that compresses well, like real JSON does.
+    private static let largeBody = String(repeating: "{\"product\": \"monthly\", \"price\": 9.99}, ",
+                                          count: 1000).asData
 
     static let testETag = "etag_1"
 
@@ -74,7 +74,8 @@ class BaseHTTPClientTests<ETag: ETagManager, TimeoutManager: HTTPRequestTimeoutM
         _ systemInfo: SystemInfo,
         operationDispatcher: OperationDispatcher = MockOperationDispatcher(),
         apiSourceProvider: RemoteConfigSourceProviderType? = nil,
-        sourceHealthChecker: SourceHealthCheckerType = SourceHealthChecker()
+        sourceHealthChecker: SourceHealthCheckerType = SourceHealthChecker(),
+        concurrentRequestLimit: Int = 0
     ) -> HTTPClient {
         // The real `SourceHealthChecker` default keeps health probes visible to OHHTTPStubs; tests
         // that need a fixed health result inject a `MockSourceHealthChecker` instead.
@@ -93,7 +94,8 @@ class BaseHTTPClientTests<ETag: ETagManager, TimeoutManager: HTTPRequestTimeoutM
                           networkTimeout: .custom(defaultRequestTimeout),
                           operationDispatcher: operationDispatcher,
                           apiSourceFailover: apiSourceFailover,
-                          timeoutManager: timeoutManager)
+                          timeoutManager: timeoutManager,
+                          concurrentRequestLimit: concurrentRequestLimit)
     }
 }
 
@@ -2722,6 +2724,128 @@ final class HTTPClientTests: BaseHTTPClientTests<MockETagManager, HTTPRequestTim
         expect(thirdRequestFinished.value) == true
     }
 
+    func testConcurrentRequestDoesNotWaitForSlowSerialRequest() {
+        let client = self.createClient(self.systemInfo, concurrentRequestLimit: 2)
+        let serialPath: HTTPRequest.Path = .mockPath
+        let concurrentPath: HTTPRequest.Path = .getOfferings(appUserID: "user")
+
+        let serialRequestFinished: Atomic<Bool> = false
+        let concurrentRequestFinishedFirst: Atomic<Bool?> = nil
+
+        stub(condition: isPath(serialPath)) { _ in
+            return HTTPStubsResponse(data: Data("{}".utf8), statusCode: .success, headers: nil)
+                .responseTime(0.5)
+        }
+        stub(condition: isPath(concurrentPath)) { _ in
+            return HTTPStubsResponse(data: Data("{}".utf8), statusCode: .success, headers: nil)
+                .responseTime(0.01)
+        }
+
+        let expectations = [
+            self.expectation(description: "Serial request"),
+            self.expectation(description: "Concurrent request")
+        ]
+
+        client.perform(.init(method: .requestNumber(1), path: serialPath)) { (_: DataResponse) in
+            serialRequestFinished.value = true
+            expectations[0].fulfill()
+        }
+        client.perform(.init(method: .get, path: concurrentPath)) { (_: DataResponse) in
+            concurrentRequestFinishedFirst.value = !serialRequestFinished.value
+            expectations[1].fulfill()
+        }
+
+        self.waitForExpectations(timeout: defaultRequestTimeout)
+
+        expect(concurrentRequestFinishedFirst.value) == true
+    }
+
+    func testConcurrentRequestsWaitForAFreeSlot() {
+        let client = self.createClient(self.systemInfo, concurrentRequestLimit: 1)
+        let path: HTTPRequest.Path = .getOfferings(appUserID: "user")
+
+        let firstRequestFinished: Atomic<Bool> = false
+        let secondRequestStartedAfterFirst: Atomic<Bool?> = nil
+        let requestCount: Atomic<Int> = .init(0)
+
+        stub(condition: isPath(path)) { _ in
+            let isSecondRequest = requestCount.modify { count in
+                count += 1
+                return count == 2
+            }
+            if isSecondRequest {
+                secondRequestStartedAfterFirst.value = firstRequestFinished.value
+            }
+
+            return HTTPStubsResponse(data: Data("{}".utf8), statusCode: .success, headers: nil)
+                .responseTime(0.1)
+        }
+
+        let expectations = [
+            self.expectation(description: "Request 1"),
+            self.expectation(description: "Request 2")
+        ]
+
+        client.perform(.init(method: .get, path: path)) { (_: DataResponse) in
+            firstRequestFinished.value = true
+            expectations[0].fulfill()
+        }
+        client.perform(.init(method: .get, path: path)) { (_: DataResponse) in
+            expectations[1].fulfill()
+        }
+
+        self.waitForExpectations(timeout: defaultRequestTimeout)
+
+        expect(secondRequestStartedAfterFirst.value) == true
+        expect(client.queueMetrics.concurrent.peakDepth) == 1
+        expect(client.queueMetrics.concurrent.startedCount) == 1
+        expect(client.queueMetrics.serial.startedCount) == 0
+    }
+
+    func testPathsAllowingConcurrentRequestsStaySerialWithoutConcurrentSlots() {
+        let path: HTTPRequest.Path = .getOfferings(appUserID: "user")
+        let firstRequestFinished: Atomic<Bool> = false
+        let secondRequestStartedAfterFirst: Atomic<Bool?> = nil
+        let requestCount: Atomic<Int> = .init(0)
+
+        stub(condition: isPath(path)) { _ in
+            let isSecondRequest = requestCount.modify { count in
+                count += 1
+                return count == 2
+            }
+            if isSecondRequest {
+                secondRequestStartedAfterFirst.value = firstRequestFinished.value
+            }
+
+            return HTTPStubsResponse(data: Data("{}".utf8), statusCode: .success, headers: nil)
+                .responseTime(0.1)
+        }
+
+        let expectations = [
+            self.expectation(description: "Request 1"),
+            self.expectation(description: "Request 2")
+        ]
+
+        self.client.perform(.init(method: .get, path: path)) { (_: DataResponse) in
+            firstRequestFinished.value = true
+            expectations[0].fulfill()
+        }
+        self.client.perform(.init(method: .get, path: path)) { (_: DataResponse) in
+            expectations[1].fulfill()
+        }
+
+        self.waitForExpectations(timeout: defaultRequestTimeout)
+
+        expect(secondRequestStartedAfterFirst.value) == true
+        expect(self.client.queueMetrics.serial.startedCount) == 1
+    }
+
+    func testRequestsReadingPurchaseResultsDoNotAllowConcurrentRequests() {
+        expect(HTTPRequest.Path.getVirtualCurrencies(appUserID: "user").allowsConcurrentRequests) == false
+        expect(HTTPRequest.Path.getCustomerInfo(appUserID: "user").allowsConcurrentRequests) == false
+        expect(HTTPRequest.Path.getOfferings(appUserID: "user").allowsConcurrentRequests) == true
+    }
+
     func testPerformRequestExitsWithErrorIfBodyCouldntBeParsedIntoJSON() throws {
         let response = waitUntilValue { completion in
             self.client.perform(.init(method: .invalidBody(), path: .mockPath)) { (result: DataResponse) in
@@ -0,0 +1,58 @@
+//
+//  HTTPLatencyHistogramTests.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+final class HTTPLatencyHistogramTests: TestCase {
+
+    func testEmptyHistogramHasNoPercentiles() {
+        expect(HTTPLatencyHistogram().latency(atPercentile: 0.99)).to(beNil())
+    }
+
+    func testPercentileIsWithinOneBucketOfTheTrueValue() throws {
+        var histogram = HTTPLatencyHistogram()
+        for millis in 1...100 {
+            histogram.record(Double(millis) / 100)
+        }
+
+        let p99 = try XCTUnwrap(histogram.latency(atPercentile: 0.99))
+        expect(p99) >= 0.99
+        expect(p99) <= 0.99 * HTTPLatencyHistogram.bucketGrowthFactor
+
+        let p50 = try XCTUnwrap(histogram.latency(atPercentile: 0.5))
+        expect(p50) >= 0.5
+        expect(p50) <= 0.5 * HTTPLatencyHistogram.bucketGrowthFactor
+    }
+
+    func testLatenciesOutsideTheRangeAreClamped() {
+        var histogram = HTTPLatencyHistogram()
+        histogram.record(0)
+        expect(histogram.latency(atPercentile: 1)) == HTTPLatencyHistogram.minimumLatency
+
+        histogram.record(HTTPLatencyHistogram.maximumLatency * 10)
+        expect(histogram.latency(atPercentile: 1)) == HTTPLatencyHistogram.maximumLatency
+    }
+
+    func testOldSamplesDecay() throws {
+        var histogram = HTTPLatencyHistogram()
+        for _ in 0..<HTTPLatencyHistogram.decayThreshold {
+            histogram.record(5)
+        }
+        expect(histogram.sampleCount) == HTTPLatencyHistogram.decayThreshold / 2
+
+        for _ in 0..<(HTTPLatencyHistogram.decayThreshold * 8) {
+            histogram.record(0.1)
+        }
+
+        let p99 = try XCTUnwrap(histogram.latency(atPercentile: 0.99))
+        expect(p99) < 1
+    }
+
+}
@@ -512,4 +512,110 @@ class HTTPRequestTimeoutManagerTests: TestCase {
             HTTPRequestTimeoutManager.Timeout.mainSourceNoFallbackReduced
         )
     }
+
+    // MARK: - Adaptive timeouts
+
+    func testAdaptiveTimeoutIsNotUsedBeforeEnoughSamples() {
+        recordLatencies(0.1, count: HTTPRequestTimeoutManager.adaptiveMinimumSampleCount - 1)
+
+        XCTAssertEqual(
+            adaptiveTimeout(endpointSupportsFallbackURLs: true),
+            HTTPRequestTimeoutManager.Timeout.mainSourceSupportingFallback
+        )
+    }
+
+    func testFastEndpointIsClampedToReducedTier() {
+        recordLatencies(0.1, count: HTTPRequestTimeoutManager.adaptiveMinimumSampleCount)
+
+        XCTAssertEqual(
+            adaptiveTimeout(endpointSupportsFallbackURLs: true),
+            HTTPRequestTimeoutManager.Timeout.mainSourceSupportingFallbackReduced
+        )
+    }
+
+    func testAdaptiveTimeoutFollowsObservedLatency() {
+        recordLatencies(1.5, count: HTTPRequestTimeoutManager.adaptiveMinimumSampleCount)
+
+        let timeout = adaptiveTimeout(endpointSupportsFallbackURLs: true)
+        XCTAssertGreaterThanOrEqual(timeout, 1.5 * HTTPRequestTimeoutManager.adaptiveSafetyFactor)
+        XCTAssertLessThan(timeout, HTTPRequestTimeoutManager.Timeout.mainSourceSupportingFallback)
+    }
+
+    func testSlowEndpointGetsLongerTimeoutUpToFlatTier() {
+        recordLatencies(8, count: HTTPRequestTimeoutManager.adaptiveMinimumSampleCount)
+        XCTAssertGreaterThan(adaptiveTimeout(endpointSupportsFallbackURLs: false),
+                             HTTPRequestTimeoutManager.Timeout.mainSourceNoFallback)
+
+        recordLatencies(50, count: HTTPRequestTimeoutManager.adaptiveMinimumSampleCount * 10)
+        XCTAssertEqual(adaptiveTimeout(endpointSupportsFallbackURLs: false),
+                       HTTPRequestTimeoutManager.Timeout.flat)
+    }
+
+    func testAdaptiveTimeoutIsPerHostAndEndpoint() {
+        recordLatencies(0.1, count: HTTPRequestTimeoutManager.adaptiveMinimumSampleCount)
+
+        XCTAssertEqual(
+            adaptiveTimeout(host: Self.hostB, endpointSupportsFallbackURLs: true),
+            HTTPRequestTimeoutManager.Timeout.mainSourceSupportingFallback
+        )
+        XCTAssertEqual(
+            adaptiveTimeout(endpoint: "other_endpoint", endpointSupportsFallbackURLs: true),
+            HTTPRequestTimeoutManager.Timeout.mainSourceSupportingFallback
+        )
+    }
+
+    func testRecentTimeoutStillUsesReducedTier() {
+        recordLatencies(8, count: HTTPRequestTimeoutManager.adaptiveMinimumSampleCount)
+        manager.recordRequestResult(host: Self.hostA, .mainSourceTimedOut)
+
+        XCTAssertEqual(
+            adaptiveTimeout(endpointSupportsFallbackURLs: false),
+            HTTPRequestTimeoutManager.Timeout.mainSourceNoFallbackReduced
+        )
+    }
+
+    func testAdaptiveTimeoutIsNotUsedWhenReTieredTimeoutsDisabled() {
+        recordLatencies(0.1, count: HTTPRequestTimeoutManager.adaptiveMinimumSampleCount)
+
+        XCTAssertEqual(
+            adaptiveTimeout(endpointSupportsFallbackURLs: true, reTieredTimeoutsEnabled: false),
+            HTTPRequestTimeoutManager.Timeout.mainSourceSupportingFallback
+        )
+    }
+
+    func testAdaptiveTimeoutIsNotUsedWithCustomNetworkTimeout() {
+        for _ in 0..<HTTPRequestTimeoutManager.adaptiveMinimumSampleCount {
+            customManager.recordLatency(0.1, host: Self.hostA, endpoint: Self.endpoint)
+        }
+
+        XCTAssertEqual(
+            customManager.timeout(host: Self.hostA,
+                                  endpoint: Self.endpoint,
+                                  isFallbackHostRequest: false,
+                                  endpointSupportsFallbackURLs: true,
+                                  isProxied: false,
+                                  reTieredTimeoutsEnabled: true),
+            Self.customTimeout
+        )
+    }
+
+    private static let endpoint = "get_customer"
+
+    private func recordLatencies(_ latency: TimeInterval, count: Int) {
+        for _ in 0..<count {
+            manager.recordLatency(latency, host: Self.hostA, endpoint: Self.endpoint)
+        }
+    }
+
+    private func adaptiveTimeout(host: String = HTTPRequestTimeoutManagerTests.hostA,
+                                 endpoint: String = HTTPRequestTimeoutManagerTests.endpoint,
+                                 endpointSupportsFallbackURLs: Bool,
+                                 reTieredTimeoutsEnabled: Bool = true) -> TimeInterval {
+        return manager.timeout(host: host,
+                               endpoint: endpoint,
+                               isFallbackHostRequest: false,
+                               endpointSupportsFallbackURLs: endpointSupportsFallbackURLs,
+                               isProxied: false,
+                               reTieredTimeoutsEnabled: reTieredTimeoutsEnabled)
+    }
 }
@@ -0,0 +1,120 @@
+//
+//  RCContainer+Builder.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import CryptoKit
+import Foundation
+
+@testable import RevenueCat
+
+extension RCContainer {
+
+    /// Encodes RC Container v1 bytes in the layout documented on `RCContainer`.
+    ///
+    /// Payloads are appended decoded; the builder computes each element checksum over the decoded bytes,
+    /// encodes the payload with the requested content encoding and pads it to the 8-byte alignment. The
+    /// first appended element is the config element, matching what `RemoteConfigAPI` expects.
+    ///
+    /// zstd payloads are written as a single frame of raw blocks: valid input for the SDK's zstd decoder,
+    /// without needing a zstd encoder in the tests.
+    struct Builder {
+
+        private var data: Data
+
+        /// Starts a container whose header carries `flags`.
+        init(flags: UInt8 = 0) {
+            var header = Data([UInt8(ascii: "R"), UInt8(ascii: "C"), Self.version, flags])
+            header.append(contentsOf: [0, 0, 0, 0])
+            self.data = header
+        }
+
+        /// Appends `payload` as the next element, encoded with `encoding` on the wire.
+        ///
+        /// - Throws: `Parser.FormatError.unsupportedContentEncoding` for encodings the builder cannot produce.
+        mutating func append(_ payload: Data, encoding: Element.ContentEncoding = .none) throws {
+            let wirePayload = try Self.encode(payload, as: encoding)
+            guard let wireSize = UInt32(exactly: wirePayload.count) else {
+                throw Parser.FormatError.unsupportedContentEncoding(encoding.rawValue)
+            }
+
+            self.data.append(contentsOf: SHA256.hash(data: payload).prefix(ChecksumKey.byteCount))
+            self.data.append(contentsOf: (0..<4).map { UInt8(truncatingIfNeeded: wireSize >> (8 * $0)) })
+            self.data.append(contentsOf: [encoding.rawValue, 0, 0, 0])
+            self.data.append(wirePayload)
+            self.data.append(contentsOf: [UInt8](
+                repeating: 0,
+                count: ElementParser.paddingSize(forElementSize: wirePayload.count)
+            ))
+        }
+
+        /// The encoded container bytes.
+        func build() -> Data {
+            return self.data
+        }
+
+    }
+
+}
+
+private extension RCContainer.Builder {
+
+    static let version: UInt8 = 1
+
+    static func encode(_ payload: Data, as encoding: RCContainer.Element.ContentEncoding) throws -> Data {
+        switch encoding {
+        case .none:
+            return payload
+        case .gzip:
+            return try RCContainerTestData.gzipCompressed(payload)
+        case .brotli:
+            return try RCContainerTestData.brotliCompressed(payload)
+        case .zstd:
+            return Self.zstdRawBlockFrame(payload)
+        case .unsupported:
+            throw RCContainer.Parser.FormatError.unsupportedContentEncoding(encoding.rawValue)
+        }
+    }
+
+    /// The largest raw block zstd allows (RFC 8878, section 3.1.1.2.4).
+    static let zstdMaximumBlockSize = 128 * 1024
+
+    /// A single-segment zstd frame (RFC 8878, section 3.1.1) that declares its content size and stores
+    /// `payload` uncompressed in raw blocks of at most `zstdMaximumBlockSize` bytes.
+    static func zstdRawBlockFrame(_ payload: Data) -> Data {
+        var frame = Data([0x28, 0xB5, 0x2F, 0xFD])
+
+        // Single segment frames have no window descriptor, and a 1 byte content size when the flag is 0.
+        let contentSize: (flag: UInt8, value: UInt64, byteCount: Int)
+        switch payload.count {
+        case ..<256:
+            contentSize = (0, UInt64(payload.count), 1)
+        case ..<(0x1_0000 + 256):
+            contentSize = (1, UInt64(payload.count - 256), 2)
+        case ...Int(UInt32.max):
+            contentSize = (2, UInt64(payload.count), 4)
+        default:
+            contentSize = (3, UInt64(payload.count), 8)
+        }
+        frame.append(contentSize.flag << 6 | 0x20)
+        frame.append(contentsOf: (0..<contentSize.byteCount).map {
+            UInt8(truncatingIfNeeded: contentSize.value >> (8 * $0))
+        })
+
+        var offset = payload.startIndex
+        repeat {
+            let blockEnd = min(payload.endIndex, offset + Self.zstdMaximumBlockSize)
+            let isLastBlock = blockEnd == payload.endIndex
+            let blockHeader = UInt32(blockEnd - offset) << 3 | (isLastBlock ? 1 : 0)
+
+            frame.append(contentsOf: (0..<3).map { UInt8(truncatingIfNeeded: blockHeader >> (8 * $0)) })
+            frame.append(payload[offset..<blockEnd])
+            offset = blockEnd
+        } while offset < payload.endIndex
+
+        return frame
+    }
+
+}
@@ -0,0 +1,172 @@
+//
+//  RCContainerBuilderTests.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+final class RCContainerBuilderTests: TestCase {
+
+    func testBuildsContainerMatchingHandBuiltBytes() throws {
+        var builder = RCContainer.Builder(flags: 0x03)
+        try builder.append(RCContainerTestData.configJSON)
+        try builder.append(RCContainerTestData.smallBlob)
+        try builder.append(RCContainerTestData.largeBlob)
+
+        expect(builder.build()) == RCContainerTestData.container(
+            config: RCContainerTestData.configJSON,
+            contentElements: [RCContainerTestData.smallBlob, RCContainerTestData.largeBlob],
+            flags: 0x03
+        )
+    }
+
+    func testBuildsMixedEncodingsThatDecodeToTheirPayloads() throws {
+        let payloads: [(Data, RCContainer.Element.ContentEncoding)] = [
+            (RCContainerTestData.configJSON, .gzip),
+            (RCContainerTestData.smallBlob, .none),
+            (Data(), .gzip),
+            (RCContainerTestData.workflowBlob, .brotli),
+            (RCContainerTestData.summerWorkflowBlob, .zstd),
+            (Data(), .zstd),
+            (RCContainerTestData.largeBlob, .none)
+        ]
+
+        var builder = RCContainer.Builder()
+        for (payload, encoding) in payloads {
+            try builder.append(payload, encoding: encoding)
+        }
+        let data = builder.build()
+        let container = try RCContainer(data: data)
+
+        expect(data.count % 8) == 0
+        expect(container.elements.map(\.encoding)) == payloads.map { $0.1 }
+        expect(try container.elements.map(RCContainerTestData.decodedData(from:))) == payloads.map { $0.0 }
+        expect(container.elements.allSatisfy { $0.isChecksumValid() }) == true
+    }
+
+    func testRejectsEncodingsItCannotProduce() {
+        var builder = RCContainer.Builder()
+
+        expect(try builder.append("config".asData, encoding: .unsupported(0xff)))
+            .to(throwError(RCContainer.Parser.FormatError.unsupportedContentEncoding(0xff)))
+        expect(builder.build().count) == RCContainerTestData.headerSize
+    }
+
+    func testBuildsZstdFramesOfRawBlocksUpToTheMaximumBlockSize() throws {
+        let payload = Data((0..<300 * 1024).map { UInt8(truncatingIfNeeded: $0 &* 7) })
+
+        var builder = RCContainer.Builder()
+        try builder.append(payload, encoding: .zstd)
+        let element = try RCContainerTestData.firstElement(in: try RCContainer(data: builder.build()))
+
+        // Magic number, frame header descriptor, 4 byte content size and three block headers.
+        expect(element.size) == payload.count + 4 + 1 + 4 + 3 * 3
+        try element.withPayloadBytes { bytes in
+            expect(Array(bytes.prefix(5))) == [0x28, 0xB5, 0x2F, 0xFD, 0xA0]
+        }
+        expect(try RCContainerTestData.decodedData(from: element)) == payload
+        expect(element.isChecksumValid()) == true
+    }
+
+    func testHugeDeclaredElementSizeFailsWithoutReadingPastTheContainer() throws {
+        var builder = RCContainer.Builder()
+        try builder.append("config".asData)
+        var data = builder.build()
+        let sizeOffset = RCContainerTestData.headerSize + RCContainerTestData.checksumSize
+        data.replaceSubrange(sizeOffset..<sizeOffset + 4, with: [0xff, 0xff, 0xff, 0xff])
+
+        expect(try RCContainer(data: data)).to(throwError(RCContainer.Parser.FormatError.truncatedElement(index: 0)))
+    }
+
+    /// Feeds seeded mutations of valid containers to the parser and every decoder. Mutated input must
+    /// either parse or fail with a `FormatError`.
+    func testFuzzedContainersParseOrFailWithFormatErrors() throws {
+        var generator = SeededGenerator(seed: 0x5EED_2026)
+        let seeds = try (0..<8).map { _ in try Self.randomContainer(using: &generator) }
+
+        for iteration in 0..<Self.fuzzIterations {
+            let input = Self.mutate(seeds[iteration % seeds.count], using: &generator)
+
+            do {
+                let container = try RCContainer(data: input)
+                for element in container.elements {
+                    _ = element.isChecksumValid()
+                }
+            } catch {
+                expect(error).to(beAKindOf(RCContainer.Parser.FormatError.self),
+                                 description: "Fuzz iteration \(iteration)")
+            }
+        }
+    }
+
+}
+
+private extension RCContainerBuilderTests {
+
+    static let fuzzIterations = 2_000
+
+    static func randomContainer(using generator: inout SeededGenerator) throws -> Data {
+        let encodings: [RCContainer.Element.ContentEncoding] = [.none, .gzip, .brotli, .zstd]
+
+        var builder = RCContainer.Builder()
+        for _ in 0..<Int.random(in: 1...6, using: &generator) {
+            let length = Int.random(in: 0...512, using: &generator)
+            let alphabet = Int.random(in: 1...255, using: &generator)
+            let payload = Data((0..<length).map { _ in UInt8.random(in: 0...UInt8(alphabet), using: &generator) })
+            try builder.append(payload, encoding: encodings.randomElement(using: &generator)!)
+        }
+
+        return builder.build()
+    }
+
+    static func mutate(_ data: Data, using generator: inout SeededGenerator) -> Data {
+        var bytes = [UInt8](data)
+
+        for _ in 0..<Int.random(in: 1...4, using: &generator) {
+            guard !bytes.isEmpty else { break }
+
+            let offset = Int.random(in: 0..<bytes.count, using: &generator)
+            switch Int.random(in: 0..<5, using: &generator) {
+            case 0:
+                bytes[offset] ^= 1 << UInt8.random(in: 0..<8, using: &generator)
+            case 1:
+                bytes[offset] = UInt8.random(in: 0...255, using: &generator)
+            case 2:
+                bytes.removeSubrange(offset...)
+            case 3:
+                bytes.insert(contentsOf: (0..<Int.random(in: 1...16, using: &generator)).map { _ in
+                    UInt8.random(in: 0...255, using: &generator)
+                }, at: offset)
+            default:
+                bytes.removeSubrange(offset..<min(bytes.count, offset + Int.random(in: 1...16, using: &generator)))
+            }
+        }
+
+        return Data(bytes)
+    }
+
+}
+
+/// SplitMix64, so fuzz failures reproduce from the seed alone.
+private struct SeededGenerator: RandomNumberGenerator {
+
+    private var state: UInt64
+
+    init(seed: UInt64) {
+        self.state = seed
+    }
+
+    mutating func next() -> UInt64 {
+        self.state &+= 0x9E37_79B9_7F4A_7C15
+        var value = self.state
+        value = (value ^ (value >> 30)) &* 0xBF58_476D_1CE4_E5B9
+        value = (value ^ (value >> 27)) &* 0x94D0_49BB_1331_11EB
+        return value ^ (value >> 31)
+    }
+
+}
@@ -0,0 +1,62 @@
+//
+//  RCContainerChecksumKeyTests.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+final class RCContainerChecksumKeyTests: TestCase {
+
+    func testBase64URLEncodingMatchesFoundationForAllTailLengths() {
+        for length in 0...64 {
+            let bytes = Data((0..<length).map { UInt8(truncatingIfNeeded: $0 &* 37 &+ 251) })
+            let expected = bytes.base64EncodedString()
+                .replacingOccurrences(of: "+", with: "-")
+                .replacingOccurrences(of: "/", with: "_")
+                .replacingOccurrences(of: "=", with: "")
+
+            expect(bytes.withUnsafeBytes(RCContainer.Base64URL.encode)) == expected
+        }
+    }
+
+    func testKeyRoundTripsThroughRef() throws {
+        let ref = RCContainerTestData.blobRef(for: RCContainerTestData.workflowBlob)
+        let key = try XCTUnwrap(RCContainer.ChecksumKey(ref: ref))
+
+        expect(key.ref) == ref
+        expect(key.withUnsafeBytes { Array($0) }) == RCContainerTestData.checksum(for: RCContainerTestData.workflowBlob)
+        expect(RCContainer.ChecksumKey(ref: ref)?.hashValue) == key.hashValue
+    }
+
+    func testRejectsInvalidRefs() {
+        let ref = RCContainerTestData.blobRef(for: RCContainerTestData.workflowBlob)
+
+        expect(RCContainer.ChecksumKey(ref: "")).to(beNil())
+        expect(RCContainer.ChecksumKey(ref: String(ref.dropLast()))).to(beNil())
+        expect(RCContainer.ChecksumKey(ref: ref + "A")).to(beNil())
+        expect(RCContainer.ChecksumKey(ref: "+" + ref.dropFirst())).to(beNil())
+        expect(RCContainer.ChecksumKey(ref: "é" + ref.dropFirst(2))).to(beNil())
+    }
+
+    func testLooksUpElementsByRef() throws {
+        let container = try RCContainer(data: RCContainerTestData.container(
+            config: RCContainerTestData.configJSON,
+            contentElements: [RCContainerTestData.workflowBlob, RCContainerTestData.smallBlob]
+        ))
+        let ref = RCContainerTestData.blobRef(for: RCContainerTestData.smallBlob)
+
+        let element = try XCTUnwrap(container.element(withChecksum: ref))
+
+        expect(element.checksum) == ref
+        expect(RCContainerTestData.data(from: element)) == RCContainerTestData.smallBlob
+        expect(container.element(withChecksum: RCContainerTestData.blobRef(for: "missing".asData))).to(beNil())
+        expect(container.element(withChecksum: "not a ref")).to(beNil())
+        expect(Set(container.elementsByChecksum.keys)) == Set(container.elements.map(\.checksum))
+    }
+
+}
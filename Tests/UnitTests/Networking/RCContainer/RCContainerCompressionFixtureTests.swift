@@ -92,6 +92,72 @@ final class RCContainerCompressionFixtureTests: TestCase {
         }
     }
 
+    func testZstdConfigFixtureParsesAndDecodes() throws {
+        let container = try Self.parseFixture("v1_zstd_config")
+        let configElement = try RCContainerTestData.firstElement(in: container)
+
+        expect(configElement.encoding) == .zstd
+        expect(RCContainerTestData.data(from: configElement)) != RCContainerTestData.configJSON
+        expect(try RCContainerTestData.decodedData(from: configElement)) == RCContainerTestData.configJSON
+        expect(configElement.isChecksumValid()) == true
+        expect(RCContainerTestData.contentElements(in: container)).to(beEmpty())
+    }
+
+    func testZstdContentFixtureParsesAndDecodes() throws {
+        let container = try Self.parseFixture("v1_zstd_content")
+        let contentElement = try XCTUnwrap(
+            container.elementsByChecksum[RCContainerTestData.blobRef(for: RCContainerTestData.workflowBlob)]
+        )
+
+        expect(contentElement.encoding) == .zstd
+        expect(RCContainerTestData.data(from: contentElement)) != RCContainerTestData.workflowBlob
+        expect(try RCContainerTestData.decodedData(from: contentElement)) == RCContainerTestData.workflowBlob
+        expect(contentElement.isChecksumValid()) == true
+    }
+
+    func testZstdMultiBlockContentFixtureParsesAndDecodes() throws {
+        let expected = (0..<4000)
+            .map { "{\"product\":\"com.revenuecat.item_\($0 % 97)\",\"price\":\($0 % 7).99}" }
+            .joined(separator: ",")
+            .asData
+        let container = try Self.parseFixture("v1_zstd_large_content")
+        let contentElement = try XCTUnwrap(container.elementsByChecksum[RCContainerTestData.blobRef(for: expected)])
+
+        expect(contentElement.encoding) == .zstd
+        expect(contentElement.size) < expected.count / 100
+        expect(try RCContainerTestData.decodedData(from: contentElement)) == expected
+        expect(contentElement.isChecksumValid()) == true
+    }
+
+    func testZstdDictionaryFixtureDecodesElementsWithSharedDictionary() throws {
+        let container = try Self.parseFixture("v1_zstd_dictionary")
+        let expectedContent = [RCContainerTestData.workflowBlob, RCContainerTestData.summerWorkflowBlob]
+
+        expect(container.elements.map(\.encoding)) == [.none, .none, .zstd, .zstd]
+
+        for payload in expectedContent {
+            let element = try XCTUnwrap(container.elementsByChecksum[RCContainerTestData.blobRef(for: payload)])
+            expect(element.size) < payload.count / 2
+            expect(try RCContainerTestData.decodedData(from: element)) == payload
+            expect(element.isChecksumValid()) == true
+        }
+    }
+
+    func testZstdDictionaryFixtureFailsWithoutDictionaryElement() throws {
+        let fixture = try Self.parseFixture("v1_zstd_dictionary")
+        let container = RCContainer(
+            flags: fixture.flags,
+            elements: fixture.elements.filter { $0.checksum != fixture.elements[1].checksum }
+        )
+        let element = try XCTUnwrap(
+            container.elementsByChecksum[RCContainerTestData.blobRef(for: RCContainerTestData.workflowBlob)]
+        )
+
+        expect(element.isChecksumValid()) == false
+        expect(try RCContainerTestData.decodedData(from: element))
+            .to(throwError(RCContainer.Parser.FormatError.missingContentDictionary(1234)))
+    }
+
 }
 
 private extension RCContainerCompressionFixtureTests {
@@ -101,6 +167,14 @@ private extension RCContainerCompressionFixtureTests {
         file: StaticString = #filePath,
         line: UInt = #line
     ) throws -> RCContainer {
+        return try RCContainer(data: Self.fixtureData(fileName, file: file, line: line))
+    }
+
+    static func fixtureData(
+        _ fileName: String,
+        file: StaticString = #filePath,
+        line: UInt = #line
+    ) throws -> Data {
         let url = try XCTUnwrap(
             Bundle(for: Self.self).url(
                 forResource: fileName,
@@ -111,7 +185,7 @@ private extension RCContainerCompressionFixtureTests {
             file: file,
             line: line
         )
-        return try RCContainer(data: Data(contentsOf: url))
+        return try Data(contentsOf: url)
     }
 
     static func skipIfBrotliIsUnsupported() throws {
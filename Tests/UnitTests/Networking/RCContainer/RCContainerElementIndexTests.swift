@@ -0,0 +1,137 @@
+//
+//  RCContainerElementIndexTests.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+final class RCContainerElementIndexTests: TestCase {
+
+    private var directory: URL!
+
+    override func setUpWithError() throws {
+        try super.setUpWithError()
+
+        self.directory = FileManager.default.temporaryDirectory
+            .appendingPathComponent("RCContainerElementIndexTests-\(UUID().uuidString)", isDirectory: true)
+        try FileManager.default.createDirectory(at: self.directory, withIntermediateDirectories: true)
+    }
+
+    override func tearDownWithError() throws {
+        try? FileManager.default.removeItem(at: self.directory)
+
+        try super.tearDownWithError()
+    }
+
+    func testSerializedIndexRoundTrips() throws {
+        let data = try Self.containerData()
+        let index = RCContainer.ElementIndex(
+            container: try RCContainer(data: data),
+            containerSize: data.count,
+            containerModificationDate: Date(timeIntervalSinceReferenceDate: 123.456)
+        )
+
+        expect(RCContainer.ElementIndex(serialized: index.serialized())) == index
+        expect(index.entries.map(\.encoding)) == [.gzip, .none, .brotli, .none]
+    }
+
+    func testRejectsCorruptedOrTruncatedSerializedIndex() throws {
+        let data = try Self.containerData()
+        let serialized = RCContainer.ElementIndex(
+            container: try RCContainer(data: data),
+            containerSize: data.count,
+            containerModificationDate: Date()
+        ).serialized()
+
+        var corrupted = serialized
+        corrupted[corrupted.startIndex + 40] ^= 0xff
+
+        expect(RCContainer.ElementIndex(serialized: corrupted)).to(beNil())
+        expect(RCContainer.ElementIndex(serialized: serialized.dropLast())).to(beNil())
+        expect(RCContainer.ElementIndex(serialized: Data())).to(beNil())
+    }
+
+    func testPersistWritesIndexThatReopensToTheParsedContainer() throws {
+        let data = try Self.containerData()
+        let url = self.directory.appendingPathComponent("container.bin")
+
+        let persisted = try RCContainer.persist(data, to: url)
+        let index = try XCTUnwrap(RCContainer.validElementIndex(forContainerAt: url))
+        let reopened = try RCContainer(contentsOf: url)
+
+        expect(index.entries.count) == persisted.elements.count
+        expect(reopened.flags) == persisted.flags
+        expect(reopened.elements.map(\.checksum)) == persisted.elements.map(\.checksum)
+        expect(reopened.elements.map(\.encoding)) == persisted.elements.map(\.encoding)
+        expect(try reopened.elements.map(RCContainerTestData.decodedData(from:)))
+            == [RCContainerTestData.configJSON, RCContainerTestData.smallBlob,
+                RCContainerTestData.largeBlob, RCContainerTestData.workflowBlob]
+        expect(reopened.elements.allSatisfy { $0.isChecksumValid() }) == true
+    }
+
+    func testReopeningIgnoresIndexOfReplacedContainer() throws {
+        let url = self.directory.appendingPathComponent("container.bin")
+        try RCContainer.persist(try Self.containerData(), to: url)
+
+        let replacement = RCContainerTestData.container(
+            config: "config".asData,
+            contentElements: [RCContainerTestData.summerWorkflowBlob]
+        )
+        try replacement.write(to: url, options: .atomic)
+
+        self.logger.clearMessages()
+
+        let reopened = try RCContainer(contentsOf: url)
+
+        expect(RCContainer.validElementIndex(forContainerAt: url)).to(beNil())
+        expect(reopened.elements.map(RCContainerTestData.data(from:)))
+            == ["config".asData, RCContainerTestData.summerWorkflowBlob]
+        self.logger.verifyMessageWasLogged(
+            "RC Container index 'container.bin.index' does not match its container; parsing instead.",
+            level: .debug
+        )
+    }
+
+    func testIndexWithOutOfBoundsEntriesIsNotUsed() throws {
+        let data = try Self.containerData()
+        let index = RCContainer.ElementIndex(
+            container: try RCContainer(data: data),
+            containerSize: data.count,
+            containerModificationDate: Date()
+        )
+        let outOfBounds = RCContainer.ElementIndex(
+            flags: index.flags,
+            containerSize: index.containerSize,
+            containerModificationDate: index.containerModificationDate,
+            entries: index.entries + [
+                .init(checksum: index.entries[0].checksum, payloadOffset: data.count - 4, size: 8, encoding: .none)
+            ]
+        )
+
+        expect(RCContainer(data: data, index: index)).toNot(beNil())
+        expect(RCContainer(data: data, index: outOfBounds)).to(beNil())
+        expect(RCContainer(data: data.dropLast(), index: index)).to(beNil())
+    }
+
+}
+
+private extension RCContainerElementIndexTests {
+
+    static func containerData() throws -> Data {
+        return try RCContainerTestData.compressedContainer(
+            config: RCContainerTestData.configJSON,
+            configEncoding: .gzip,
+            contentElements: [
+                (RCContainerTestData.smallBlob, .none),
+                (RCContainerTestData.largeBlob, .brotli),
+                (RCContainerTestData.workflowBlob, .none)
+            ]
+        )
+    }
+
+}
@@ -379,11 +379,11 @@ private extension Data {
 
 }
 
-private extension RCContainerTestData {
+extension RCContainerTestData {
 
-    static let outputChunkSize = 64 * 1024
+    fileprivate static let outputChunkSize = 64 * 1024
 
-    static func wirePayload(
+    fileprivate static func wirePayload(
         for payload: Data,
         encoding: RCContainer.Element.ContentEncoding
     ) throws -> Data {
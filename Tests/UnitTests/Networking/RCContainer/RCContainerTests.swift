@@ -242,7 +242,7 @@ final class RCContainerTests: TestCase {
         Self.expectDecoding(element, throws: .unsupportedContentEncoding(0xff))
     }
 
-    func testZstdContentEncodingParsesButFailsDecodeAndChecksumValidation() throws {
+    func testZstdContentEncodingParsesButFailsDecodeAndChecksumValidationForMalformedFrames() throws {
         var data = RCContainerTestData.container(config: "config".asData)
         data[data.index(data.startIndex, offsetBy: RCContainerTestData.firstElementEncodingOffset)] =
             RCContainer.Element.ContentEncoding.zstd.rawValue
@@ -253,7 +253,7 @@ final class RCContainerTests: TestCase {
         expect(element.isChecksumValid()) == false
         Self.expectDecoding(
             element,
-            throws: .unsupportedContentEncoding(RCContainer.Element.ContentEncoding.zstd.rawValue)
+            throws: .contentDecompressionFailed(RCContainer.Element.ContentEncoding.zstd.rawValue)
         )
     }
 
@@ -268,20 +268,22 @@ final class RCContainerTests: TestCase {
     func testContentEncodingSupport() {
         expect(RCContainer.Element.ContentEncoding.none.isSupported) == true
         expect(RCContainer.Element.ContentEncoding.gzip.isSupported) == true
-        expect(RCContainer.Element.ContentEncoding.zstd.isSupported) == false
+        expect(RCContainer.Element.ContentEncoding.zstd.isSupported) == true
         expect(RCContainer.Element.ContentEncoding.unsupported(0xff).isSupported) == false
     }
 
     func testSupportedRequestEncodings() {
         if RCContainer.Element.ContentEncoding.brotli.isSupported {
-            expect(RCContainer.Element.ContentEncoding.supportedEncodingsInPriorityOrder) == [.brotli, .gzip, .none]
+            expect(RCContainer.Element.ContentEncoding.supportedEncodingsInPriorityOrder)
+                == [.brotli, .zstd, .gzip, .none]
             expect(RCContainer.Element.ContentEncoding.supportedRequestElementEncodingsInPriorityOrder)
-                == [.brotli, .gzip]
-            expect(RCContainer.Element.ContentEncoding.requestElementEncodingHeaderValue) == "br, gzip"
+                == [.brotli, .zstd, .gzip]
+            expect(RCContainer.Element.ContentEncoding.requestElementEncodingHeaderValue) == "br, zstd, gzip"
         } else {
-            expect(RCContainer.Element.ContentEncoding.supportedEncodingsInPriorityOrder) == [.gzip, .none]
-            expect(RCContainer.Element.ContentEncoding.supportedRequestElementEncodingsInPriorityOrder) == [.gzip]
-            expect(RCContainer.Element.ContentEncoding.requestElementEncodingHeaderValue) == "gzip"
+            expect(RCContainer.Element.ContentEncoding.supportedEncodingsInPriorityOrder) == [.zstd, .gzip, .none]
+            expect(RCContainer.Element.ContentEncoding.supportedRequestElementEncodingsInPriorityOrder)
+                == [.zstd, .gzip]
+            expect(RCContainer.Element.ContentEncoding.requestElementEncodingHeaderValue) == "zstd, gzip"
         }
     }
 
@@ -378,6 +380,34 @@ final class RCContainerTests: TestCase {
         expect(element.isChecksumValid()) == true
     }
 
+    func testStreamsDecodedPayloadChunksNoLargerThanOutputChunkSize() throws {
+        let payload = Data((0..<300_000).map { UInt8(truncatingIfNeeded: $0 * 31 / 7) })
+        var encodings: [RCContainer.Element.ContentEncoding] = [.none, .gzip]
+        if RCContainer.Element.ContentEncoding.brotli.isSupported {
+            encodings.append(.brotli)
+        }
+
+        for encoding in encodings {
+            let element = try RCContainerTestData.firstElement(in: try RCContainer(
+                data: RCContainerTestData.compressedContainer(config: payload, configEncoding: encoding)
+            ))
+
+            var chunkSizes: [Int] = []
+            var streamed = Data()
+            try element.forEachDecodedPayloadChunk { chunk in
+                chunkSizes.append(chunk.count)
+                streamed.append(contentsOf: chunk)
+            }
+
+            expect(streamed) == payload
+            if encoding != .none {
+                expect(chunkSizes.count) > 1
+                expect(chunkSizes.allSatisfy { $0 <= 64 * 1024 }) == true
+            }
+            expect(element.isChecksumValid()) == true
+        }
+    }
+
     func testUsesWireSizeForCompressedElementPaddingAndOffsets() throws {
         let config = Data(repeating: UInt8(ascii: "a"), count: 2048)
         let content = "content after compressed config".asData
@@ -478,12 +508,59 @@ final class RCContainerTests: TestCase {
         }
     }
 
+    func testMemoryMappedAndCopiedBackingsParsePersistedContainerIdentically() throws {
+        let contentElements = [
+            Data(repeating: 0xab, count: RCContainer.Backing.minimumMappedFileSize),
+            "blob".asData
+        ]
+        let url = try Self.writeTemporaryContainer(
+            RCContainerTestData.container(config: "config".asData, contentElements: contentElements)
+        )
+        defer { try? FileManager.default.removeItem(at: url) }
+
+        let mapped = try RCContainer(contentsOf: url, backing: .memoryMapped)
+        let copied = try RCContainer(contentsOf: url, backing: .copied)
+
+        expect(mapped.elements.map(\.checksum)) == copied.elements.map(\.checksum)
+        expect(mapped.elements.map(RCContainerTestData.data(from:))) == ["config".asData] + contentElements
+        expect(mapped.elements.allSatisfy { $0.isChecksumValid() }) == true
+    }
+
+    func testMemoryMappedBackingOnlyMapsFilesAboveMinimumSize() throws {
+        let smallURL = try Self.writeTemporaryContainer(RCContainerTestData.container(config: "config".asData))
+        let largeURL = try Self.writeTemporaryContainer(RCContainerTestData.container(
+            config: Data(repeating: 0xab, count: RCContainer.Backing.minimumMappedFileSize)
+        ))
+        defer {
+            try? FileManager.default.removeItem(at: smallURL)
+            try? FileManager.default.removeItem(at: largeURL)
+        }
+
+        expect(RCContainer.Backing.memoryMapped.readingOptions(for: smallURL)) == []
+        expect(RCContainer.Backing.memoryMapped.readingOptions(for: largeURL)) == .mappedIfSafe
+        expect(RCContainer.Backing.copied.readingOptions(for: largeURL)) == []
+    }
+
+    func testOpeningMissingPersistedContainerThrows() {
+        let url = FileManager.default.temporaryDirectory
+            .appendingPathComponent("RCContainerTests-\(UUID().uuidString).bin")
+
+        expect(try RCContainer(contentsOf: url)).to(throwError())
+    }
+
 }
 
 // MARK: - Helpers
 
 private extension RCContainerTests {
 
+    static func writeTemporaryContainer(_ data: Data) throws -> URL {
+        let url = FileManager.default.temporaryDirectory
+            .appendingPathComponent("RCContainerTests-\(UUID().uuidString).bin")
+        try data.write(to: url, options: .atomic)
+        return url
+    }
+
     static func expectParsing(
         _ data: Data,
         throws expectedError: RCContainer.Parser.FormatError,
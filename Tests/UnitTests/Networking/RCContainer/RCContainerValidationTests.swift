@@ -0,0 +1,84 @@
+//
+//  RCContainerValidationTests.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+final class RCContainerValidationTests: TestCase {
+
+    func testValidatesEveryElementInOrder() async throws {
+        let container = try RCContainer(data: try RCContainerTestData.compressedContainer(
+            config: RCContainerTestData.configJSON,
+            configEncoding: .gzip,
+            contentElements: [
+                (RCContainerTestData.smallBlob, .none),
+                (RCContainerTestData.workflowBlob, .gzip),
+                (RCContainerTestData.largeBlob, .brotli),
+                (RCContainerTestData.summerWorkflowBlob, .gzip)
+            ]
+        ))
+
+        let results = await container.validateAll(concurrency: 2)
+
+        expect(results.map(\.index)) == Array(0..<5)
+        expect(results.map(\.checksum)) == container.elements.map(\.checksum)
+        expect(results.allSatisfy(\.isValid)) == true
+    }
+
+    func testReportsChecksumMismatchesPerElement() async throws {
+        let container = try RCContainer(data: RCContainerTestData.container(
+            config: RCContainerTestData.configJSON,
+            contentElements: [RCContainerTestData.workflowBlob, RCContainerTestData.smallBlob],
+            checksumOverride: { index, payload in
+                RCContainerTestData.checksum(for: index == 1 ? "other".asData : payload)
+            }
+        ))
+
+        let results = await container.validateAll(concurrency: 3)
+
+        expect(results.map(\.isValid)) == [true, false, true]
+        expect(results[1].error) == .checksumMismatch(
+            expected: RCContainerTestData.blobRef(for: "other".asData),
+            actual: RCContainerTestData.blobRef(for: RCContainerTestData.workflowBlob)
+        )
+    }
+
+    func testReportsUndecodablePayloadsPerElement() async throws {
+        var data = RCContainerTestData.container(
+            config: RCContainerTestData.configJSON,
+            contentElements: [RCContainerTestData.workflowBlob]
+        )
+        data[data.index(data.startIndex, offsetBy: RCContainerTestData.firstElementEncodingOffset)] =
+            RCContainer.Element.ContentEncoding.gzip.rawValue
+
+        let results = try await RCContainer(data: data).validateAll()
+
+        expect(results.map(\.isValid)) == [false, true]
+        expect(results[0].error) == .contentDecompressionFailed(RCContainer.Element.ContentEncoding.gzip.rawValue)
+    }
+
+    func testResultsDoNotDependOnConcurrency() async throws {
+        let container = try RCContainer(data: RCContainerTestData.container(
+            config: RCContainerTestData.configJSON,
+            contentElements: (0..<20).map { "element \($0)".asData },
+            checksumOverride: { index, payload in
+                RCContainerTestData.checksum(for: index.isMultiple(of: 3) ? Data() : payload)
+            }
+        ))
+
+        let serialResults = await container.validateAll(concurrency: 1)
+        let clampedResults = await container.validateAll(concurrency: 0)
+        let parallelResults = await container.validateAll(concurrency: 8)
+
+        expect(serialResults.count) == 21
+        expect(clampedResults) == serialResults
+        expect(parallelResults) == serialResults
+    }
+
+}
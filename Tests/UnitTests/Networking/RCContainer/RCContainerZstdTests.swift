@@ -0,0 +1,172 @@
+//
+//  RCContainerZstdTests.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+final class RCContainerZstdTests: TestCase {
+
+    func testDecodesRawAndRLEBlocks() throws {
+        let frame = Self.frameHeader(contentSize: 8)
+            + Self.rawBlock("hello".asData)
+            + Self.rleBlock(UInt8(ascii: "!"), count: 3, isLast: true)
+
+        expect(try Self.decompress(frame)) == "hello!!!".asData
+    }
+
+    func testConcatenatesFramesAndSkipsSkippableFrames() throws {
+        let skippableFrame = Data([0x5A, 0x2A, 0x4D, 0x18, 3, 0, 0, 0, 1, 2, 3])
+        let data = Self.frameHeader(contentSize: 2) + Self.rawBlock("ab".asData, isLast: true)
+            + skippableFrame
+            + Self.frameHeader(contentSize: nil) + Self.rawBlock("cd".asData, isLast: true)
+
+        expect(try Self.decompress(data)) == "abcd".asData
+    }
+
+    func testRejectsMalformedFrames() {
+        let valid = Self.frameHeader(contentSize: 5) + Self.rawBlock("hello".asData, isLast: true)
+        var invalidMagic = valid
+        invalidMagic[invalidMagic.startIndex] = 0
+        var reservedBlockType = valid
+        reservedBlockType[reservedBlockType.startIndex + 6] |= 0b110
+
+        let malformedFrames = [
+            valid.prefix(valid.count - 1),
+            invalidMagic,
+            reservedBlockType,
+            Self.frameHeader(contentSize: 4) + Self.rawBlock("hello".asData, isLast: true),
+            Self.frameHeader(contentSize: 4) + Self.rleBlock(0, count: 100_000, isLast: true)
+        ]
+
+        for frame in malformedFrames {
+            expect(try Self.decompress(frame)).to(throwError(
+                RCContainer.Parser.FormatError.contentDecompressionFailed(
+                    RCContainer.Element.ContentEncoding.zstd.rawValue
+                )
+            ))
+        }
+    }
+
+    func testRejectsBlocksDecodingToMoreThanMaximumBlockSize() throws {
+        let maximumBlockSize = 128 * 1024
+        let frame = Self.frameHeader(contentSize: nil)
+            + Self.rleBlock(UInt8(ascii: "a"), count: maximumBlockSize)
+            + Self.rleBlock(UInt8(ascii: "b"), count: maximumBlockSize + 1, isLast: true)
+
+        expect(try Self.decompress(frame)).to(throwError(
+            RCContainer.Parser.FormatError.contentDecompressionFailed(
+                RCContainer.Element.ContentEncoding.zstd.rawValue
+            )
+        ))
+    }
+
+    func testRejectsFramesReferencingUnknownDictionary() {
+        let frame = Self.frameHeader(contentSize: 2, dictionaryID: 7) + Self.rawBlock("ab".asData, isLast: true)
+
+        expect(try Self.decompress(frame))
+            .to(throwError(RCContainer.Parser.FormatError.missingContentDictionary(7)))
+    }
+
+    func testIgnoresAndWarnsAboutMalformedDictionaryElements() throws {
+        let decoded = "hello".asData
+        let frame = Self.frameHeader(contentSize: 5) + Self.rawBlock(decoded, isLast: true)
+        let malformedDictionary = Data([0x37, 0xA4, 0x30, 0xEC, 1, 0, 0, 0, 0xFF])
+
+        var data = RCContainerTestData.container(
+            config: frame,
+            contentElements: [malformedDictionary],
+            checksumOverride: { index, payload in
+                RCContainerTestData.checksum(for: index == 0 ? decoded : payload)
+            }
+        )
+        data[data.index(data.startIndex, offsetBy: RCContainerTestData.firstElementEncodingOffset)] =
+            RCContainer.Element.ContentEncoding.zstd.rawValue
+
+        self.logger.clearMessages()
+
+        let element = try RCContainerTestData.firstElement(in: try RCContainer(data: data))
+
+        expect(try RCContainerTestData.decodedData(from: element)) == decoded
+        expect(element.isChecksumValid()) == true
+        self.logger.verifyMessageWasLogged(
+            "RC element '\(RCContainerTestData.blobRef(for: malformedDictionary))' has the zstd dictionary " +
+            "magic but could not be parsed; ignoring it.",
+            level: .warn
+        )
+    }
+
+    func testDictionariesAreOnlyParsedWhenAZstdElementIsDecoded() throws {
+        let decoded = "hello".asData
+        let frame = Self.frameHeader(contentSize: 5) + Self.rawBlock(decoded, isLast: true)
+        let malformedDictionary = Data([0x37, 0xA4, 0x30, 0xEC, 1, 0, 0, 0, 0xFF])
+        let warning = "RC element '\(RCContainerTestData.blobRef(for: malformedDictionary))' has the zstd " +
+            "dictionary magic but could not be parsed; ignoring it."
+
+        var data = RCContainerTestData.container(
+            config: frame,
+            contentElements: [malformedDictionary],
+            checksumOverride: { index, payload in
+                RCContainerTestData.checksum(for: index == 0 ? decoded : payload)
+            }
+        )
+        data[data.index(data.startIndex, offsetBy: RCContainerTestData.firstElementEncodingOffset)] =
+            RCContainer.Element.ContentEncoding.zstd.rawValue
+
+        self.logger.clearMessages()
+
+        let element = try RCContainerTestData.firstElement(in: try RCContainer(data: data))
+        self.logger.verifyMessageWasNotLogged(warning, allowNoMessages: true)
+
+        expect(try RCContainerTestData.decodedData(from: element)) == decoded
+        self.logger.verifyMessageWasLogged(warning, level: .warn, expectedCount: 1)
+
+        expect(try RCContainerTestData.decodedData(from: element)) == decoded
+        self.logger.verifyMessageWasLogged(warning, level: .warn, expectedCount: 1)
+    }
+
+}
+
+private extension RCContainerZstdTests {
+
+    static func decompress(_ data: Data) throws -> Data {
+        return try data.withUnsafeBytes { bytes in
+            Data(try RCContainer.ZstdDecoder.decompress(bytes, dictionaries: [:]))
+        }
+    }
+
+    /// A frame header with an optional 1-byte single-segment content size and 1-byte dictionary ID.
+    static func frameHeader(contentSize: UInt8?, dictionaryID: UInt8? = nil) -> Data {
+        var header = Data([0x28, 0xB5, 0x2F, 0xFD])
+        if let contentSize = contentSize {
+            header.append(dictionaryID == nil ? 0x20 : 0x21)
+            header.append(contentsOf: dictionaryID.map { [$0] } ?? [])
+            header.append(contentSize)
+        } else {
+            // Without a single-segment content size, the header carries a window descriptor instead.
+            header.append(dictionaryID == nil ? 0x00 : 0x01)
+            header.append(0x00)
+            header.append(contentsOf: dictionaryID.map { [$0] } ?? [])
+        }
+        return header
+    }
+
+    static func rawBlock(_ content: Data, isLast: Bool = false) -> Data {
+        return Self.blockHeader(type: 0, size: content.count, isLast: isLast) + content
+    }
+
+    static func rleBlock(_ byte: UInt8, count: Int, isLast: Bool = false) -> Data {
+        return Self.blockHeader(type: 1, size: count, isLast: isLast) + Data([byte])
+    }
+
+    static func blockHeader(type: UInt32, size: Int, isLast: Bool) -> Data {
+        let value = UInt32(size) << 3 | type << 1 | (isLast ? 1 : 0)
+        return Data([UInt8(value & 0xFF), UInt8((value >> 8) & 0xFF), UInt8((value >> 16) & 0xFF)])
+    }
+
+}
@@ -0,0 +1,105 @@
+//
+//  RemoteConfigBlobConcurrencyLimiterTests.swift
+//  UnitTests
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+final class RemoteConfigBlobConcurrencyLimiterTests: TestCase {
+
+    func testStartsAtInitialLimitClampedToBounds() {
+        expect(RemoteConfigBlobConcurrencyLimiter().limit) == RemoteConfigBlobConcurrencyLimiter.defaultInitialLimit
+        expect(RemoteConfigBlobConcurrencyLimiter(initialLimit: 0).limit) == 1
+        expect(RemoteConfigBlobConcurrencyLimiter(initialLimit: 40, maximumLimit: 8).limit) == 8
+    }
+
+    func testSuccessesWithQueuedWorkGrowLimitByAboutOnePerRound() {
+        var limiter = RemoteConfigBlobConcurrencyLimiter(initialLimit: 4)
+
+        for _ in 0..<4 {
+            limiter.record(Self.fastSuccess, startedInGeneration: limiter.generation, hadQueuedWork: true)
+        }
+        expect(limiter.limit) == 4
+
+        limiter.record(Self.fastSuccess, startedInGeneration: limiter.generation, hadQueuedWork: true)
+        expect(limiter.limit) == 5
+    }
+
+    func testSuccessesWithoutQueuedWorkKeepLimit() {
+        var limiter = RemoteConfigBlobConcurrencyLimiter(initialLimit: 4)
+
+        for _ in 0..<20 {
+            limiter.record(Self.fastSuccess, startedInGeneration: limiter.generation, hadQueuedWork: false)
+        }
+
+        expect(limiter.limit) == 4
+    }
+
+    func testLimitDoesNotGrowPastMaximum() {
+        var limiter = RemoteConfigBlobConcurrencyLimiter(initialLimit: 2, maximumLimit: 3)
+
+        for _ in 0..<50 {
+            limiter.record(Self.fastSuccess, startedInGeneration: limiter.generation, hadQueuedWork: true)
+        }
+
+        expect(limiter.limit) == 3
+    }
+
+    func testCongestionHalvesLimitOncePerGeneration() {
+        var limiter = RemoteConfigBlobConcurrencyLimiter(initialLimit: 8)
+        let generation = limiter.generation
+
+        expect(limiter.record(.congestion, startedInGeneration: generation, hadQueuedWork: true)) == true
+        expect(limiter.record(.congestion, startedInGeneration: generation, hadQueuedWork: true)) == false
+        expect(limiter.limit) == 4
+
+        limiter.record(.congestion, startedInGeneration: limiter.generation, hadQueuedWork: true)
+        expect(limiter.limit) == 2
+    }
+
+    func testCongestionDoesNotDropBelowMinimum() {
+        var limiter = RemoteConfigBlobConcurrencyLimiter(initialLimit: 2, minimumLimit: 2)
+
+        limiter.record(.congestion, startedInGeneration: limiter.generation, hadQueuedWork: true)
+
+        expect(limiter.limit) == 2
+    }
+
+    func testIgnoredFailuresKeepLimit() {
+        var limiter = RemoteConfigBlobConcurrencyLimiter(initialLimit: 4)
+
+        expect(limiter.record(.ignored, startedInGeneration: limiter.generation, hadQueuedWork: true)) == false
+        expect(limiter.limit) == 4
+    }
+
+    func testRisingLatencyHalvesLimit() {
+        var limiter = RemoteConfigBlobConcurrencyLimiter(initialLimit: 8)
+        limiter.record(.success(latency: 0.2, byteCount: 1024), startedInGeneration: 0, hadQueuedWork: false)
+
+        limiter.record(.success(latency: 1, byteCount: 1024), startedInGeneration: 0, hadQueuedWork: true)
+
+        expect(limiter.limit) == 4
+    }
+
+    func testLargeBlobLatencyIsNormalizedBySize() {
+        var limiter = RemoteConfigBlobConcurrencyLimiter(initialLimit: 8)
+        limiter.record(.success(latency: 0.2, byteCount: 1024), startedInGeneration: 0, hadQueuedWork: false)
+
+        let byteCount = 10 * RemoteConfigBlobConcurrencyLimiter.latencyUnitByteCount
+        limiter.record(.success(latency: 2, byteCount: byteCount), startedInGeneration: 0, hadQueuedWork: false)
+
+        expect(limiter.limit) == 8
+    }
+
+}
+
+private extension RemoteConfigBlobConcurrencyLimiterTests {
+
+    static let fastSuccess = RemoteConfigBlobConcurrencyLimiter.Outcome.success(latency: 0.01, byteCount: 1024)
+
+}
@@ -14,6 +14,7 @@ final class RemoteConfigBlobDownloaderTests: TestCase {
 
     override func tearDown() {
         MockRemoteConfigBlobURLProtocol.handler = nil
+        MockRemoteConfigBlobURLProtocol.failureAfterBody = nil
 
         super.tearDown()
     }
@@ -284,10 +285,143 @@ final class RemoteConfigBlobDownloaderTests: TestCase {
         expect(captured) == HTTPRequestTimeoutManager.Timeout.mainSourceNoFallbackReduced
     }
 
+    // MARK: - Resumed downloads
+
+    func testResumedDownloadRequestsRemainingBytesAndPrependsPrefix() async throws {
+        try AvailabilityChecks.iOS15APIAvailableOrSkipTest()
+
+        let url = try XCTUnwrap(URL(string: "https://blob.example.com/blob"))
+        let blob = "resumable blob payload".asData
+        var capturedRange: String?
+        MockRemoteConfigBlobURLProtocol.handler = { request in
+            capturedRange = request.value(forHTTPHeaderField: "Range")
+            return (
+                try Self.response(url: try XCTUnwrap(request.url), statusCode: 206, headers: [
+                    "Content-Range": "bytes 8-\(blob.count - 1)/\(blob.count)"
+                ]),
+                blob.dropFirst(8)
+            )
+        }
+
+        let data = try await self.downloader().data(from: url, resuming: Self.partial(blob.prefix(8)))
+
+        expect(capturedRange) == "bytes=8-"
+        expect(data) == blob
+    }
+
+    func testResumedDownloadUsesWholeBodyWhenSourceIgnoresRange() async throws {
+        try AvailabilityChecks.iOS15APIAvailableOrSkipTest()
+
+        let url = try XCTUnwrap(URL(string: "https://blob.example.com/blob"))
+        let blob = "resumable blob payload".asData
+        MockRemoteConfigBlobURLProtocol.handler = { request in
+            return (try Self.response(url: try XCTUnwrap(request.url), statusCode: 200), blob)
+        }
+
+        let data = try await self.downloader().data(from: url, resuming: Self.partial(blob.prefix(8)))
+
+        expect(data) == blob
+    }
+
+    func testResumedDownloadRejectsPartialContentAtWrongOffset() async throws {
+        try AvailabilityChecks.iOS15APIAvailableOrSkipTest()
+
+        let url = try XCTUnwrap(URL(string: "https://blob.example.com/blob"))
+        MockRemoteConfigBlobURLProtocol.handler = { request in
+            return (
+                try Self.response(url: try XCTUnwrap(request.url), statusCode: 206, headers: [
+                    "Content-Range": "bytes 0-3/4"
+                ]),
+                Data([1, 2, 3, 4])
+            )
+        }
+
+        do {
+            _ = try await self.downloader().data(from: url, resuming: Self.partial(Data([9])))
+            fail("Expected downloader to throw")
+        } catch let error as URLSessionRemoteConfigBlobDownloader.Error {
+            expect(error) == .invalidResponse
+        }
+    }
+
+    func testResumedDownloadStartsOverWhenRangeIsNotSatisfiable() async throws {
+        try AvailabilityChecks.iOS15APIAvailableOrSkipTest()
+
+        let url = try XCTUnwrap(URL(string: "https://blob.example.com/blob"))
+        let blob = "short".asData
+        var capturedRanges: [String?] = []
+        MockRemoteConfigBlobURLProtocol.handler = { request in
+            let range = request.value(forHTTPHeaderField: "Range")
+            capturedRanges.append(range)
+            return (
+                try Self.response(url: try XCTUnwrap(request.url), statusCode: range == nil ? 200 : 416),
+                range == nil ? blob : Data()
+            )
+        }
+
+        let data = try await self.downloader().data(from: url, resuming: Self.partial(Data(count: 64)))
+
+        expect(capturedRanges) == ["bytes=64-", nil]
+        expect(data) == blob
+    }
+
+    func testInterruptedDownloadKeepsReceivedBytesForNextAttempt() async throws {
+        try AvailabilityChecks.iOS15APIAvailableOrSkipTest()
+        try self.requireURLProtocolErrorInjection()
+
+        let directoryURL = FileManager.default.temporaryDirectory
+            .appendingPathComponent("RemoteConfigBlobDownloaderTests-\(UUID().uuidString)", isDirectory: true)
+        defer { try? FileManager.default.removeItem(at: directoryURL) }
+        let store = RemoteConfigBlobPartialDownloadStore(directoryURL: directoryURL)
+        let url = try XCTUnwrap(URL(string: "https://blob.example.com/blob"))
+        let received = Data(repeating: 7, count: RemoteConfigBlobPartialDownloadStore.minimumByteCount)
+        MockRemoteConfigBlobURLProtocol.handler = { request in
+            return (try Self.response(url: try XCTUnwrap(request.url), statusCode: 200), received)
+        }
+        MockRemoteConfigBlobURLProtocol.failureAfterBody = URLError(.networkConnectionLost)
+
+        do {
+            _ = try await self.downloader().data(from: url, resuming: store.partialDownload(for: Self.ref))
+            fail("Expected downloader to throw")
+        } catch {
+            expect(store.partialDownload(for: Self.ref).prefix) == received
+        }
+    }
+
+    func testCancelledDownloadDoesNotKeepReceivedBytes() async throws {
+        try AvailabilityChecks.iOS15APIAvailableOrSkipTest()
+        try self.requireURLProtocolErrorInjection()
+
+        let directoryURL = FileManager.default.temporaryDirectory
+            .appendingPathComponent("RemoteConfigBlobDownloaderTests-\(UUID().uuidString)", isDirectory: true)
+        defer { try? FileManager.default.removeItem(at: directoryURL) }
+        let store = RemoteConfigBlobPartialDownloadStore(directoryURL: directoryURL)
+        let url = try XCTUnwrap(URL(string: "https://blob.example.com/blob"))
+        let received = Data(repeating: 7, count: RemoteConfigBlobPartialDownloadStore.minimumByteCount)
+        MockRemoteConfigBlobURLProtocol.handler = { request in
+            return (try Self.response(url: try XCTUnwrap(request.url), statusCode: 200), received)
+        }
+        // What the losing side of a hedge sees once the request that won cancels it.
+        MockRemoteConfigBlobURLProtocol.failureAfterBody = URLError(.cancelled)
+
+        do {
+            _ = try await self.downloader().data(from: url, resuming: store.partialDownload(for: Self.ref))
+            fail("Expected downloader to throw")
+        } catch {
+            expect(store.partialDownload(for: Self.ref).prefix).to(beEmpty())
+        }
+    }
+
 }
 
 private extension RemoteConfigBlobDownloaderTests {
 
+    static let ref = "AAAABBBBCCCCDDDDEEEEFFFFGGGGHHHH"
+
+    static func partial(_ prefix: Data) -> RemoteConfigBlobPartialDownload {
+        return RemoteConfigBlobPartialDownload(ref: Self.ref, prefix: prefix, store: nil)
+    }
+
     func downloader(
         timeoutManager: HTTPRequestTimeoutManagerType = MockHTTPRequestTimeoutManager(defaultTimeout: 15)
     ) -> URLSessionRemoteConfigBlobDownloader {
@@ -365,13 +499,14 @@ private extension RemoteConfigBlobDownloaderTests {
 
     static func response(
         url: URL,
-        statusCode: Int
+        statusCode: Int,
+        headers: [String: String]? = nil
     ) throws -> HTTPURLResponse {
         return try XCTUnwrap(HTTPURLResponse(
             url: url,
             statusCode: statusCode,
             httpVersion: nil,
-            headerFields: nil
+            headerFields: headers
         ))
     }
 
@@ -381,6 +516,9 @@ private final class MockRemoteConfigBlobURLProtocol: URLProtocol {
 
     static var handler: ((URLRequest) throws -> (HTTPURLResponse, Data))?
 
+    /// Fails the request after the handler's body was delivered, like a connection dropping mid-download.
+    static var failureAfterBody: Error?
+
     override class func canInit(with request: URLRequest) -> Bool {
         return true
     }
@@ -399,7 +537,11 @@ private final class MockRemoteConfigBlobURLProtocol: URLProtocol {
             let (response, data) = try handler(self.request)
             self.client?.urlProtocol(self, didReceive: response, cacheStoragePolicy: .notAllowed)
             self.client?.urlProtocol(self, didLoad: data)
-            self.client?.urlProtocolDidFinishLoading(self)
+            if let failure = Self.failureAfterBody {
+                self.client?.urlProtocol(self, didFailWithError: failure)
+            } else {
+                self.client?.urlProtocolDidFinishLoading(self)
+            }
         } catch {
             self.client?.urlProtocol(self, didFailWithError: error)
         }
@@ -0,0 +1,55 @@
+//
+//  RemoteConfigBlobFetchUrgencyTests.swift
+//  UnitTests
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+final class RemoteConfigBlobFetchUrgencyTests: TestCase {
+
+    func testOnDemandRunsBeforeFreshPrefetch() {
+        let onDemand = RemoteConfigBlobFetchUrgency.onDemand.sortKey(afterWaiting: 0)
+        let prefetch = RemoteConfigBlobFetchUrgency.prefetch.sortKey(afterWaiting: 0)
+
+        expect(onDemand) < prefetch
+    }
+
+    func testPrefetchAgesAheadOfFreshOnDemand() {
+        let urgency = RemoteConfigBlobFetchUrgency.self
+        let catchUpWait = (urgency.onDemand.weight / urgency.prefetch.weight - 1) * urgency.agingInterval
+        let onDemand = RemoteConfigBlobFetchUrgency.onDemand.sortKey(afterWaiting: 0)
+
+        expect(RemoteConfigBlobFetchUrgency.prefetch.sortKey(afterWaiting: catchUpWait)) == onDemand
+        expect(RemoteConfigBlobFetchUrgency.prefetch.sortKey(afterWaiting: catchUpWait + 1)) < onDemand
+    }
+
+    func testEarlierDeadlineRunsFirstRegardlessOfWeight() {
+        let now = Date()
+        let soon = RemoteConfigBlobFetchUrgency(weight: 1, deadline: now)
+        let later = RemoteConfigBlobFetchUrgency(weight: 100, deadline: now.addingTimeInterval(1))
+        let none = RemoteConfigBlobFetchUrgency(weight: 1000)
+
+        expect(soon.sortKey(afterWaiting: 0)) < later.sortKey(afterWaiting: 0)
+        expect(later.sortKey(afterWaiting: 0)) < none.sortKey(afterWaiting: 100)
+    }
+
+    func testMergeKeepsHigherWeightAndEarlierDeadline() {
+        let now = Date()
+        let heavy = RemoteConfigBlobFetchUrgency(weight: 5, deadline: now.addingTimeInterval(10))
+        let urgent = RemoteConfigBlobFetchUrgency(weight: 1, deadline: now)
+
+        expect(heavy.merged(with: urgent)) == RemoteConfigBlobFetchUrgency(weight: 5, deadline: now)
+        expect(urgent.merged(with: heavy)) == RemoteConfigBlobFetchUrgency(weight: 5, deadline: now)
+        expect(heavy.merged(with: .prefetch).deadline) == heavy.deadline
+    }
+
+    func testWeightIsClampedSoEveryRequestAges() {
+        expect(RemoteConfigBlobFetchUrgency(weight: -1).weight) == RemoteConfigBlobFetchUrgency.minimumWeight
+    }
+
+}
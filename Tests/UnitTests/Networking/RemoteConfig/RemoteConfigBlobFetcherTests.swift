@@ -394,6 +394,99 @@ final class RemoteConfigBlobFetcherTests: TestCase {
         expect(Array(self.downloader.requestedRefs.prefix(4))) == Array(refs.prefix(4))
     }
 
+    func testConcurrencyLimitGrowsWhileDownloadsSucceedWithQueuedWork() async {
+        self.fetcher = RemoteConfigBlobFetcher(
+            blobStore: self.blobStore,
+            sourceProvider: self.sourceProvider,
+            downloader: self.downloader,
+            concurrencyLimiter: RemoteConfigBlobConcurrencyLimiter(initialLimit: 1)
+        )
+        let refs = (0..<4).map { Self.ref(for: "blob-\($0)".asData) }
+
+        self.fetcher.prefetch(refs: refs)
+        await self.downloader.waitForRequestCount(1)
+        expect(self.downloader.activeRequestCount) == 1
+
+        self.downloader.complete(ref: refs[0], with: .success("blob-0".asData))
+
+        await self.downloader.waitForRequestCount(3)
+        expect(self.downloader.activeRequestCount) == 2
+    }
+
+    func testReportsConcurrencyLimitToDiagnosticsOnceIdle() async throws {
+        try AvailabilityChecks.iOS15APIAvailableOrSkipTest()
+
+        let diagnosticsTracker = MockDiagnosticsTracker()
+        self.fetcher = RemoteConfigBlobFetcher(
+            blobStore: self.blobStore,
+            sourceProvider: self.sourceProvider,
+            downloader: self.downloader,
+            diagnosticsTracker: diagnosticsTracker
+        )
+        let payload = "reported".asData
+        let ref = Self.ref(for: payload)
+
+        let task = Task { await self.fetcher.ensureDownloaded(ref: ref) }
+        await self.downloader.waitForRequestCount(1)
+        expect(diagnosticsTracker.trackedRemoteConfigBlobConcurrencyLimits.value).to(beEmpty())
+
+        self.downloader.complete(ref: ref, with: .success(payload))
+        _ = await task.value
+
+        await expect(diagnosticsTracker.trackedRemoteConfigBlobConcurrencyLimits.value).toEventually(
+            equal([RemoteConfigBlobConcurrencyLimiter.defaultInitialLimit])
+        )
+    }
+
+    func testSlowOnDemandDownloadIsHedgedAgainstNextSource() async throws {
+        self.useHedgingSources()
+        let payload = "hedged".asData
+        let ref = Self.ref(for: payload)
+
+        let task = Task { await self.fetcher.ensureDownloaded(ref: ref) }
+        await self.downloader.waitForRequestCount(2)
+        let backupURL = try XCTUnwrap(URL(string: Self.backupTemplateURL.replacingOccurrences(
+            of: Self.placeholder,
+            with: ref
+        )))
+        expect(self.downloader.requestedURLs.last) == backupURL
+
+        self.downloader.complete(url: backupURL, with: .success(payload))
+
+        let result = await task.value
+        expect(result) == true
+        expect(self.blobStore.invokedWriteCount) == 1
+        expect(self.downloader.activeRequestCount) == 0
+        expect(self.sourceProvider.getCurrent(for: .blob)?.url) == Self.templateURL
+    }
+
+    func testHedgedDownloadKeepsWaitingForHedgeWhenPrimaryFails() async {
+        self.useHedgingSources()
+        let payload = "hedged".asData
+        let ref = Self.ref(for: payload)
+
+        let task = Task { await self.fetcher.ensureDownloaded(ref: ref) }
+        await self.downloader.waitForRequestCount(2)
+        self.downloader.complete(url: self.downloader.requestedURLs[0], with: .failure(TestError()))
+        await self.waitForScheduledTaskToReachFetcher()
+        self.downloader.complete(url: self.downloader.requestedURLs[1], with: .success(payload))
+
+        let result = await task.value
+        expect(result) == true
+        expect(self.downloader.requestedURLs).to(haveCount(2))
+    }
+
+    func testPrefetchIsNotHedged() async {
+        self.useHedgingSources()
+        let ref = Self.ref(for: "prefetched".asData)
+
+        self.fetcher.prefetch(refs: [ref])
+        await self.downloader.waitForRequestCount(1)
+        try? await Task.sleep(nanoseconds: 200_000_000)
+
+        expect(self.downloader.requestedURLs).to(haveCount(1))
+    }
+
     func testPrefetchSchedulesLowPriorityRefs() async {
         let refs = (0..<4).map { Self.ref(for: "prefetch-\($0)".asData) }
 
@@ -444,6 +537,99 @@ final class RemoteConfigBlobFetcherTests: TestCase {
         expect(result) == true
     }
 
+    func testLongQueuedPrefetchAgesAheadOfNewOnDemandRequest() async {
+        let dateProvider = self.useSingleDownloadSlot()
+        let refs = (0..<2).map { Self.ref(for: "prefetch-\($0)".asData) }
+        let onDemandRef = Self.ref(for: "on demand".asData)
+
+        self.fetcher.prefetch(refs: refs)
+        await self.downloader.waitForRequestCount(1)
+        dateProvider.advance(by: 10 * RemoteConfigBlobFetchUrgency.agingInterval)
+
+        Task { await self.fetcher.ensureDownloaded(ref: onDemandRef) }
+        await self.waitForScheduledTaskToReachFetcher()
+        self.downloader.complete(ref: refs[0], with: .success("prefetch-0".asData))
+
+        await self.downloader.waitForRequestCount(2)
+        expect(self.downloader.requestedRefs[1]) == refs[1]
+    }
+
+    func testRequestWithDeadlineRunsBeforeHeavierRequests() async {
+        let dateProvider = self.useSingleDownloadSlot()
+        let blockingRef = Self.ref(for: "blocking".asData)
+        let heavyRef = Self.ref(for: "heavy".asData)
+        let deadlineRef = Self.ref(for: "deadline".asData)
+
+        self.fetcher.prefetch(refs: [blockingRef])
+        await self.downloader.waitForRequestCount(1)
+        Task { await self.fetcher.ensureDownloaded(ref: heavyRef, urgency: .init(weight: 100)) }
+        await self.waitForScheduledTaskToReachFetcher()
+        let urgency = RemoteConfigBlobFetchUrgency.prefetch.withDeadline(dateProvider.now().addingTimeInterval(1))
+        Task { await self.fetcher.ensureDownloaded(ref: deadlineRef, urgency: urgency) }
+        await self.waitForScheduledTaskToReachFetcher()
+        self.downloader.complete(ref: blockingRef, with: .success("blocking".asData))
+
+        await self.downloader.waitForRequestCount(2)
+        expect(self.downloader.requestedRefs[1]) == deadlineRef
+    }
+
+    func testPromoteMovesQueuedRefAhead() async {
+        let dateProvider = self.useSingleDownloadSlot()
+        let refs = (0..<3).map { Self.ref(for: "prefetch-\($0)".asData) }
+
+        self.fetcher.prefetch(refs: refs)
+        await self.downloader.waitForRequestCount(1)
+        await self.fetcher.promote(ref: refs[2], deadline: dateProvider.now())
+        self.downloader.complete(ref: refs[0], with: .success("prefetch-0".asData))
+
+        await self.downloader.waitForRequestCount(2)
+        expect(self.downloader.requestedRefs[1]) == refs[2]
+    }
+
+    func testQueueWaitTimeIsReportedPerRef() async {
+        let dateProvider = self.useSingleDownloadSlot()
+        let refs = (0..<2).map { Self.ref(for: "prefetch-\($0)".asData) }
+
+        self.fetcher.prefetch(refs: refs)
+        await self.downloader.waitForRequestCount(1)
+        dateProvider.advance(by: 3)
+
+        let startedWait = await self.fetcher.queueWaitTime(for: refs[0])
+        let queuedWait = await self.fetcher.queueWaitTime(for: refs[1])
+        expect(startedWait) == 0
+        expect(queuedWait) == 3
+
+        self.downloader.complete(ref: refs[0], with: .success("prefetch-0".asData))
+        await self.downloader.waitForRequestCount(2)
+        dateProvider.advance(by: 5)
+
+        let finishedWait = await self.fetcher.queueWaitTime(for: refs[1])
+        let unknownWait = await self.fetcher.queueWaitTime(for: Self.ref(for: "unknown".asData))
+        expect(finishedWait) == 3
+        expect(unknownWait).to(beNil())
+    }
+
+    func testRetainOnlyForgetsQueueWaitTimesOfUnreferencedRefs() async {
+        let dateProvider = self.useSingleDownloadSlot()
+        let refs = (0..<3).map { Self.ref(for: "prefetch-\($0)".asData) }
+
+        self.fetcher.prefetch(refs: refs)
+        await self.downloader.waitForRequestCount(1)
+        dateProvider.advance(by: 2)
+        self.downloader.complete(ref: refs[0], with: .success("prefetch-0".asData))
+        await self.downloader.waitForRequestCount(2)
+        self.downloader.complete(ref: refs[1], with: .success("prefetch-1".asData))
+        await self.downloader.waitForRequestCount(3)
+
+        self.fetcher.retainOnly([refs[1]])
+
+        await expect { await self.fetcher.queueWaitTime(for: refs[0]) }.toEventually(beNil())
+        let retainedWait = await self.fetcher.queueWaitTime(for: refs[1])
+        let inFlightWait = await self.fetcher.queueWaitTime(for: refs[2])
+        expect(retainedWait) == 2
+        expect(inFlightWait) == 2
+    }
+
     func testEnsureAllDownloadedReturnsFalseWhenAnyRefFails() async {
         let successPayload = "success".asData
         let successRef = Self.ref(for: successPayload)
@@ -493,6 +679,30 @@ private extension RemoteConfigBlobFetcherTests {
         return data.withUnsafeBytes { RemoteConfigBlobRefHelpers.ref(for: $0) }
     }
 
+    /// Configures a primary and a backup blob source and hedges after the minimum delay.
+    func useHedgingSources() {
+        self.sourceProvider = Self.sourceProvider(urls: [Self.templateURL, Self.backupTemplateURL])
+        self.fetcher = RemoteConfigBlobFetcher(
+            blobStore: self.blobStore,
+            sourceProvider: self.sourceProvider,
+            downloader: self.downloader,
+            hedgingPolicy: RemoteConfigBlobHedgingPolicy(initialDelay: 0)
+        )
+    }
+
+    /// Runs one download at a time against a clock that only moves when the test advances it.
+    func useSingleDownloadSlot() -> MockCurrentDateProvider {
+        let dateProvider = MockCurrentDateProvider()
+        self.fetcher = RemoteConfigBlobFetcher(
+            blobStore: self.blobStore,
+            sourceProvider: self.sourceProvider,
+            downloader: self.downloader,
+            concurrencyLimiter: RemoteConfigBlobConcurrencyLimiter(initialLimit: 1, maximumLimit: 1),
+            dateProvider: dateProvider
+        )
+        return dateProvider
+    }
+
     func waitForScheduledTaskToReachFetcher() async {
         await Task.yield()
         try? await Task.sleep(nanoseconds: 50_000_000)
@@ -562,6 +772,7 @@ private final class MockFetcherBlobStore: RemoteConfigBlobStoreType {
 private final class SuspendingRemoteConfigBlobDownloader: RemoteConfigBlobDownloaderType {
 
     private struct PendingRequest {
+        let id: UUID
         let url: URL
         let continuation: CheckedContinuation<Data, Error>
     }
@@ -583,17 +794,31 @@ private final class SuspendingRemoteConfigBlobDownloader: RemoteConfigBlobDownlo
     }
 
     func data(from url: URL) async throws -> Data {
-        return try await withCheckedThrowingContinuation { continuation in
-            self.lock.perform {
-                self.requestedURLHistory.append(url)
-                self.pendingRequests.append(PendingRequest(url: url, continuation: continuation))
+        let id = UUID()
+
+        return try await withTaskCancellationHandler {
+            try await withCheckedThrowingContinuation { continuation in
+                self.lock.perform {
+                    self.requestedURLHistory.append(url)
+                    self.pendingRequests.append(PendingRequest(id: id, url: url, continuation: continuation))
+                }
             }
+        } onCancel: {
+            self.complete(where: { $0.id == id }, with: .failure(CancellationError()))
         }
     }
 
     func complete(ref: String, with result: Result<Data, Error>) {
+        self.complete(where: { $0.url.lastPathComponent == ref }, with: result)
+    }
+
+    func complete(url: URL, with result: Result<Data, Error>) {
+        self.complete(where: { $0.url == url }, with: result)
+    }
+
+    private func complete(where matches: (PendingRequest) -> Bool, with result: Result<Data, Error>) {
         let request = self.lock.perform {
-            guard let index = self.pendingRequests.firstIndex(where: { $0.url.lastPathComponent == ref }) else {
+            guard let index = self.pendingRequests.firstIndex(where: matches) else {
                 return nil as PendingRequest?
             }
 
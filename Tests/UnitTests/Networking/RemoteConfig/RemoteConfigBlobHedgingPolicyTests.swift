@@ -0,0 +1,59 @@
+//
+//  RemoteConfigBlobHedgingPolicyTests.swift
+//  UnitTests
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+final class RemoteConfigBlobHedgingPolicyTests: TestCase {
+
+    func testUsesInitialDelayUntilEnoughSamples() {
+        var policy = RemoteConfigBlobHedgingPolicy(initialDelay: 2)
+
+        for _ in 1..<RemoteConfigBlobHedgingPolicy.minimumSampleCount {
+            policy.record(latency: 0.2)
+        }
+
+        expect(policy.delay) == 2
+    }
+
+    func testDelayIsPercentileOfRecordedLatencies() {
+        var policy = RemoteConfigBlobHedgingPolicy(percentile: 0.9)
+
+        for latency in 1...10 {
+            policy.record(latency: Double(latency) / 10)
+        }
+
+        expect(policy.delay).to(beCloseTo(0.9))
+    }
+
+    func testDelayIsNotBelowMinimum() {
+        var policy = RemoteConfigBlobHedgingPolicy(initialDelay: 0)
+        expect(policy.delay) == RemoteConfigBlobHedgingPolicy.minimumDelay
+
+        for _ in 0..<RemoteConfigBlobHedgingPolicy.minimumSampleCount {
+            policy.record(latency: 0.001)
+        }
+
+        expect(policy.delay) == RemoteConfigBlobHedgingPolicy.minimumDelay
+    }
+
+    func testOldestSamplesAreReplacedOnceFull() {
+        var policy = RemoteConfigBlobHedgingPolicy()
+
+        for _ in 0..<RemoteConfigBlobHedgingPolicy.sampleCapacity {
+            policy.record(latency: 5)
+        }
+        for _ in 0..<RemoteConfigBlobHedgingPolicy.sampleCapacity {
+            policy.record(latency: 0.5)
+        }
+
+        expect(policy.delay) == 0.5
+    }
+
+}
@@ -0,0 +1,97 @@
+//
+//  RemoteConfigBlobPartialDownloadStoreTests.swift
+//  UnitTests
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+final class RemoteConfigBlobPartialDownloadStoreTests: TestCase {
+
+    private var directoryURL: URL!
+    private var store: RemoteConfigBlobPartialDownloadStore!
+
+    override func setUpWithError() throws {
+        try super.setUpWithError()
+
+        self.directoryURL = FileManager.default.temporaryDirectory
+            .appendingPathComponent("RemoteConfigBlobPartialDownloadStoreTests-\(UUID().uuidString)", isDirectory: true)
+        self.store = RemoteConfigBlobPartialDownloadStore(directoryURL: self.directoryURL)
+    }
+
+    override func tearDownWithError() throws {
+        try? FileManager.default.removeItem(at: self.directoryURL)
+        self.store = nil
+        self.directoryURL = nil
+
+        try super.tearDownWithError()
+    }
+
+    func testPartialDownloadIsEmptyWhenNothingWasKept() {
+        expect(self.store.partialDownload(for: Self.refA).prefix).to(beEmpty())
+    }
+
+    func testSavedBytesAreLoadedByNextPartialDownload() {
+        self.store.partialDownload(for: Self.refA).save(Self.largePrefix)
+
+        expect(self.store.partialDownload(for: Self.refA).prefix) == Self.largePrefix
+        expect(self.store.partialDownload(for: Self.refB).prefix).to(beEmpty())
+    }
+
+    func testShortPrefixesAreNotKept() {
+        self.store.partialDownload(for: Self.refA).save(Self.largePrefix)
+
+        self.store.partialDownload(for: Self.refA).save(Data([1, 2, 3]))
+
+        expect(self.store.partialDownload(for: Self.refA).prefix).to(beEmpty())
+    }
+
+    func testDiscardRemovesKeptBytes() {
+        self.store.partialDownload(for: Self.refA).save(Self.largePrefix)
+
+        self.store.partialDownload(for: Self.refA).discard()
+
+        expect(self.store.partialDownload(for: Self.refA).prefix).to(beEmpty())
+    }
+
+    func testMalformedRefIsNeverKept() {
+        self.store.partialDownload(for: "../escape").save(Self.largePrefix)
+
+        expect(self.store.partialDownload(for: "../escape").prefix).to(beEmpty())
+        expect(FileManager.default.fileExists(atPath: self.directoryURL.path)) == false
+    }
+
+    func testOnlyMostRecentPrefixesAreKept() throws {
+        let refs = (0...RemoteConfigBlobPartialDownloadStore.maximumFileCount).map { index in
+            String(repeating: String(UnicodeScalar(UInt8(65 + index))), count: 32)
+        }
+
+        for (index, ref) in refs.enumerated() {
+            self.store.partialDownload(for: ref).save(Self.largePrefix)
+            try FileManager.default.setAttributes(
+                [.modificationDate: Date(timeIntervalSince1970: TimeInterval(index))],
+                ofItemAtPath: self.directoryURL.appendingPathComponent(ref).path
+            )
+        }
+        self.store.partialDownload(for: Self.refB).save(Self.largePrefix)
+
+        expect(self.store.partialDownload(for: refs[0]).prefix).to(beEmpty())
+        expect(self.store.partialDownload(for: refs[1]).prefix).to(beEmpty())
+        expect(self.store.partialDownload(for: refs[2]).prefix) == Self.largePrefix
+        expect(self.store.partialDownload(for: Self.refB).prefix) == Self.largePrefix
+    }
+
+}
+
+private extension RemoteConfigBlobPartialDownloadStoreTests {
+
+    static let refA = "AAAABBBBCCCCDDDDEEEEFFFFGGGGHHHH"
+    static let refB = "IIIIJJJJKKKKLLLLMMMMNNNNOOOOPPPP"
+
+    static let largePrefix = Data(repeating: 1, count: RemoteConfigBlobPartialDownloadStore.minimumByteCount)
+
+}
@@ -246,6 +246,54 @@ final class RemoteConfigBlobStoreTests: TestCase {
         expect(fileManager.waitForContentsOfDirectory()) == true
     }
 
+    func testStreamingWriteStoresChunksInOrder() throws {
+        let chunks = [Data([1, 2, 3]), Data(), Data(repeating: 4, count: 100)]
+        let expected = chunks.reduce(Data(), +)
+        let ref = Self.ref(for: expected)
+
+        expect(try self.streamingWrite(ref: ref, chunks: chunks)) == expected.count
+
+        expect(self.blobStore.read(ref: ref)) == expected
+        expect(self.blobStore.cachedRefs()) == [ref]
+    }
+
+    func testStreamingWriteRejectsChunksThatDoNotMatchRef() throws {
+        let chunks = [Data([1, 2, 3])]
+        let wrongRef = Self.ref(for: Data([9]))
+
+        expect(try self.streamingWrite(ref: wrongRef, chunks: chunks)).to(throwError(
+            RCContainer.Parser.FormatError.checksumMismatch(expected: wrongRef, actual: Self.ref(for: Data([1, 2, 3])))
+        ))
+
+        expect(self.blobStore.contains(ref: wrongRef)) == false
+        expect(try self.partialFiles()).to(beEmpty())
+    }
+
+    func testStreamingWritePropagatesProducerErrorsWithoutStoring() throws {
+        let data = Data([1, 2, 3])
+        let ref = Self.ref(for: data)
+
+        expect(try self.blobStore.write(ref: ref) { writeChunk in
+            try data.withUnsafeBytes(writeChunk)
+            throw RCContainer.Parser.FormatError.contentDecompressionFailed(1)
+        }).to(throwError(RCContainer.Parser.FormatError.contentDecompressionFailed(1)))
+
+        expect(self.blobStore.contains(ref: ref)) == false
+        expect(try self.partialFiles()).to(beEmpty())
+    }
+
+    func testStreamingWriteReplacesExistingBlobAndIsIgnoredByPruning() throws {
+        let data = Data([1, 2, 3])
+        let ref = Self.ref(for: data)
+        self.write(ref: ref, data: data)
+
+        expect(try self.streamingWrite(ref: ref, chunks: [data])) == data.count
+        self.blobStore.retainOnly([ref])
+
+        expect(self.blobStore.read(ref: ref)) == data
+        expect(RemoteConfigBlobStore(directoryURL: self.directoryURL).cachedRefs()) == [ref]
+    }
+
 }
 
 private extension RemoteConfigBlobStoreTests {
@@ -260,6 +308,25 @@ private extension RemoteConfigBlobStoreTests {
         }
     }
 
+    func streamingWrite(ref: String, chunks: [Data]) throws -> Int? {
+        return try self.blobStore.write(ref: ref) { writeChunk in
+            for chunk in chunks {
+                try chunk.withUnsafeBytes(writeChunk)
+            }
+        }
+    }
+
+    func partialFiles() throws -> [URL] {
+        let partialDirectoryURL = self.directoryURL.appendingPathComponent(".partial", isDirectory: true)
+        guard FileManager.default.fileExists(atPath: partialDirectoryURL.path) else { return [] }
+
+        return try FileManager.default.contentsOfDirectory(at: partialDirectoryURL, includingPropertiesForKeys: nil)
+    }
+
+    static func ref(for data: Data) -> String {
+        return data.withUnsafeBytes(RemoteConfigBlobRefHelpers.ref(for:))
+    }
+
 }
 
 private final class FailingFileManager: FileManager {
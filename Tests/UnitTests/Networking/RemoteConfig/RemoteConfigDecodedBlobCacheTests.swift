@@ -0,0 +1,54 @@
+//
+//  RemoteConfigDecodedBlobCacheTests.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+final class RemoteConfigDecodedBlobCacheTests: TestCase {
+
+    func testKeysValuesByRefsAndType() {
+        let cache = RemoteConfigDecodedBlobCache()
+        cache.store("decoded", for: .init(ref: "ref-1", type: String.self), byteCount: 9)
+
+        expect(cache.value(for: .init(ref: "ref-1", type: String.self), as: String.self)) == "decoded"
+        expect(cache.value(for: .init(ref: "ref-1", type: Int.self), as: Int.self)).to(beNil())
+        expect(cache.value(for: .init(ref: "ref-2", type: String.self), as: String.self)).to(beNil())
+        expect(cache.value(
+            for: .init(itemKeys: ["item"], refs: ["ref-1"], type: String.self),
+            as: String.self
+        )).to(beNil())
+    }
+
+    func testRetainOnlyDropsValuesDecodedFromAnyRemovedRef() {
+        let cache = RemoteConfigDecodedBlobCache()
+        let single = RemoteConfigDecodedBlobCache.Key(ref: "ref-1", type: String.self)
+        let merged = RemoteConfigDecodedBlobCache.Key(itemKeys: ["a", "b"], refs: ["ref-1", "ref-2"], type: String.self)
+        let unrelated = RemoteConfigDecodedBlobCache.Key(ref: "ref-3", type: String.self)
+        cache.store("single", for: single, byteCount: 1)
+        cache.store("merged", for: merged, byteCount: 1)
+        cache.store("unrelated", for: unrelated, byteCount: 1)
+
+        cache.retainOnly(["ref-1", "ref-3"])
+
+        expect(cache.value(for: single, as: String.self)) == "single"
+        expect(cache.value(for: merged, as: String.self)).to(beNil())
+        expect(cache.value(for: unrelated, as: String.self)) == "unrelated"
+    }
+
+    func testClearDropsEveryValue() {
+        let cache = RemoteConfigDecodedBlobCache()
+        let key = RemoteConfigDecodedBlobCache.Key(ref: "ref-1", type: String.self)
+        cache.store("decoded", for: key, byteCount: 1)
+
+        cache.clear()
+
+        expect(cache.value(for: key, as: String.self)).to(beNil())
+    }
+
+}
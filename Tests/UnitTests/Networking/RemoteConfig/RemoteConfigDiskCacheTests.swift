@@ -299,6 +299,50 @@ final class RemoteConfigDiskCacheTests: TestCase {
         expect(FileManager.default.fileExists(atPath: self.fileURL.path)) == true
     }
 
+    func testWriteContainerPersistsContainerWithElementIndex() throws {
+        let data = RCContainerTestData.container(
+            config: #"{"manifest":"v1.1710000100.sources:etag1"}"#.asData,
+            contentElements: ["blob payload".asData]
+        )
+        let containerURL = self.cacheDirectoryURL
+            .appendingPathComponent(RemoteConfigDiskCache.containerFileName, isDirectory: false)
+
+        self.cache.writeContainer(try RemoteConfigContainer(data: data))
+
+        expect(RCContainer.validElementIndex(forContainerAt: containerURL)?.entries.count).toEventually(equal(2))
+        expect(try Data(contentsOf: containerURL)) == data
+    }
+
+    func testClearDiscardsPendingContainerWrites() throws {
+        let data = RCContainerTestData.container(
+            config: #"{"manifest":"v1.1710000100.sources:etag1"}"#.asData,
+            contentElements: ["blob payload".asData]
+        )
+
+        self.cache.writeContainer(try RemoteConfigContainer(data: data))
+        self.cache.clear()
+
+        expect(self.cache.readContainer()).to(beNil())
+    }
+
+    func testReadContainerReopensWrittenContainer() throws {
+        let payload = "blob payload".asData
+        let data = RCContainerTestData.container(
+            config: #"{"manifest":"v1.1710000100.sources:etag1"}"#.asData,
+            contentElements: [payload]
+        )
+
+        self.cache.writeContainer(try RemoteConfigContainer(data: data))
+
+        let container = try XCTUnwrap(self.cache.readContainer())
+        let element = try XCTUnwrap(container.element(withChecksum: RCContainerTestData.blobRef(for: payload)))
+        expect(try element.withDecodedPayloadBytes { Data($0) }) == payload
+    }
+
+    func testReadContainerReturnsNilWhenNoContainerWasWritten() {
+        expect(self.cache.readContainer()).to(beNil())
+    }
+
     func testWriteLogsWhenCacheCannotWrite() {
         self.cache = RemoteConfigDiskCache(cache: .init(
             cache: MockSimpleCache(cacheDirectory: nil),
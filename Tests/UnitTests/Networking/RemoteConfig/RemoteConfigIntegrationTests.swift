@@ -318,7 +318,7 @@ final class RemoteConfigIntegrationTests: TestCase {
         let ref = RCContainerTestData.blobRef(for: blob)
         let container = try Self.containerData(
             topics: Self.workflowTopic(ref: ref),
-            contentElements: [(blob, .zstd)]
+            contentElements: [(blob, .unsupported(0xff))]
         )
 
         await self.refresh(with: container)
@@ -439,7 +439,7 @@ final class RemoteConfigIntegrationTests: TestCase {
         }
     }
 
-    func testInlineBlobWriteFailureFallsBackToExternalBlobDownload() async throws {
+    func testInlineBlobWriteFailureIsRestoredFromPersistedContainer() async throws {
         let blob = #"{"workflow":"inline-write-failed"}"#.asData
         let ref = RCContainerTestData.blobRef(for: blob)
         let source = Self.blobSource("primary")
@@ -466,7 +466,8 @@ final class RemoteConfigIntegrationTests: TestCase {
         let requestedURLs = await self.downloader.requestedURLStrings()
 
         expect(data) == blob
-        expect(requestedURLs) == [Self.url(source, ref: ref)]
+        expect(requestedURLs).to(beEmpty())
+        expect(failingBlobStore.writeCount) == 2
         expect(self.blobStore.read(ref: ref)) == blob
     }
 
@@ -868,6 +868,74 @@ final class RemoteConfigManagerTests: TestCase {
         expect(self.blobStore.invokedReadRefs) == [ref]
     }
 
+    func testPrioritizedBlobIsPromotedAndReadWithItsDeadline() async throws {
+        let ref = RCContainerTestData.blobRef(for: #"{"id":"workflow"}"#.asData)
+        let cachedRef = "cachedBlob"
+        self.diskCache.stubbedRead = Self.persisted(
+            manifest: "v1.1710000100.workflows:etag1",
+            topics: .init(entries: ["workflows": [
+                "default": .init(blobRef: ref),
+                "cached": .init(blobRef: cachedRef)
+            ]])
+        )
+        self.blobStore.stubbedContainsRefs = [cachedRef]
+        self.blobStore.stubbedReadDataByRef[ref] = #"{"id":"workflow"}"#.asData
+        let deadline = self.dateProvider.now().addingTimeInterval(3)
+
+        await self.manager.prioritizeBlobs(
+            for: .workflows,
+            itemKeys: ["default", "cached", "missing"],
+            within: 3
+        )
+        _ = await self.manager.blobData(for: .workflows, itemKey: "default")
+        _ = await self.manager.blobData(for: .workflows, itemKey: "default")
+
+        expect(self.blobFetcher.invokedPromoteParameters.map(\.ref)) == [ref]
+        expect(self.blobFetcher.invokedPromoteParameters.map(\.deadline)) == [deadline]
+        expect(self.blobFetcher.invokedEnsureDownloadedUrgencies) == [.onDemand.withDeadline(deadline), .onDemand]
+    }
+
+    func testExpiredBlobDeadlineIsNotApplied() async throws {
+        let ref = RCContainerTestData.blobRef(for: #"{"id":"workflow"}"#.asData)
+        self.diskCache.stubbedRead = Self.persisted(
+            manifest: "v1.1710000100.workflows:etag1",
+            topics: .init(entries: ["workflows": ["default": .init(blobRef: ref)]])
+        )
+        self.blobStore.stubbedReadDataByRef[ref] = #"{"id":"workflow"}"#.asData
+
+        await self.manager.prioritizeBlobs(
+            for: .workflows,
+            itemKeys: ["default"],
+            within: 3
+        )
+        self.dateProvider.advance(by: 4)
+        _ = await self.manager.blobData(for: .workflows, itemKey: "default")
+
+        expect(self.blobFetcher.invokedEnsureDownloadedUrgencies) == [.onDemand]
+    }
+
+    func testClearCacheDropsBlobDeadlines() async throws {
+        let ref = RCContainerTestData.blobRef(for: #"{"id":"workflow"}"#.asData)
+        let persisted = Self.persisted(
+            manifest: "v1.1710000100.workflows:etag1",
+            topics: .init(entries: ["workflows": ["default": .init(blobRef: ref)]])
+        )
+        self.diskCache.stubbedRead = persisted
+        self.blobStore.stubbedReadDataByRef[ref] = #"{"id":"workflow"}"#.asData
+
+        await self.manager.prioritizeBlobs(
+            for: .workflows,
+            itemKeys: ["default"],
+            within: 3
+        )
+        self.manager.clearCache()
+        self.diskCache.stubbedRead = persisted
+        _ = await self.manager.blobData(for: .workflows, itemKey: "default")
+
+        expect(self.blobFetcher.invokedRetainOnlyParameters) == [[]]
+        expect(self.blobFetcher.invokedEnsureDownloadedUrgencies) == [.onDemand]
+    }
+
     func testEnsureBlobsDownloadedDelegatesToBlobFetcher() async {
         let refs = ["ref-1", "ref-2"]
 
@@ -970,6 +1038,62 @@ final class RemoteConfigManagerTests: TestCase {
         }
     }
 
+    func testBlobDataReusesDecodedValueWithoutRereadingBlob() async throws {
+        let ref = RCContainerTestData.blobRef(for: #"{"id":"workflow"}"#.asData)
+        self.diskCache.stubbedRead = Self.persisted(
+            manifest: "v1.1710000100.workflows:etag1",
+            topics: .init(entries: ["workflows": ["default": .init(blobRef: ref)]])
+        )
+        self.blobStore.stubbedReadDataByRef[ref] = #"{"id":"workflow"}"#.asData
+
+        let first = try await self.manager.blobData(for: .workflows, itemKey: "default", as: WorkflowPayload.self)
+        let second = try await self.manager.blobData(for: .workflows, itemKey: "default", as: WorkflowPayload.self)
+
+        expect(first) == WorkflowPayload(id: "workflow")
+        expect(second) == first
+        expect(self.blobFetcher.invokedEnsureDownloadedRefs) == [ref]
+        expect(self.blobStore.invokedReadRefs) == [ref]
+    }
+
+    func testBlobDataDecodesAgainAfterClearCache() async throws {
+        let ref = RCContainerTestData.blobRef(for: #"{"id":"workflow"}"#.asData)
+        self.diskCache.stubbedRead = Self.persisted(
+            manifest: "v1.1710000100.workflows:etag1",
+            topics: .init(entries: ["workflows": ["default": .init(blobRef: ref)]])
+        )
+        self.blobStore.stubbedReadDataByRef[ref] = #"{"id":"workflow"}"#.asData
+
+        _ = try await self.manager.blobData(for: .workflows, itemKey: "default", as: WorkflowPayload.self)
+        self.manager.clearCache()
+        let value = try await self.manager.blobData(for: .workflows, itemKey: "default", as: WorkflowPayload.self)
+
+        expect(value) == WorkflowPayload(id: "workflow")
+        expect(self.blobStore.invokedReadRefs) == [ref, ref]
+    }
+
+    func testMergeItemsBlobDataReusesDecodedValueWithoutRereadingBlobs() async throws {
+        let blob = #"{"value":"favorite"}"#.asData
+        let ref = RCContainerTestData.blobRef(for: blob)
+        self.diskCache.stubbedRead = Self.persisted(
+            manifest: "v1.1710000100.workflows:etag1",
+            topics: .init(entries: [
+                "workflows": ["favorite_workflow": .init(blobRef: ref)]
+            ])
+        )
+        self.blobStore.stubbedReadDataByRef[ref] = blob
+
+        for _ in 0..<3 {
+            let value = try await self.manager.mergeItemsBlobData(
+                for: .workflows,
+                itemKeys: ["favorite_workflow"],
+                as: MergedSnakeCaseWorkflowPayload.self
+            )
+
+            expect(value) == MergedSnakeCaseWorkflowPayload(favoriteWorkflow: .init(value: "favorite"))
+        }
+        expect(self.blobStore.invokedReadRefs) == [ref]
+    }
+
     func testMergeItemsBlobDataMergesBlobJSONUnderItemKeys() async throws {
         let appBlob = #"{"enabled": true}"#.asData
         let localizationsBlob = #"{"en_US": {"day": "Day"}}"#.asData
@@ -1650,6 +1774,7 @@ final class RemoteConfigManagerTests: TestCase {
 
         expect(Self.blobRefsByTopic(from: self.diskCache.invokedWriteParameter?.topics)) == ["sources": ["newSources"]]
         expect(self.blobStore.invokedRetainOnlyParameters) == Set(["newSources"])
+        expect(self.blobFetcher.invokedRetainOnlyParameters) == [Set(["newSources"])]
     }
 
     func testContainerResponsePrunesBlobRefsForItemsDroppedFromChangedTopic() throws {
@@ -2419,6 +2544,25 @@ final class RemoteConfigManagerTests: TestCase {
         expect(self.blobStore.invokedWriteParameters?.data) == blob
     }
 
+    func testContainerResponsePersistsResponseContainer() throws {
+        let response = """
+        {
+          "domain": "app",
+          "manifest": "v1.1710000100.sources:etag2",
+          "active_topics": ["sources"],
+          "topics": {}
+        }
+        """
+        let container = try Self.container(config: response, contentElements: ["blob payload".asData])
+
+        self.manager.refreshRemoteConfig(fetchContext: .appStart, isAppBackgrounded: false)
+        self.remoteConfigAPI.complete(
+            with: .success(.test(container: container, verificationResult: .verified))
+        )
+
+        expect(self.diskCache.invokedWriteContainerParameters) == [container.data]
+    }
+
     func testBlobDataReadsContainerInlineBlobAfterItIsStored() async throws {
         let blob = #"{"id":"workflow"}"#.asData
         let blobRef = RCContainerTestData.blobRef(for: blob)
@@ -2454,6 +2598,46 @@ final class RemoteConfigManagerTests: TestCase {
         expect(self.blobStore.invokedReadRefs) == [blobRef]
     }
 
+    func testBlobDataRestoresMissingInlineBlobFromPersistedContainer() async throws {
+        let blob = #"{"id":"workflow"}"#.asData
+        let ref = RCContainerTestData.blobRef(for: blob)
+        self.diskCache.stubbedRead = Self.persisted(
+            manifest: "v1.1710000100.workflows:etag1",
+            topics: .init(entries: ["workflows": ["default": .init(blobRef: ref)]])
+        )
+        self.diskCache.stubbedContainer = try RCContainer(data: RCContainerTestData.container(
+            config: "{}".asData,
+            contentElements: [blob]
+        ))
+
+        let data = await self.manager.blobData(for: .workflows, itemKey: "default")
+
+        expect(data) == blob
+        expect(self.diskCache.invokedReadContainerCount) == 1
+        expect(self.blobStore.invokedWriteParameters?.ref) == ref
+        expect(self.blobFetcher.invokedEnsureDownloadedRefs).to(beEmpty())
+    }
+
+    func testBlobDataDownloadsBlobMissingFromPersistedContainer() async throws {
+        let blob = #"{"id":"workflow"}"#.asData
+        let ref = RCContainerTestData.blobRef(for: blob)
+        self.diskCache.stubbedRead = Self.persisted(
+            manifest: "v1.1710000100.workflows:etag1",
+            topics: .init(entries: ["workflows": ["default": .init(blobRef: ref)]])
+        )
+        self.diskCache.stubbedContainer = try RCContainer(data: RCContainerTestData.container(
+            config: "{}".asData,
+            contentElements: ["other payload".asData]
+        ))
+        self.blobStore.stubbedReadDataByRef[ref] = blob
+
+        let data = await self.manager.blobData(for: .workflows, itemKey: "default")
+
+        expect(data) == blob
+        expect(self.blobStore.invokedWriteCount) == 0
+        expect(self.blobFetcher.invokedEnsureDownloadedRefs) == [ref]
+    }
+
     func testSingleElementFixtureCachesReferencedWorkflowBlob() throws {
         let fixture = try XCTUnwrap(RCContainerTestData.allFixtures.first { $0.fileName == "v1_single_element.bin" })
         let container = try RemoteConfigContainer(data: RCContainerTestData.container(fixture: fixture))
@@ -2528,7 +2712,7 @@ final class RemoteConfigManagerTests: TestCase {
             with: .success(.test(
                 container: try Self.compressedContainer(
                     config: response,
-                    contentElements: [(payload: blob, encoding: .zstd)]
+                    contentElements: [(payload: blob, encoding: .unsupported(0xff))]
                 ),
                 verificationResult: .verified
             ))
@@ -3339,6 +3523,7 @@ private final class MockRemoteConfigAPI: RemoteConfigAPIType {
 private final class MockRemoteConfigDiskCache: RemoteConfigDiskCacheType {
 
     var stubbedRead: PersistedRemoteConfiguration?
+    var stubbedContainer: RCContainer?
     var stubbedWriteResult = true
     var readHandler: (() -> PersistedRemoteConfiguration?)?
     var writeHandler: ((PersistedRemoteConfiguration) -> Bool)?
@@ -3348,6 +3533,8 @@ private final class MockRemoteConfigDiskCache: RemoteConfigDiskCacheType {
     private(set) var invokedWriteParameter: PersistedRemoteConfiguration?
     private(set) var invokedReadCount = 0
     private(set) var invokedClearCount = 0
+    private(set) var invokedWriteContainerParameters: [Data] = []
+    private(set) var invokedReadContainerCount = 0
 
     func read() -> PersistedRemoteConfiguration? {
         self.invokedReadCount += 1
@@ -3366,6 +3553,15 @@ private final class MockRemoteConfigDiskCache: RemoteConfigDiskCacheType {
         return self.writeHandler?(configuration) ?? self.stubbedWriteResult
     }
 
+    func writeContainer(_ container: RemoteConfigContainer) {
+        self.invokedWriteContainerParameters.append(container.data)
+    }
+
+    func readContainer() -> RCContainer? {
+        self.invokedReadContainerCount += 1
+        return self.stubbedContainer
+    }
+
     func clear() {
         self.invokedClearCount += 1
         self.clearHandler?()
@@ -3435,9 +3631,12 @@ private final class MockRemoteConfigBlobFetcher: RemoteConfigBlobFetcherType {
 
     private let lock = Lock()
     private var _invokedEnsureDownloadedRefs: [String] = []
+    private var _invokedEnsureDownloadedUrgencies: [RemoteConfigBlobFetchUrgency] = []
     private(set) var invokedEnsureAllDownloadedRefs: [String] = []
     private(set) var invokedPrefetchCount = 0
     private(set) var invokedPrefetchRefs: [String] = []
+    private(set) var invokedPromoteParameters: [(ref: String, deadline: Date)] = []
+    private(set) var invokedRetainOnlyParameters: [Set<String>] = []
 
     var invokedEnsureDownloadedRefs: [String] {
         return self.lock.perform {
@@ -3445,9 +3644,20 @@ private final class MockRemoteConfigBlobFetcher: RemoteConfigBlobFetcherType {
         }
     }
 
+    var invokedEnsureDownloadedUrgencies: [RemoteConfigBlobFetchUrgency] {
+        return self.lock.perform {
+            self._invokedEnsureDownloadedUrgencies
+        }
+    }
+
     func ensureDownloaded(ref: String) async -> Bool {
+        return await self.ensureDownloaded(ref: ref, urgency: .onDemand)
+    }
+
+    func ensureDownloaded(ref: String, urgency: RemoteConfigBlobFetchUrgency) async -> Bool {
         self.lock.perform {
             self._invokedEnsureDownloadedRefs.append(ref)
+            self._invokedEnsureDownloadedUrgencies.append(urgency)
         }
         return self.stubbedEnsureDownloadedResult
     }
@@ -3467,4 +3677,12 @@ private final class MockRemoteConfigBlobFetcher: RemoteConfigBlobFetcherType {
         self.invokedPrefetchRefs = refs
     }
 
+    func promote(ref: String, deadline: Date) async {
+        self.invokedPromoteParameters.append((ref, deadline))
+    }
+
+    func retainOnly(_ refs: Set<String>) {
+        self.invokedRetainOnlyParameters.append(refs)
+    }
+
 }
@@ -0,0 +1,284 @@
+//
+//  RemoteConfigPackedBlobStoreTests.swift
+//  UnitTests
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+final class RemoteConfigPackedBlobStoreTests: TestCase {
+
+    private var directoryURL: URL!
+    private var blobStore: RemoteConfigPackedBlobStore!
+
+    override func setUpWithError() throws {
+        try super.setUpWithError()
+
+        self.directoryURL = FileManager.default.temporaryDirectory
+            .appendingPathComponent("RemoteConfigPackedBlobStoreTests-\(UUID().uuidString)", isDirectory: true)
+        self.blobStore = self.makeStore()
+    }
+
+    override func tearDownWithError() throws {
+        try? FileManager.default.removeItem(at: self.directoryURL)
+        self.blobStore = nil
+        self.directoryURL = nil
+
+        try super.tearDownWithError()
+    }
+
+    func testReadReturnsNilForMissingBlob() {
+        expect(self.blobStore.read(ref: Self.refA)).to(beNil())
+        expect(self.blobStore.contains(ref: Self.refA)) == false
+    }
+
+    func testWriteThenReadRoundTripsBlobBytes() {
+        let dataA = Data([1, 2, 3, 4, 5])
+        let dataB = Data([6, 7])
+
+        expect(self.write(ref: Self.refA, data: dataA)) == true
+        expect(self.write(ref: Self.refB, data: dataB)) == true
+
+        expect(self.blobStore.read(ref: Self.refA)) == dataA
+        expect(self.blobStore.read(ref: Self.refB)) == dataB
+        expect(self.blobStore.cachedRefs()) == [Self.refA, Self.refB]
+    }
+
+    func testWriteRejectsMalformedRef() {
+        expect(self.write(ref: "not-a-ref", data: Data([1]))) == false
+        expect(self.blobStore.cachedRefs()).to(beEmpty())
+    }
+
+    func testWritingExistingRefAgainDoesNotGrowPack() throws {
+        self.write(ref: Self.refA, data: Data([1, 2, 3]))
+        self.write(ref: Self.refA, data: Data([1, 2, 3]))
+
+        expect(try self.segmentSizes()) == [3]
+    }
+
+    func testReopenedStoreReadsBlobsFromIndex() {
+        self.write(ref: Self.refA, data: Data([1, 2, 3]))
+        self.write(ref: Self.refB, data: Data([4, 5]))
+
+        let reopened = self.makeStore()
+
+        expect(reopened.cachedRefs()) == [Self.refA, Self.refB]
+        expect(reopened.read(ref: Self.refB)) == Data([4, 5])
+    }
+
+    func testReopenedStoreIgnoresCorruptedIndex() throws {
+        self.write(ref: Self.refA, data: Data([1, 2, 3]))
+        self.write(ref: Self.refB, data: Data([4]))
+        self.blobStore.retainOnly([Self.refA])
+
+        let indexURL = self.directoryURL.appendingPathComponent("index")
+        var index = try Data(contentsOf: indexURL)
+        index[10] ^= 0xFF
+        try index.write(to: indexURL)
+
+        expect(self.makeStore().cachedRefs()).to(beEmpty())
+    }
+
+    func testAppendedBlobsAreJournaledWithoutRewritingIndex() throws {
+        self.write(ref: Self.refA, data: Data([1, 2, 3]))
+        self.write(ref: Self.refB, data: Data([4, 5]))
+
+        expect(FileManager.default.fileExists(atPath: self.indexURL.path)) == false
+        expect(try Data(contentsOf: self.journalURL).count) == 2 * 48
+    }
+
+    func testJournalIsFoldedIntoIndexOnceItGrows() throws {
+        let blobs = (0..<65).map { Data([UInt8($0)]) }
+        for blob in blobs {
+            self.write(ref: RCContainerTestData.blobRef(for: blob), data: blob)
+        }
+
+        expect(FileManager.default.fileExists(atPath: self.indexURL.path)) == true
+        expect(FileManager.default.fileExists(atPath: self.journalURL.path)) == false
+
+        let reopened = self.makeStore()
+        expect(reopened.cachedRefs()) == Set(blobs.map(RCContainerTestData.blobRef(for:)))
+        expect(reopened.read(ref: RCContainerTestData.blobRef(for: blobs[64]))) == blobs[64]
+    }
+
+    func testReopenedStoreReplaysJournalUpToTornRecord() throws {
+        self.write(ref: Self.refA, data: Data([1, 2, 3]))
+        self.write(ref: Self.refB, data: Data([4, 5]))
+
+        let journal = try Data(contentsOf: self.journalURL)
+        try journal.dropLast(10).write(to: self.journalURL)
+
+        let reopened = self.makeStore()
+        expect(reopened.cachedRefs()) == [Self.refA]
+        expect(FileManager.default.fileExists(atPath: self.journalURL.path)) == false
+        expect(self.makeStore().read(ref: Self.refA)) == Data([1, 2, 3])
+    }
+
+    func testSerializedJournalRecordsRoundTrip() throws {
+        let key = try XCTUnwrap(RCContainer.ChecksumKey(ref: Self.refA))
+        let location = RemoteConfigPackedBlobStore.Location(segment: 2, offset: 1 << 33, length: 7)
+
+        let record = RemoteConfigPackedBlobStore.serializedJournalRecord(key: key, location: location)
+        var corrupted = record
+        corrupted[0] ^= 0xFF
+
+        let journal = RemoteConfigPackedBlobStore.records(fromSerializedJournal: record + record.dropLast())
+        expect(journal.records.map(\.key)) == [key]
+        expect(journal.records.map(\.location)) == [location]
+        expect(journal.isComplete) == false
+        expect(RemoteConfigPackedBlobStore.records(fromSerializedJournal: corrupted).records).to(beEmpty())
+    }
+
+    func testMigratesBlobsFromLegacyStore() throws {
+        let legacyDirectoryURL = self.directoryURL.appendingPathComponent("legacy", isDirectory: true)
+        let legacyStore = RemoteConfigBlobStore(directoryURL: legacyDirectoryURL)
+        Data([1, 2, 3]).withUnsafeBytes { _ = legacyStore.write(ref: Self.refA, bytes: $0) }
+
+        self.blobStore = RemoteConfigPackedBlobStore(
+            directoryURL: self.directoryURL.appendingPathComponent("pack", isDirectory: true),
+            migratingFrom: legacyStore
+        )
+
+        expect(self.blobStore.read(ref: Self.refA)) == Data([1, 2, 3])
+        expect(FileManager.default.fileExists(atPath: legacyDirectoryURL.path)) == false
+    }
+
+    func testReadSeesBlobsAppendedAfterSegmentWasMapped() {
+        self.write(ref: Self.refA, data: Data([1, 2, 3]))
+        expect(self.blobStore.read(ref: Self.refA)) == Data([1, 2, 3])
+
+        self.write(ref: Self.refB, data: Data([4, 5]))
+
+        expect(self.blobStore.read(ref: Self.refB)) == Data([4, 5])
+    }
+
+    func testWritesRollOverToNewSegmentAtMaximumSize() throws {
+        self.blobStore = self.makeStore(maximumSegmentSize: 4)
+
+        self.write(ref: Self.refA, data: Data([1, 2, 3]))
+        self.write(ref: Self.refB, data: Data([4, 5]))
+        self.write(ref: Self.refC, data: Data([6, 7, 8, 9, 10]))
+
+        expect(try self.segmentSizes()) == [3, 2, 5]
+        expect(self.blobStore.read(ref: Self.refC)) == Data([6, 7, 8, 9, 10])
+    }
+
+    func testRetainOnlyDropsOtherRefsAndCompactsPack() throws {
+        self.write(ref: Self.refA, data: Data([1, 2, 3]))
+        self.write(ref: Self.refB, data: Data([4, 5, 6, 7]))
+        self.write(ref: Self.refC, data: Data([8]))
+
+        self.blobStore.retainOnly([Self.refC])
+
+        expect(self.blobStore.cachedRefs()) == [Self.refC]
+        expect(self.blobStore.read(ref: Self.refA)).to(beNil())
+        expect(self.blobStore.read(ref: Self.refC)) == Data([8])
+        expect(try self.segmentSizes()) == [1]
+        expect(self.makeStore().read(ref: Self.refC)) == Data([8])
+    }
+
+    func testRetainOnlyKeepsPackWhileMostBytesAreLive() throws {
+        self.write(ref: Self.refA, data: Data([1]))
+        self.write(ref: Self.refB, data: Data([2, 3, 4, 5]))
+
+        self.blobStore.retainOnly([Self.refB])
+
+        expect(try self.segmentSizes()) == [5]
+        expect(self.makeStore().cachedRefs()) == [Self.refB]
+    }
+
+    func testStreamingWriteStoresVerifiedBlob() throws {
+        let data = Data("streamed blob".utf8)
+        let ref = RCContainerTestData.blobRef(for: data)
+
+        let byteCount = try self.blobStore.write(ref: ref) { writeChunk in
+            try data.prefix(4).withUnsafeBytes(writeChunk)
+            try data.dropFirst(4).withUnsafeBytes(writeChunk)
+        }
+
+        expect(byteCount) == data.count
+        expect(self.blobStore.read(ref: ref)) == data
+    }
+
+    func testStreamingWriteRejectsBytesNotMatchingRef() throws {
+        expect {
+            try self.blobStore.write(ref: Self.refA) { writeChunk in
+                try Data([1, 2, 3]).withUnsafeBytes(writeChunk)
+            }
+        }.to(throwError(RCContainer.Parser.FormatError.self))
+
+        expect(self.blobStore.contains(ref: Self.refA)) == false
+        expect(try self.segmentSizes()).to(beEmpty())
+    }
+
+    func testClearRemovesAllBlobs() {
+        self.write(ref: Self.refA, data: Data([1]))
+
+        self.blobStore.clear()
+
+        expect(self.blobStore.cachedRefs()).to(beEmpty())
+        expect(FileManager.default.fileExists(atPath: self.directoryURL.path)) == false
+        expect(self.makeStore().cachedRefs()).to(beEmpty())
+    }
+
+    func testSerializedIndexRoundTrips() throws {
+        let key = try XCTUnwrap(RCContainer.ChecksumKey(ref: Self.refA))
+        let entries = [key: RemoteConfigPackedBlobStore.Location(segment: 3, offset: 1 << 33, length: 12)]
+
+        let serialized = RemoteConfigPackedBlobStore.serializedIndex(entries)
+
+        expect(RemoteConfigPackedBlobStore.entries(fromSerializedIndex: serialized)) == entries
+        expect(RemoteConfigPackedBlobStore.entries(fromSerializedIndex: serialized.dropLast())).to(beNil())
+    }
+
+}
+
+private extension RemoteConfigPackedBlobStoreTests {
+
+    static let refA = "AAAABBBBCCCCDDDDEEEEFFFFGGGGHHHH"
+    static let refB = "IIIIJJJJKKKKLLLLMMMMNNNNOOOOPPPP"
+    static let refC = "QQQQRRRRSSSSTTTTUUUUVVVVWWWWXXXX"
+
+    func makeStore(
+        maximumSegmentSize: Int = RemoteConfigPackedBlobStore.defaultMaximumSegmentSize
+    ) -> RemoteConfigPackedBlobStore {
+        return RemoteConfigPackedBlobStore(directoryURL: self.directoryURL, maximumSegmentSize: maximumSegmentSize)
+    }
+
+    var indexURL: URL {
+        return self.directoryURL.appendingPathComponent("index")
+    }
+
+    var journalURL: URL {
+        return self.directoryURL.appendingPathComponent("index-journal")
+    }
+
+    @discardableResult
+    func write(ref: String, data: Data) -> Bool {
+        return data.withUnsafeBytes { bytes in
+            self.blobStore.write(ref: ref, bytes: bytes)
+        }
+    }
+
+    /// Sizes of the segment files on disk, ordered by segment number.
+    func segmentSizes() throws -> [Int] {
+        guard FileManager.default.fileExists(atPath: self.directoryURL.path) else {
+            return []
+        }
+
+        return try FileManager.default.contentsOfDirectory(atPath: self.directoryURL.path)
+            .filter { $0.hasPrefix("segment-") }
+            .sorted { ($0.count, $0) < ($1.count, $1) }
+            .map { name in
+                let attributes = try FileManager.default.attributesOfItem(
+                    atPath: self.directoryURL.appendingPathComponent(name).path
+                )
+                return try XCTUnwrap((attributes[.size] as? NSNumber)?.intValue)
+            }
+    }
+
+}
@@ -164,6 +164,36 @@ final class RemoteConfigSourceProviderTests: TestCase {
         expect(provider.getCurrent(for: .blob)?.url) == Self.url("blob2")
     }
 
+    // MARK: - peekNext
+
+    func testPeekNextReturnsFollowingSourceWithoutAdvancing() {
+        let provider = Self.provider(
+            api: [],
+            blob: [Self.source("blob1", priority: 0), Self.source("blob2", priority: 10)]
+        )
+
+        expect(provider.peekNext(for: .blob)?.url) == Self.url("blob2")
+        expect(provider.peekNext(for: .blob)?.purpose) == .blob
+        expect(provider.getCurrent(for: .blob)?.url) == Self.url("blob1")
+    }
+
+    func testPeekNextIsNilOnLastSource() {
+        let provider = Self.provider(api: [], blob: [Self.source("blob")])
+
+        expect(provider.peekNext(for: .blob)).to(beNil())
+    }
+
+    func testReportingPeekedSourceDoesNotAdvance() throws {
+        let provider = Self.provider(
+            api: [],
+            blob: [Self.source("blob1", priority: 0), Self.source("blob2", priority: 10)]
+        )
+
+        provider.reportUnhealthy(try XCTUnwrap(provider.peekNext(for: .blob)))
+
+        expect(provider.getCurrent(for: .blob)?.url) == Self.url("blob1")
+    }
+
     // MARK: - Stale report handling (race conditions)
 
     func testStaleReportIsIgnoredAfterAnotherCallerAdvanced() {
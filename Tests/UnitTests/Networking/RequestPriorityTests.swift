@@ -0,0 +1,79 @@
+//
+//  RequestPriorityTests.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+final class RequestPriorityTests: TestCase {
+
+    func testPrioritiesAreOrdered() {
+        expect(RequestPriority.allCases.sorted()) == [.background, .userVisible, .userBlocking]
+    }
+
+    func testHigherPrioritiesMapToHigherQueueAndTaskPriorities() {
+        let priorities = RequestPriority.allCases.sorted()
+
+        expect(priorities.map(\.queuePriority.rawValue)) == priorities.map(\.queuePriority.rawValue).sorted()
+        expect(priorities.map(\.taskPriority)) == [
+            URLSessionTask.lowPriority,
+            URLSessionTask.defaultPriority,
+            URLSessionTask.highPriority
+        ]
+        expect(RequestPriority.background.qualityOfService) == .background
+        expect(RequestPriority.userBlocking.qualityOfService) == .userInitiated
+    }
+
+    func testPathPriorities() {
+        expect(HTTPRequest.Path.postReceiptData.priority) == .userBlocking
+        expect(HTTPRequest.Path.logIn.priority) == .userBlocking
+        expect(HTTPRequest.Path.getCustomerInfo(appUserID: "user").priority) == .userBlocking
+        expect(HTTPRequest.Path.getOfferings(appUserID: "user").priority) == .userVisible
+        expect(HTTPRequest.Path.postSubscriberAttributes(appUserID: "user").priority) == .background
+        expect(HTTPRequest.Path.health.priority) == .background
+        expect(HTTPRequest.DiagnosticsPath.postDiagnostics.priority) == .background
+        expect(HTTPRequest.WebBillingPath.getWebOfferingProducts(appUserID: "user").priority) == .userVisible
+    }
+
+    func testOperationPrioritiesMatchTheirPaths() {
+        expect(PostReceiptDataOperation.priority) == HTTPRequest.Path.postReceiptData.priority
+        expect(LogInOperation.priority) == HTTPRequest.Path.logIn.priority
+        expect(GetOfferingsOperation.priority) == HTTPRequest.Path.getOfferings(appUserID: "user").priority
+        expect(PostSubscriberAttributesOperation.priority)
+            == HTTPRequest.Path.postSubscriberAttributes(appUserID: "user").priority
+        expect(HealthOperation.priority) == HTTPRequest.Path.health.priority
+        expect(DiagnosticsPostOperation.priority) == HTTPRequest.DiagnosticsPath.postDiagnostics.priority
+    }
+
+    func testMetricsAreEmptyUntilRecorded() {
+        let metrics = RequestPriorityMetrics()
+
+        expect(metrics.latency(for: .userBlocking)) == .init()
+        expect(metrics.latency(for: .userBlocking).averageDuration) == 0
+    }
+
+    func testMetricsAverageLatencyPerPriority() {
+        let metrics = RequestPriorityMetrics()
+
+        metrics.record(.userBlocking, queueWaitTime: 0, duration: 0.2)
+        metrics.record(.userBlocking, queueWaitTime: 0.1, duration: 0.4)
+        metrics.record(.background, queueWaitTime: 2, duration: 1)
+
+        let userBlocking = metrics.latency(for: .userBlocking)
+        expect(userBlocking.count) == 2
+        expect(userBlocking.averageQueueWaitTime).to(beCloseTo(0.05))
+        expect(userBlocking.averageDuration).to(beCloseTo(0.3))
+
+        let background = metrics.latency(for: .background)
+        expect(background.count) == 1
+        expect(background.averageQueueWaitTime).to(beCloseTo(2))
+
+        expect(metrics.latency(for: .userVisible).count) == 0
+    }
+
+}
@@ -165,6 +165,36 @@ final class SignatureVerificationHTTPClientTests: BaseSignatureVerificationHTTPC
         expect(response?.value?.verificationResult) == .verified
     }
 
+    func testVerifiedResponseIsCountedAsPerformedVerification() {
+        self.changeClient(.informational)
+        self.mockResponse(signature: Self.sampleSignature, requestDate: Date())
+
+        self.signing.stubbedVerificationResult = true
+
+        let response: DataResponse? = waitUntilValue { completion in
+            self.client.perform(.createWithResponseVerification(method: .get, path: Self.path),
+                                completionHandler: completion)
+        }
+
+        expect(response?.value?.verificationResult) == .verified
+        expect(self.client.signatureVerificationMetrics.value.performedCount) == 1
+        expect(self.client.signatureVerificationMetrics.value.skippedCount) == 0
+    }
+
+    func testUnverifiedResponseIsCountedAsSkippedVerification() {
+        self.changeClient(.disabled)
+        self.mockResponse()
+
+        let response: DataResponse? = waitUntilValue { completion in
+            self.client.perform(.init(method: .get, path: Self.path), completionHandler: completion)
+        }
+
+        expect(response?.value?.verificationResult) == .notRequested
+        expect(self.client.signatureVerificationMetrics.value) == .init(performedCount: 0,
+                                                                         skippedCount: 1,
+                                                                         totalDuration: 0)
+    }
+
     func testSignatureNotRequested() {
         self.changeClient(.disabled)
         self.mockResponse()
@@ -0,0 +1,114 @@
+//
+//  SourceHealthMonitorTests.swift
+//  RevenueCat
+//
+//  Created by RevenueCat.
+//  Copyright © 2026 RevenueCat, Inc. All rights reserved.
+
+import Foundation
+import Nimble
+@testable import RevenueCat
+import XCTest
+
+final class SourceHealthMonitorTests: TestCase {
+
+    private static let host = "api.revenuecat.com"
+
+    private var dateProvider: MockCurrentDateProvider!
+    private var monitor: SourceHealthMonitor!
+
+    override func setUp() {
+        super.setUp()
+
+        self.dateProvider = MockCurrentDateProvider()
+        self.monitor = SourceHealthMonitor(dateProvider: self.dateProvider)
+    }
+
+    func testHealthIsNilUntilEnoughRequestsWereRecorded() {
+        for _ in 1..<SourceHealthMonitor.minimumSampleCount {
+            self.monitor.record(.success(latency: 0.1), host: Self.host)
+        }
+        expect(self.monitor.health(ofHost: Self.host)).to(beNil())
+
+        self.monitor.record(.success(latency: 0.1), host: Self.host)
+        expect(self.monitor.health(ofHost: Self.host)?.verdict) == .healthy
+    }
+
+    func testRequestsWithoutHostAreIgnored() {
+        for _ in 0..<10 {
+            self.monitor.record(.failure, host: nil)
+        }
+
+        expect(self.monitor.health(ofHost: nil)).to(beNil())
+    }
+
+    func testHostsAreTrackedSeparately() {
+        self.record(.failure, count: 5)
+
+        expect(self.monitor.health(ofHost: Self.host)?.verdict) == .unhealthy
+        expect(self.monitor.health(ofHost: "api.rc-backup.com")).to(beNil())
+    }
+
+    func testRatesAreExponentiallyWeightedAverages() throws {
+        self.monitor.record(.success(latency: 1), host: Self.host)
+        self.monitor.record(.success(latency: 2), host: Self.host)
+        self.monitor.record(.timeout, host: Self.host)
+
+        let health = try XCTUnwrap(self.monitor.health(ofHost: Self.host))
+        expect(health.latency).to(beCloseTo(1.2))
+        expect(health.errorRate).to(beCloseTo(SourceHealthMonitor.smoothingFactor))
+        expect(health.timeoutRate).to(beCloseTo(SourceHealthMonitor.smoothingFactor))
+        expect(health.sampleCount) == 3
+        expect(health.verdict) == .degraded
+    }
+
+    func testRepeatedFailuresMakeHostUnhealthy() {
+        self.record(.success(latency: 0.1), count: 5)
+        self.record(.failure, count: 5)
+
+        expect(self.monitor.health(ofHost: Self.host)?.verdict) == .unhealthy
+    }
+
+    func testSuccessesAfterFailuresRecoverHost() {
+        self.record(.failure, count: 5)
+        self.record(.success(latency: 0.1), count: 20)
+
+        expect(self.monitor.health(ofHost: Self.host)?.verdict) == .healthy
+    }
+
+    func testSlowHostIsDegraded() {
+        self.record(.success(latency: SourceHealthMonitor.degradedLatency + 1), count: 5)
+
+        expect(self.monitor.health(ofHost: Self.host)?.verdict) == .degraded
+    }
+
+    func testHealthExpiresWhenHostHasBeenQuiet() {
+        self.record(.failure, count: 5)
+
+        self.dateProvider.advance(by: SourceHealthMonitor.freshnessInterval)
+
+        expect(self.monitor.health(ofHost: Self.host)).to(beNil())
+    }
+
+    func testRecordingAfterExpiryStartsOver() throws {
+        self.record(.failure, count: 5)
+        self.dateProvider.advance(by: SourceHealthMonitor.freshnessInterval)
+
+        self.record(.success(latency: 0.1), count: SourceHealthMonitor.minimumSampleCount)
+
+        let health = try XCTUnwrap(self.monitor.health(ofHost: Self.host))
+        expect(health.errorRate) == 0
+        expect(health.sampleCount) == SourceHealthMonitor.minimumSampleCount
+    }
+
+}
+
+private extension SourceHealthMonitorTests {
+
+    func record(_ outcome: SourceHealthMonitor.Outcome, count: Int) {
+        for _ in 0..<count {
+            self.monitor.record(outcome, host: Self.host)
+        }
+    }
+
+}
@@ -141,6 +141,19 @@ final class WeightedSourceSelectorTests: TestCase {
         expect(selector.current).to(beNil())
     }
 
+    func testNextPeeksWithoutAdvancing() {
+        let high = TestSource(id: "high", priority: 10, weight: 1)
+        let low = TestSource(id: "low", priority: 0, weight: 1)
+        let selector = WeightedSourceSelector(sources: [high, low], randomizer: FakeRandomizer(0))
+
+        expect(selector.next) == high
+        expect(selector.next) == high
+        expect(selector.current) == low
+
+        selector.advance()
+        expect(selector.next).to(beNil())
+    }
+
     func testAdvanceWalksTiedSourcesByWeightExcludingTried() {
         // sourceA(30) is drawn first via target 0; the rest of the tier is precomputed, so advancing
         // walks to the only remaining source (b) without consuming more randomness.
@@ -183,6 +196,40 @@ final class WeightedSourceSelectorTests: TestCase {
         expect(selector.advance()) == high
     }
 
+    // MARK: - healthRank
+
+    func testHealthRankMovesWorseSourcesBehindTheirTier() {
+        let sourceA = TestSource(id: "a", priority: 0, weight: 30)
+        let sourceB = TestSource(id: "b", priority: 0, weight: 70)
+        let backup = TestSource(id: "backup", priority: 1, weight: 1)
+        let selector = WeightedSourceSelector(
+            sources: [sourceA, sourceB, backup],
+            randomizer: FakeRandomizer(0),
+            healthRank: { $0.id == "a" ? 1 : 0 }
+        )
+
+        expect(selector.current?.id) == "b"
+        expect(selector.advance()?.id) == "a"
+        expect(selector.advance()?.id) == "backup"
+    }
+
+    func testHealthRankIsReadAgainOnReset() {
+        let sourceA = TestSource(id: "a", priority: 0, weight: 30)
+        let sourceB = TestSource(id: "b", priority: 0, weight: 70)
+        var unhealthyID = "b"
+        let selector = WeightedSourceSelector(
+            sources: [sourceA, sourceB],
+            randomizer: FakeRandomizer(0),
+            healthRank: { $0.id == unhealthyID ? 1 : 0 }
+        )
+        expect(selector.current?.id) == "a"
+
+        unhealthyID = "a"
+        selector.reset()
+
+        expect(selector.current?.id) == "b"
+    }
+
     // MARK: - Helpers
 
     private func weightedPairSelector(target: Int) -> WeightedSourceSelector<TestSource> {
@@ -25,6 +25,7 @@ class WorkflowsConfigProviderTests: TestCase {
     private var diskCache: FakeRemoteConfigDiskCache!
     private var blobStore: FakeRemoteConfigBlobStore!
     private var blobFetcher: FakeRemoteConfigBlobFetcher!
+    private var dateProvider: MockCurrentDateProvider!
     private var manager: RemoteConfigManager!
     private var uiConfigProvider: UiConfigProvider!
     private var provider: WorkflowsConfigProvider!
@@ -35,12 +36,14 @@ class WorkflowsConfigProviderTests: TestCase {
         self.diskCache = FakeRemoteConfigDiskCache()
         self.blobStore = FakeRemoteConfigBlobStore()
         self.blobFetcher = FakeRemoteConfigBlobFetcher(blobStore: self.blobStore)
+        self.dateProvider = MockCurrentDateProvider()
         self.manager = RemoteConfigManager(
             remoteConfigAPI: FakeRemoteConfigAPI(),
             diskCache: self.diskCache,
             blobStore: self.blobStore,
             blobFetcher: self.blobFetcher,
-            currentUserProvider: FakeCurrentUserProvider()
+            currentUserProvider: FakeCurrentUserProvider(),
+            dateProvider: self.dateProvider
         )
         self.uiConfigProvider = UiConfigProvider(manager: self.manager)
         self.provider = WorkflowsConfigProvider(
@@ -63,6 +66,22 @@ class WorkflowsConfigProviderTests: TestCase {
         expect(workflows) == ["workflow-with-offering": "premium_annual"]
     }
 
+    func testPrioritizeWorkflowsPromotesOnlyBodiesThatAreNotDownloadedYet() async {
+        self.commit(
+            workflows: [
+                "downloaded": .init(blobRef: "downloaded-ref", content: [:]),
+                "missing": .init(blobRef: "missing-ref", content: [:])
+            ],
+            blobs: ["downloaded-ref": Data("{}".utf8)]
+        )
+        let deadline = self.dateProvider.now().addingTimeInterval(3)
+
+        await self.provider.prioritizeWorkflows(["downloaded", "missing", "unknown"], within: 3)
+
+        expect(self.blobFetcher.invokedPromoteParameters.map(\.ref)) == ["missing-ref"]
+        expect(self.blobFetcher.invokedPromoteParameters.map(\.deadline)) == [deadline]
+    }
+
     func testResolvesAWorkflowAlreadyCommittedToTheWorkflowsTopic() async throws {
         let workflowJSON = try Self.workflowJSON(id: "wf-1")
         self.commit(
@@ -753,6 +772,12 @@ private final class FakeRemoteConfigDiskCache: RemoteConfigDiskCacheType {
         return true
     }
 
+    func writeContainer(_ container: RemoteConfigContainer) {}
+
+    func readContainer() -> RCContainer? {
+        return nil
+    }
+
     func clear() {
         self.lock.perform {
             self._stubbedRead = nil
@@ -826,6 +851,7 @@ private final class FakeRemoteConfigBlobFetcher: RemoteConfigBlobFetcherType {
     private let blobStore: FakeRemoteConfigBlobStore
     private var _invokedEnsureDownloadedRefs: [String] = []
     private var _invokedEnsureAllDownloadedRefs: [[String]] = []
+    private var _invokedPromoteParameters: [(ref: String, deadline: Date)] = []
 
     var invokedEnsureDownloadedRefs: [String] {
         return self.lock.perform {
@@ -839,6 +865,12 @@ private final class FakeRemoteConfigBlobFetcher: RemoteConfigBlobFetcherType {
         }
     }
 
+    var invokedPromoteParameters: [(ref: String, deadline: Date)] {
+        return self.lock.perform {
+            self._invokedPromoteParameters
+        }
+    }
+
     init(blobStore: FakeRemoteConfigBlobStore) {
         self.blobStore = blobStore
     }
@@ -860,6 +892,12 @@ private final class FakeRemoteConfigBlobFetcher: RemoteConfigBlobFetcherType {
 
     func prefetch(refs: [String]) {}
 
+    func promote(ref: String, deadline: Date) async {
+        self.lock.perform {
+            self._invokedPromoteParameters.append((ref, deadline))
+        }
+    }
+
 }
 
 private final class FakeCurrentUserProvider: CurrentUserProvider {
@@ -26,6 +26,7 @@ class SigningTests: TestCase {
     private let (privateIntermediateKey, publicIntermediateKey) = SigningTests.createRandomKey()
 
     private var signing: Signing!
+    private var intermediateKey: Data?
 
     override func setUpWithError() throws {
         try super.setUpWithError()
@@ -293,6 +294,66 @@ class SigningTests: TestCase {
         )) == true
     }
 
+    func testIntermediateKeyIsOnlyVerifiedAgainstRootKeyOnce() throws {
+        let rootKey = CountingPublicKey(self.publicKey)
+
+        expect(try self.verifyResponse(message: "first", publicKey: rootKey)) == true
+        expect(try self.verifyResponse(message: "second", publicKey: rootKey)) == true
+        expect(try self.verifyResponse(message: "third", publicKey: rootKey)) == true
+
+        expect(rootKey.verificationCount) == 1
+    }
+
+    func testCachedIntermediateKeyStillFailsWithInvalidPayload() throws {
+        let rootKey = CountingPublicKey(self.publicKey)
+
+        expect(try self.verifyResponse(message: "first", publicKey: rootKey)) == true
+        expect(try self.verifyResponse(message: "second",
+                                       signedMessage: "tampered",
+                                       publicKey: rootKey)) == false
+
+        expect(rootKey.verificationCount) == 1
+        self.logger.verifyMessageWasLogged(Strings.signing.signature_failed_verification, level: .warn)
+    }
+
+    func testCachedIntermediateKeyIsRejectedOnceExpired() throws {
+        let clock = TestClock(now: Self.mockDate)
+        self.signing = .init(apiKey: Self.apiKey, clock: clock)
+
+        expect(try self.verifyResponse(message: "first", publicKey: self.publicKey)) == true
+
+        clock.advance(by: .days(6))
+
+        expect(try self.verifyResponse(message: "second", publicKey: self.publicKey)) == false
+        self.logger.verifyMessageWasLogged("Intermediate key expired", level: .warn)
+    }
+
+    func testIntermediateKeyFailingVerificationIsNotCached() throws {
+        let cache = Signing.IntermediateKeyCache()
+        self.signing = .init(apiKey: Self.apiKey, clock: TestClock(now: Self.mockDate), intermediateKeys: cache)
+
+        let (_, otherRootKey) = Self.createRandomKey()
+
+        expect(try self.verifyResponse(message: "first", publicKey: otherRootKey)) == false
+        expect(cache.count) == 0
+    }
+
+    func testIntermediateKeyCacheEvictsOldestEntries() {
+        let cache = Signing.IntermediateKeyCache(capacity: 2)
+        let entry = Signing.IntermediateKeyCache.Entry(publicKey: self.publicIntermediateKey,
+                                                       expiration: Self.intermediateKeyFutureExpiration)
+
+        cache.store(entry, for: "1".asData)
+        cache.store(entry, for: "2".asData)
+        cache.store(entry, for: "2".asData)
+        cache.store(entry, for: "3".asData)
+
+        expect(cache.count) == 2
+        expect(cache["1".asData]).to(beNil())
+        expect(cache["2".asData]).toNot(beNil())
+        expect(cache["3".asData]).toNot(beNil())
+    }
+
     /*
      Instructions for updating these signatures:
      - Perform request in the comment (adding canary header if required)
@@ -1339,6 +1400,63 @@ class SigningTests: TestCase {
         expect(parameters.debugDescription).to(contain("path: '/v1/subscribers/user'"))
     }
 
+    // MARK: - Signed message
+
+    func testSignedMessageContainsComponentsInOrder() {
+        let message = Signing.SignedMessage(["abc".asData, Data(), "de".asData, "f".asData])
+
+        expect(message.regions) == ["abc".asData, "de".asData, "f".asData]
+        expect(message.count) == 6
+        expect(Data(message)) == "abcdef".asData
+        expect(Array(message)) == Array("abcdef".utf8)
+        expect(message[3]) == UInt8(ascii: "d")
+    }
+
+    func testSignedMessageReadsSlicedComponents() {
+        let data = "0123456789".asData
+        let message = Signing.SignedMessage([data[2..<5], data[7...]])
+
+        expect(Data(message)) == "234789".asData
+        expect(Data(message[2..<5])) == "478".asData
+        expect(message[4]) == UInt8(ascii: "8")
+    }
+
+    func testSignedMessageCopiesBytesAcrossRegions() {
+        let message = Signing.SignedMessage(["abc".asData, "de".asData, "f".asData])
+        var bytes = [UInt8](repeating: 0, count: 4)
+
+        let copiedCount = bytes.withUnsafeMutableBytes { message.copyBytes(to: $0, from: 1..<5) }
+
+        expect(copiedCount) == 4
+        expect(bytes) == Array("bcde".utf8)
+    }
+
+    func testEmptySignedMessage() {
+        let message = Signing.SignedMessage([Data(), Data()])
+
+        expect(message.isEmpty) == true
+        expect(Data(message)) == Data()
+    }
+
+    func testSignedMessageMatchesConcatenatedParameters() {
+        let salt = Self.createSalt().asData
+        let body = "{\"subscriber\": {}}".asData
+        let parameters: Signing.SignatureParameters = .init(
+            path: .getCustomerInfo(appUserID: "user"),
+            iamEnabled: false,
+            message: body,
+            nonce: "nonce".asData,
+            etag: "etag",
+            requestDate: 1234
+        )
+
+        let message = parameters.signedMessage(salt: salt, authValue: Self.apiKey)
+
+        expect(Data(message)) == salt + Self.apiKey.asData + "nonce".asData + "/v1/subscribers/user".asData
+            + "1234".asData + "etag".asData + body
+        expect(message.regions.last) == body
+    }
+
 }
 
 private extension SigningTests {
@@ -1357,6 +1475,61 @@ private extension SigningTests {
         return try key.signature(for: parameters.signature(salt: salt, authValue: Self.apiKey))
     }
 
+    /// Verifies a response signed with the intermediate key.
+    /// - Parameter signedMessage: the message that was signed, if different from `message`.
+    func verifyResponse(
+        message: String,
+        signedMessage: String? = nil,
+        publicKey: Signing.PublicKey
+    ) throws -> Bool {
+        let response = try self.signedResponse(message: message, signedMessage: signedMessage)
+
+        return self.signing.verify(signature: response.signature,
+                                   with: response.parameters,
+                                   publicKey: publicKey)
+    }
+
+    /// A response signed with the intermediate key, whose own signature is created once per test like the
+    /// backend does, since Ed25519 signatures from CryptoKit are randomized.
+    func signedResponse(
+        message: String,
+        signedMessage: String? = nil
+    ) throws -> (signature: String, parameters: Signing.SignatureParameters) {
+        let intermediateKey = try self.signedIntermediateKey()
+        let salt = Self.createSalt()
+        let parameters: Signing.SignatureParameters = .init(
+            path: Self.mockPath,
+            iamEnabled: false,
+            message: message.asData,
+            nonce: "nonce".asData,
+            requestDate: 1677005916012
+        )
+
+        var signedParameters = parameters
+        signedParameters.message = (signedMessage ?? message).asData
+
+        let fullSignature = Self.fullSignature(
+            intermediateKey: intermediateKey,
+            salt: salt,
+            signature: try self.sign(parameters: signedParameters, salt: salt.asData)
+        )
+
+        return (fullSignature.base64EncodedString(), parameters)
+    }
+
+    func signedIntermediateKey() throws -> Data {
+        if let intermediateKey = self.intermediateKey {
+            return intermediateKey
+        }
+
+        let intermediateKey = try self.createIntermediatePublicKeyData(
+            expiration: Self.intermediateKeyFutureExpiration
+        )
+        self.intermediateKey = intermediateKey
+
+        return intermediateKey
+    }
+
     static func fullSignature(intermediateKey: Data, salt: String, signature: Data) -> Data {
         return intermediateKey + salt.asData + signature
     }
@@ -1394,6 +1567,27 @@ private extension SigningTests {
 
 }
 
+/// A `SigningPublicKey` that counts how many signatures it checks.
+private final class CountingPublicKey: SigningPublicKey {
+
+    private let key: SigningPublicKey
+    private(set) var verificationCount = 0
+
+    init(_ key: SigningPublicKey) {
+        self.key = key
+    }
+
+    var rawRepresentation: Data {
+        return self.key.rawRepresentation
+    }
+
+    func isValidSignature<D: DataProtocol>(_ signature: Data, for data: D) -> Bool {
+        self.verificationCount += 1
+        return self.key.isValidSignature(signature, for: data)
+    }
+
+}
+
 private extension Date {
 
     /// Khepri encodes expiration as UInt32 little-endian of the number of days since 1970